@@ -0,0 +1,224 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "bench.hpp"
+
+
+namespace nana{
+namespace bench{
+
+using std::ostringstream;
+
+//extern
+Bench Bench::bench;
+
+
+void Bench::exec(const string& p_filter){
+	for(auto i = m_vec.begin(); i != m_vec.end(); ++i){
+		if(!p_filter.empty() && (*i)->m_name.find(p_filter) == string::npos) continue;
+		cout << "[" << (*i)->m_name << "]" << endl;
+		(*i)->exec();
+	}
+};
+
+void Bench::addCorpusFile(const string& p_path){
+	std::ifstream ifs(p_path.c_str(), std::ios::binary);
+	if(!ifs){
+		cout << "can not open: " << p_path << endl;
+		return;
+	}
+	ostringstream os;
+	os << ifs.rdbuf();
+	m_corpus.push_back(os.str());
+};
+
+const vector<string>& Bench::corpus(){
+	if(m_corpus.empty()){
+		//t@C̎w肪ȂꍇA4MB̃y[W8
+		for(unsigned int i = 0; i < 8; ++i) m_corpus.push_back(makeHtmlPage(4 * 1024 * 1024, i + 1));
+	}
+	return m_corpus;
+};
+
+const std::size_t Bench::corpusBytes(){
+	std::size_t bytes = 0;
+	for(auto i = corpus().begin(); i != corpus().end(); ++i) bytes += i->size();
+	return bytes;
+};
+
+
+namespace{
+
+///Č̂闐i`@j
+class Random{
+public:
+	Random(const unsigned int p_seed): m_seed(p_seed){};
+	const unsigned int next(){
+		m_seed = m_seed * 1103515245 + 12345;
+		return (m_seed >> 16) & 0x7fff;
+	};
+private:
+	unsigned int m_seed;
+};
+
+}//namespace{
+
+string makeHtmlPage(const std::size_t p_bytes, const unsigned int p_seed){
+	static const char* tags[] = {"div", "span", "a", "p", "li", "td", "font", "b"};
+	static const char* words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "&amp;", "consectetur", "adipiscing", "elit"};
+	Random rnd(p_seed);
+	ostringstream os;
+	os << "<!DOCTYPE html>\n<html>\n<head><title>bench " << p_seed << "</title>\n";
+	os << "<script>var a = 1; if(a < 2){ a = \"</div>\"; }</script>\n</head>\n<body>\n";
+	vector<const char*> stack;
+	while(static_cast<std::size_t>(os.tellp()) < p_bytes){
+		const unsigned int r = rnd.next() % 100;
+		if(r < 30 && stack.size() < 40){
+			const char* tag = tags[rnd.next() % 8];
+			os << string(stack.size(), ' ') << "<" << tag;
+			os << " class=\"c" << rnd.next() % 50 << " item\"";
+			os << " id='i" << rnd.next() << "'";
+			os << " data-x=" << rnd.next() % 10;
+			if(tag[0] == 'a') os << " href=\"/page/" << rnd.next() << ".html\"";
+			os << ">\n";
+			stack.push_back(tag);
+		} else if(r < 55 && !stack.empty()){
+			os << string(stack.size() - 1, ' ') << "</" << stack.back() << ">\n";
+			stack.pop_back();
+		} else if(r < 60){
+			os << "<img src=\"/img/" << rnd.next() << ".png\" alt='image'><br/>";
+		} else if(r < 63){
+			os << "<!-- comment " << rnd.next() << " <b>old</b> -->\n";
+		} else{
+			const unsigned int n = 3 + rnd.next() % 12;
+			for(unsigned int i = 0; i < n; ++i){
+				os << words[rnd.next() % 9] << (i % 5 == 4 ? "\n" : " ");
+			}
+		}
+	}
+	while(!stack.empty()){
+		os << "</" << stack.back() << ">\n";
+		stack.pop_back();
+	}
+	os << "</body>\n</html>\n";
+	return os.str();
+};
+
+
+string makeAttrHeavyHtmlPage(const std::size_t p_bytes, const unsigned int p_seed){
+	static const char* tags[] = {"a", "img", "input", "div", "td"};
+	static const char* keys[] = {"class", "id", "style", "title", "data-id", "data-role", "aria-label", "onclick", "name", "tabindex"};
+	Random rnd(p_seed);
+	ostringstream os;
+	os << "<html>\n<body>\n";
+	while(static_cast<std::size_t>(os.tellp()) < p_bytes){
+		const char* tag = tags[rnd.next() % 5];
+		os << "<" << tag;
+		if(tag[0] == 'a') os << " href=\"/page/" << rnd.next() << ".html\"";
+		if(tag[0] == 'i') os << " src=\"/img/" << rnd.next() << ".png\" alt='image " << rnd.next() % 100 << "'";
+		const unsigned int n = 4 + rnd.next() % 8;
+		for(unsigned int i = 0; i < n; ++i){
+			os << " " << keys[(i + rnd.next() % 3) % 10];
+			switch(rnd.next() % 3){
+			case 0: os << "=\"v" << rnd.next() << " w\""; break;
+			case 1: os << "='v" << rnd.next() % 1000 << "'"; break;
+			default: os << "=v" << rnd.next() % 10; break;
+			}
+		}
+		os << (tag[0] == 'i' ? "/>" : ">") << "t";
+		if(tag[0] != 'i') os << "</" << tag << ">";
+		os << "\n";
+	}
+	os << "</body>\n</html>\n";
+	return os.str();
+};
+
+string makeScriptHeavyHtmlPage(const std::size_t p_bytes, const unsigned int p_seed){
+	Random rnd(p_seed);
+	ostringstream os;
+	os << "<html>\n<head>\n<style>\n";
+	for(int i = 0; i < 200; ++i) os << ".c" << i << " > a:hover { color: #" << rnd.next() % 1000 << "; }\n";
+	os << "</style>\n</head>\n<body>\n";
+	while(static_cast<std::size_t>(os.tellp()) < p_bytes){
+		os << "<div id=d" << rnd.next() % 1000 << ">text</div>\n<script>\n";
+		const unsigned int n = 20 + rnd.next() % 40;
+		for(unsigned int i = 0; i < n; ++i){
+			switch(rnd.next() % 4){
+			case 0: os << "  for(var i = 0; i < n" << i << "; i++){ if(a[i] <b) b = a[i]; }\n"; break;
+			case 1: os << "  el.innerHTML = '<div class=\"x" << rnd.next() % 100 << "\"><span>' + v + '</span></div>';\n"; break;
+			case 2: os << "  var s" << i << " = \"" << string(20 + rnd.next() % 60, 'x') << "\";\n"; break;
+			default: os << "  // comment <!-- not a comment --> " << rnd.next() << "\n"; break;
+			}
+		}
+		os << "</script>\n";
+	}
+	os << "</body>\n</html>\n";
+	return os.str();
+};
+
+string makeShiftJisHtmlPage(const std::size_t p_bytes, const unsigned int p_seed){
+	//{AeLXgAsAAy[WAłBA\Aj[XAVCAOC
+	static const char* words[] = {
+		"\x93\xFA\x96\x7B\x8C\xEA", "\x83\x65\x83\x4C\x83\x58\x83\x67", "\x93\x8C\x8B\x9E\x93\x73", "\x8C\x9F\x8D\xF5",
+		"\x83\x79\x81\x5B\x83\x57", "\x82\xC5\x82\xB7\x81\x42", "\x82\xF0\x95\x5C\x8E\xA6\x82\xB7\x82\xE9",
+		"\x83\x6A\x83\x85\x81\x5B\x83\x58", "\x93\x56\x8B\x43", "\x83\x8D\x83\x4F\x83\x43\x83\x93"
+	};
+	Random rnd(p_seed);
+	ostringstream os;
+	os << "<!DOCTYPE html>\n<html>\n<head><meta charset=\"Shift_JIS\"><title>bench " << p_seed << "</title></head>\n<body>\n";
+	while(static_cast<std::size_t>(os.tellp()) < p_bytes){
+		os << "<div class=\"c" << rnd.next() % 50 << "\"><a href=\"/news/" << rnd.next() << ".html\">";
+		const unsigned int n = 3 + rnd.next() % 20;
+		for(unsigned int i = 0; i < n; ++i) os << words[rnd.next() % 10];
+		os << "</a></div>\n";
+	}
+	os << "</body>\n</html>\n";
+	return os.str();
+};
+
+std::size_t peakMemoryBytes(){
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS pmc;
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+	return pmc.PeakWorkingSetSize;
+#else
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024;//Linux̒PʂKB
+#endif
+};
+
+void report(const string& p_name, const double p_sec, const std::size_t p_bytes){
+	cout << "  " << std::left << std::setw(36) << p_name << std::right << std::fixed << std::setprecision(4)
+		<< std::setw(10) << p_sec << " sec";
+	if(p_bytes > 0 && p_sec > 0) cout << std::setw(10) << std::setprecision(1) << (p_bytes / p_sec / (1024 * 1024)) << " MB/s";
+	cout << endl;
+};
+
+
+}//namespace bench
+}//namespace nana
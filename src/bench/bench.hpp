@@ -0,0 +1,140 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef __NANA_BENCH_H__
+#define __NANA_BENCH_H__
+
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+
+
+namespace nana{
+namespace bench{
+
+using std::vector;
+using std::string;
+using std::cout;
+using std::endl;
+
+class bench_base;
+
+
+/**
+@brief x`}[N̓o^ƎsB bench_main.cpp gpB
+*/
+class Bench{
+public:
+	typedef bench_base* BenchPtr;
+	///
+	static Bench bench;
+	///
+	static void add(BenchPtr p_bench){ bench.m_vec.push_back(p_bench); };
+	/**
+	o^x`}[NsB
+	@param p_filter [in]Oɂ̕܂ނ̂si󕶎ׂ͂āj
+	*/
+	void exec(const string& p_filter);
+	///R[pXƂĎgpt@Cǉiw肪Ȃꍇ͐HTMLgj
+	void addCorpusFile(const string& p_path);
+	///x`}[NŎgpHTML̈ꗗ
+	const vector<string>& corpus();
+	///R[pX̍voCg
+	const std::size_t corpusBytes();
+private:
+	vector<BenchPtr> m_vec;
+	vector<string> m_corpus;
+};
+
+
+///x`}[N̒`
+class bench_base{
+public:
+	bench_base(const char* p_name): m_name(p_name){ Bench::add(this); };
+	virtual ~bench_base(){};
+	virtual void exec(){};
+	const string m_name;
+};
+
+
+///oߎԂ̌v
+class StopWatch{
+public:
+	StopWatch(): m_start(std::chrono::steady_clock::now()){};
+	void restart(){ m_start = std::chrono::steady_clock::now(); };
+	///oߕb
+	const double sec()const{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+	};
+private:
+	std::chrono::steady_clock::time_point m_start;
+};
+
+
+/**
+x`}[NpHTML𐶐i^OAAsARgAXNvg傫ȃy[WjB
+@param p_bytes [in]悻̃oCg
+@param p_seed [in]̎
+*/
+string makeHtmlPage(const std::size_t p_bytes, const unsigned int p_seed);
+
+/**
+̑^Oō\ꂽHTML𐶐ỉ͂̑x𑪂jB
+@param p_bytes [in]悻̃oCg
+@param p_seed [in]̎
+*/
+string makeAttrHeavyHtmlPage(const std::size_t p_bytes, const unsigned int p_seed);
+
+/**
+CCscriptAstyle唼߂HTML𐶐ieLXgvf̑̑x𑪂jB
+XNvg̒ɂ͔rZq╶񒆂̃^Oi"<div>"j܂߂B
+@param p_bytes [in]悻̃oCg
+@param p_seed [in]̎
+*/
+string makeScriptHeavyHtmlPage(const std::size_t p_bytes, const unsigned int p_seed);
+
+/**
+VtgJIS̓{̃eLXgHTML𐶐iR[h̕ϊ̑x𑪂jB擪 <meta charset="Shift_JIS"> ܂߂B
+@param p_bytes [in]悻̃oCg
+@param p_seed [in]̎
+*/
+string makeShiftJisHtmlPage(const std::size_t p_bytes, const unsigned int p_seed);
+
+///vZX̃gpʂ̍őlioCgB擾łȂꍇ0j
+std::size_t peakMemoryBytes();
+
+///ʂ1so͂
+void report(const string& p_name, const double p_sec, const std::size_t p_bytes);
+
+
+#define BENCH_FUNC(name) class name : public bench_base{ \
+public:\
+	name() : bench_base(#name) {}; \
+	virtual void exec(); \
+	static name jittai; \
+}; \
+name name::jittai; \
+void name::exec()
+
+
+}//namespace bench
+}//namespace nana
+
+
+#endif	//__NANA_BENCH_H__
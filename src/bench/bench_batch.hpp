@@ -0,0 +1,123 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+
+#include "bench.hpp"
+
+
+#include "../html_batch.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::bench;
+
+
+///p[X̃XbhƂ̃X[vbgi1CPŨRA܂2{j
+BENCH_FUNC(bench_HtmlBatchParser_scaling){
+	const vector<string>& corpus = Bench::bench.corpus();
+	//Xbhɍsn悤ɓ͂𑝂₷
+	vector<nana::HtmlBatchInput> inputs;
+	std::size_t bytes = 0;
+	for(int n = 0; n < 8; ++n){
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			inputs.push_back(nana::HtmlBatchInput(*i));
+			bytes += i->size();
+		}
+	}
+	const std::size_t maxThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	cout << "  " << inputs.size() << " documents, " << maxThreads << " hardware threads" << endl;
+	vector<std::size_t> threadCounts;
+	for(std::size_t t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+	threadCounts.push_back(maxThreads);
+	const nana::HtmlDocument::Ownership owners[] = {nana::HtmlDocument::HEAP, nana::HtmlDocument::ARENA};
+	const char* names[] = {"HEAP", "ARENA"};
+	for(int o = 0; o < 2; ++o){
+		double baseSec = 0;
+		for(auto t = threadCounts.begin(); t != threadCounts.end(); ++t){
+			nana::HtmlBatchParser batch(*t, owners[o]);
+			std::atomic<std::size_t> nodeCount(0);
+			StopWatch sw;
+			//p[XĎqm[h𐔂AjiA[i̓XbhƂɎg܂킷j
+			batch.visit(inputs, [&](const std::size_t, const nana::HtmlDocument& p_doc){
+				nodeCount += p_doc.rootNode().childNodeList().size();
+			});
+			const double sec = sw.sec();
+			if(baseSec == 0) baseSec = sec;
+			report(string(names[o]) + " visit " + std::to_string(*t) + " threads", sec, bytes);
+			cout << "    speedup x" << baseSec / sec << endl;
+		}
+		//ʂSĕԂꍇ
+		nana::HtmlBatchParser batch(maxThreads, owners[o]);
+		StopWatch sw;
+		vector<unique_ptr<nana::HtmlDocument>> docs = batch.parse(inputs);
+		report(string(names[o]) + " parse " + std::to_string(maxThreads) + " threads", sw.sec(), bytes);
+	}
+};
+
+
+///g[NnhiRs[Ȃj
+class CountHtmlSaxParserViewHandler :public nana::HtmlSaxParserViewHandler{
+public:
+	CountHtmlSaxParserViewHandler(): m_count(0){};
+	virtual void start(){ m_count = 0; };
+	virtual void text(const nana::StrView&, const long, const long){ ++m_count; };
+	virtual void tag(const nana::StrView&, const long, const long){ ++m_count; };
+	virtual void comment(const nana::StrView&, const long, const long){ ++m_count; };
+	virtual void notEnd(const nana::StrView&, const long, const long){ ++m_count; };
+	long m_count;
+};
+
+
+///1̑傫HTML`Nɕ񑖍̃XbhƂ̃X[vbg
+BENCH_FUNC(bench_HtmlSaxParser_parseParallel){
+	const string str = makeHtmlPage(64 * 1024 * 1024, 11);
+	const std::size_t maxThreads = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+	nana::HtmlSaxParser parser;
+	CountHtmlSaxParserViewHandler handler;
+	StopWatch sw;
+	parser.parse(str.data(), str.size(), handler);
+	const double baseSec = sw.sec();
+	const long count = handler.m_count;
+	report("parse", baseSec, str.size());
+	for(std::size_t t = 2; t <= maxThreads; t *= 2){
+		nana::WorkStealingPool pool(t);
+		sw.restart();
+		parser.parseParallel(str.data(), str.size(), handler, pool);
+		const double sec = sw.sec();
+		report("parseParallel " + std::to_string(t) + " threads", sec, str.size());
+		cout << "    speedup x" << baseSec / sec << (handler.m_count == count ? "" : " (token count differs!)") << endl;
+	}
+	//m[h̍쐬܂Łinh͌ĂяõXbhŏԂɌĂ΂j
+	nana::DocumentHtmlSaxParserViewHandler docHandler(nana::HtmlDocument::ARENA);
+	sw.restart();
+	parser.parse(str.data(), str.size(), docHandler);
+	docHandler.result();
+	report("parse document", sw.sec(), str.size());
+	nana::WorkStealingPool pool(maxThreads);
+	sw.restart();
+	parser.parseParallel(str.data(), str.size(), docHandler, pool);
+	docHandler.result();
+	report("parseParallel document " + std::to_string(maxThreads) + " threads", sw.sec(), str.size());
+};
+
+
+} //namespace
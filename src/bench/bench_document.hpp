@@ -0,0 +1,709 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <map>
+#include <cstdio>
+
+
+#include "bench.hpp"
+
+
+#include "../html_element.hpp"
+#include "../html_analysys.hpp"
+#include "../html_entity.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::bench;
+
+
+///HtmlDocument ̃̊mە@Ƃ́A쐬ip[X{m[h́jƔj̎
+BENCH_FUNC(bench_HtmlDocument_ownership){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const nana::HtmlDocument::Ownership owners[] = {nana::HtmlDocument::HEAP, nana::HtmlDocument::ARENA};
+	const char* names[] = {"HEAP", "ARENA"};
+	nana::HtmlSaxParser parser;
+	for(int o = 0; o < 2; ++o){
+		const string name(names[o]);
+		double buildSec = 0, teardownSec = 0, viewBuildSec = 0, viewTeardownSec = 0;
+		//Rs[nh
+		nana::DocumentHtmlSaxParserHandler handler(owners[o]);
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			StopWatch sw;
+			parser.parse(i->data(), i->size(), handler);
+			unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+			buildSec += sw.sec();
+			sw.restart();
+			docUptr.reset();
+			teardownSec += sw.sec();
+		}
+		report(name + " build", buildSec, bytes);
+		report(name + " teardown", teardownSec, bytes);
+		//Rs[Ȃnh
+		nana::DocumentHtmlSaxParserViewHandler viewHandler(owners[o]);
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			StopWatch sw;
+			parser.parse(i->data(), i->size(), viewHandler);
+			unique_ptr<nana::HtmlDocument> docUptr = viewHandler.result();
+			viewBuildSec += sw.sec();
+			sw.restart();
+			docUptr.reset();
+			viewTeardownSec += sw.sec();
+		}
+		report(name + " view build", viewBuildSec, bytes);
+		report(name + " view teardown", viewTeardownSec, bytes);
+	}
+};
+
+
+///󔒂̃eLXg̈Ƃ́A HtmlDocument ̍쐬ԁA^O̐AA[iɊ蓖ĂoCg
+BENCH_FUNC(bench_HtmlDocument_whitespace){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const nana::HtmlDocument::Whitespace modes[] = {nana::HtmlDocument::KEEP_WHITESPACE, nana::HtmlDocument::COLLAPSE_WHITESPACE, nana::HtmlDocument::DROP_WHITESPACE};
+	const char* names[] = {"KEEP", "COLLAPSE", "DROP"};
+	nana::HtmlSaxParser parser;
+	for(int m = 0; m < 3; ++m){
+		const string name(names[m]);
+		double buildSec = 0;
+		std::size_t partCnt = 0, arenaBytes = 0;
+		nana::DocumentHtmlSaxParserViewHandler handler(nana::HtmlDocument::ARENA);
+		handler.setWhitespace(modes[m]);
+		nana::SimpleHtmlSaxParserViewHandler partsHandler(nana::HtmlDocument::ARENA);
+		partsHandler.setWhitespace(modes[m]);
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			StopWatch sw;
+			parser.parse(i->data(), i->size(), handler);
+			unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+			buildSec += sw.sec();
+			partCnt += docUptr->size();
+			docUptr.reset();
+			//p[c쐬ăA[i̎gpʂ𐔂
+			parser.parse(i->data(), i->size(), partsHandler);
+			unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = partsHandler.result();
+			unique_ptr<nana::MonotonicArena> arenaUptr = partsHandler.releaseArena();
+			arenaBytes += arenaUptr->allocatedBytes();
+			partsUptr.reset();
+		}
+		report(name + " view build", buildSec, bytes);
+		cout << "  parts " << partCnt << ", arena " << arenaBytes / (1024 * 1024) << " MB" << endl;
+	}
+};
+
+
+///HtmlPart ̔zƁA񂲂Ƃ̔z̕\i HtmlPartTable j́A쐬ԁAgpASẴ^O𑖍鎞
+BENCH_FUNC(bench_HtmlPartTable){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const int SCANS = 10;
+	const nana::Atom divAtom = nana::atom::intern("div");
+	nana::HtmlSaxParser parser;
+	//쐬
+	vector<unique_ptr<nana::HtmlDocument::HtmlPartUptrs> > partsList;
+	vector<unique_ptr<nana::MonotonicArena> > arenas;
+	std::size_t partsMemory = 0;
+	nana::SimpleHtmlSaxParserViewHandler partsHandler(nana::HtmlDocument::ARENA);
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), partsHandler);
+		partsList.push_back(partsHandler.result());
+		arenas.push_back(partsHandler.releaseArena());
+	}
+	report("HtmlPart (ARENA) build", sw.sec(), bytes);
+	for(std::size_t i = 0; i < partsList.size(); ++i){
+		partsMemory += arenas[i]->allocatedBytes() + partsList[i]->capacity() * sizeof(nana::HtmlDocument::HtmlPartUptr);
+	}
+	vector<unique_ptr<nana::HtmlPartTable> > tables;
+	std::size_t tableMemory = 0;
+	nana::HtmlPartTableViewHandler tableHandler((nana::StrView()));
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		tableHandler.setSource(nana::StrView(*i));
+		parser.parse(i->data(), i->size(), tableHandler);
+		tables.push_back(tableHandler.result());
+	}
+	report("HtmlPartTable build", sw.sec(), bytes);
+	for(auto t = tables.begin(); t != tables.end(); ++t) tableMemory += (*t)->memoryBytes();
+	cout << "  memory HtmlPart " << partsMemory / (1024 * 1024) << " MB, HtmlPartTable " << tableMemory / (1024 * 1024) << " MB" << endl;
+	//div̊Jn^O̐ƁAeLXg̃oCg𐔂
+	std::size_t divCnt = 0, textBytes = 0;
+	sw.restart();
+	for(int n = 0; n < SCANS; ++n){
+		for(auto p = partsList.begin(); p != partsList.end(); ++p){
+			for(auto i = (*p)->begin(); i != (*p)->end(); ++i){
+				const nana::HtmlPart& part = **i;
+				if(part.type() == nana::HtmlPart::TAG){
+					if(part.tagAtom() == divAtom && !part.isEndTag()) ++divCnt;
+				} else if(part.type() == nana::HtmlPart::TEXT){
+					textBytes += part.view().size();
+				}
+			}
+		}
+	}
+	report("HtmlPart scan x" + std::to_string(SCANS), sw.sec(), bytes);
+	cout << "  div " << divCnt << ", text " << textBytes << endl;
+	divCnt = textBytes = 0;
+	sw.restart();
+	for(int n = 0; n < SCANS; ++n){
+		for(auto t = tables.begin(); t != tables.end(); ++t){
+			for(const nana::HtmlPartRef ref : **t){
+				if(ref.type() == nana::HtmlPart::TAG){
+					if(ref.tagAtom() == divAtom && !ref.isEndTag()) ++divCnt;
+				} else if(ref.type() == nana::HtmlPart::TEXT){
+					textBytes += ref.view().size();
+				}
+			}
+		}
+	}
+	report("HtmlPartRef scan x" + std::to_string(SCANS), sw.sec(), bytes);
+	cout << "  div " << divCnt << ", text " << textBytes << endl;
+	divCnt = textBytes = 0;
+	sw.restart();
+	for(int n = 0; n < SCANS; ++n){
+		for(auto t = tables.begin(); t != tables.end(); ++t){
+			const nana::HtmlPartTable& table = **t;
+			for(std::size_t i = 0; i < table.size(); ++i){
+				divCnt += (table.tagAtom(i) == divAtom && !table.isEndTag(i));
+				textBytes += (table.type(i) == nana::HtmlPart::TEXT) ? table.view(i).size() : 0;
+			}
+		}
+	}
+	report("HtmlPartTable column scan x" + std::to_string(SCANS), sw.sec(), bytes);
+	cout << "  div " << divCnt << ", text " << textBytes << endl;
+	//A[i̓^Oɔj
+	partsList.clear();
+};
+
+
+///eLXgƑ̒l̕QƂAgꂼWJꍇi3jƁA HtmlPart ɓWJĕێꍇ̔r
+BENCH_FUNC(bench_HtmlPart_decoded){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const int USERS = 3;
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserViewHandler handler;
+	vector<unique_ptr<nana::HtmlDocument> > docs;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		docs.push_back(handler.result());
+	}
+	//gꂼWJ
+	std::size_t decodedBytes = 0, cachedBytes = 0;
+	string buf;
+	StopWatch sw;
+	for(int u = 0; u < USERS; ++u){
+		for(auto d = docs.begin(); d != docs.end(); ++d){
+			for(auto i = (*d)->begin(); i != (*d)->end(); ++i){
+				const nana::HtmlPart& part = **i;
+				if(part.type() == nana::HtmlPart::TEXT){
+					buf.clear();
+					nana::entity::decode(part.view().data(), part.view().data() + part.view().size(), buf, false);
+					decodedBytes += buf.size();
+				} else if(part.type() == nana::HtmlPart::TAG){
+					const nana::HtmlAttrs& attrs = part.attrs();
+					for(auto a = attrs.begin(); a != attrs.end(); ++a) decodedBytes += nana::entity::decode(a->value, true).size();
+				}
+			}
+		}
+	}
+	report("decode by each user x" + std::to_string(USERS), sw.sec(), bytes);
+	//ɓWJĕێ
+	sw.restart();
+	for(int u = 0; u < USERS; ++u){
+		for(auto d = docs.begin(); d != docs.end(); ++d){
+			for(auto i = (*d)->begin(); i != (*d)->end(); ++i){
+				const nana::HtmlPart& part = **i;
+				cachedBytes += part.decoded().size();
+				const nana::HtmlAttrs& attrs = part.decodedAttrs();
+				for(auto a = attrs.begin(); a != attrs.end(); ++a) cachedBytes += a->value.size();
+			}
+		}
+	}
+	report("decoded() cached x" + std::to_string(USERS), sw.sec(), bytes);
+	if(decodedBytes == 0 || cachedBytes == 0) cout << "  (empty)" << endl;
+};
+
+
+///p[XɃm[h̊Kw쐬ꍇƁA^Oz쐬Ă͂ꍇ HtmlDocument ̍쐬
+BENCH_FUNC(bench_HtmlDocument_streaming){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	const char* names[] = {"HIERARCHY_MATCH", "SAME_TAG_MATCH"};
+	nana::HtmlSaxParser parser;
+	for(int p = 0; p < 2; ++p){
+		const string name(names[p]);
+		double twoPassSec = 0, streamingSec = 0;
+		//^Oz쐬Ă͂
+		nana::SimpleHtmlSaxParserViewHandler simpleHandler;
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			StopWatch sw;
+			parser.parse(i->data(), i->size(), simpleHandler);
+			unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = simpleHandler.result();
+			nana::HtmlNode::NodeUptr rootUptr(new nana::HtmlNode(nullptr, nullptr, nullptr));
+			if(policies[p] == nana::HtmlNodeBuilder::HIERARCHY_MATCH){
+				nana::analyzeHtmlNode(*rootUptr, *partsUptr);
+			} else{
+				nana::analyzeHtmlNodeBySameTagMatch(*rootUptr, *partsUptr);
+			}
+			nana::HtmlDocument doc(move(partsUptr), move(rootUptr));
+			twoPassSec += sw.sec();
+		}
+		//p[Xɍ쐬
+		nana::DocumentHtmlSaxParserViewHandler handler(nana::HtmlDocument::HEAP, policies[p]);
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			StopWatch sw;
+			parser.parse(i->data(), i->size(), handler);
+			unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+			streamingSec += sw.sec();
+		}
+		report(name + " two-pass", twoPassSec, bytes);
+		report(name + " streaming", streamingSec, bytes);
+	}
+};
+
+
+///쐬ς݂̃^Õm[h͂ƁAm[h̃`FbNiANZTApXj̎
+BENCH_FUNC(bench_HtmlNode_lint){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	vector<unique_ptr<nana::HtmlDocument::HtmlPartUptrs>> partsList;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		nana::SimpleHtmlSaxParserViewHandler handler;
+		parser.parse(i->data(), i->size(), handler);
+		partsList.push_back(handler.result());
+	}
+	//m[h
+	vector<unique_ptr<nana::HtmlNode>> roots;
+	StopWatch sw;
+	for(auto i = partsList.begin(); i != partsList.end(); ++i){
+		roots.push_back(unique_ptr<nana::HtmlNode>(new nana::HtmlNode(nullptr, nullptr, nullptr)));
+		nana::analyzeHtmlNode(*roots.back(), **i);
+	}
+	report("analyzeHtmlNode", sw.sec(), bytes);
+	sw.restart();
+	for(auto i = partsList.begin(); i != partsList.end(); ++i){
+		nana::HtmlNode root(nullptr, nullptr, nullptr);
+		nana::analyzeHtmlNodeBySameTagMatch(root, **i);
+	}
+	report("analyzeHtmlNodeBySameTagMatch", sw.sec(), bytes);
+	//ANZT
+	std::size_t found = 0;
+	sw.restart();
+	for(auto i = roots.begin(); i != roots.end(); ++i){
+		nana::CompositeAccessor acc;
+		acc.add(new nana::EndTagAccessor).add(new nana::DeprecatedInHtml5Accessor).add(new nana::ImgAltAccessor);
+		nana::HtmlNodeVisitor vis;
+		vis.access(**i, acc);
+		found += acc.accessor<nana::EndTagAccessor>(0).nonClosedResult()->size();
+		found += acc.accessor<nana::DeprecatedInHtml5Accessor>(1).result()->size();
+		found += acc.accessor<nana::ImgAltAccessor>(2).result()->size();
+	}
+	report("accessors (end tag, deprecated, img)", sw.sec(), bytes);
+	//pX
+	sw.restart();
+	for(auto i = roots.begin(); i != roots.end(); ++i){
+		nana::path::HtmlPathExecutor executor;
+		executor.slash2().tag("div").tag("a").predAttr("href", "*.html");
+		found += executor.exec(**i)->size();
+	}
+	report("path //div/a[@href]", sw.sec(), bytes);
+	if(found == 0) cout << "  (not found)" << endl;
+};
+
+
+///200̃pXSẴy[WɎsi HtmlPathExecutor ƁARpC HtmlPathPlan j
+BENCH_FUNC(bench_HtmlPathPlan){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	vector<unique_ptr<nana::HtmlDocument>> docs;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		nana::DocumentHtmlSaxParserViewHandler handler;
+		parser.parse(i->data(), i->size(), handler);
+		docs.push_back(handler.result());
+	}
+	//pXiw HtmlPathExecutor  HtmlPathPlan j
+	static const char* tags[] = {"div", "span", "a", "p", "li", "td", "font", "b"};
+	vector<unique_ptr<nana::path::HtmlPathExecutor>> executors;
+	vector<unique_ptr<nana::path::HtmlPathPlan>> plans;
+	for(int n = 0; executors.size() < 200; ++n){
+		const string t = tags[n % 8], u = tags[(n / 8) % 8], cls = "c" + std::to_string(n % 50) + "*";
+		unique_ptr<nana::path::HtmlPathExecutor> executor(new nana::path::HtmlPathExecutor);
+		string path;
+		switch((n / 64) % 4){
+		case 0:
+			path = "//" + t + "/" + u;
+			executor->slash2().tag(t).tag(u);
+			break;
+		case 1:
+			path = "//" + t + "[@class='" + cls + "']/" + u;
+			executor->slash2().tag(t).predAttr("class", cls).tag(u);
+			break;
+		case 2:
+			path = "//" + t + "//" + u + "[2]";
+			executor->slash2().tag(t).slash2().tag(u).predPos(1);
+			break;
+		default:
+			path = "/html/body/" + t + "/" + u + "[@data-x=" + std::to_string(n % 10) + "]";
+			executor->tag("html").tag("body").tag(t).tag(u).predAttr("data-x", std::to_string(n % 10));
+			break;
+		}
+		executors.push_back(move(executor));
+		plans.push_back(unique_ptr<nana::path::HtmlPathPlan>(new nana::path::HtmlPathPlan(path)));
+	}
+	std::size_t found = 0, planFound = 0, reusedFound = 0;
+	StopWatch sw;
+	for(auto d = docs.begin(); d != docs.end(); ++d){
+		for(auto e = executors.begin(); e != executors.end(); ++e) found += (*e)->exec((*d)->rootNode())->size();
+	}
+	report("HtmlPathExecutor x200", sw.sec(), bytes);
+	sw.restart();
+	for(auto d = docs.begin(); d != docs.end(); ++d){
+		for(auto p = plans.begin(); p != plans.end(); ++p) planFound += (*p)->exec((*d)->rootNode())->size();
+	}
+	report("HtmlPathPlan x200", sw.sec(), bytes);
+	//Ɨ̈ƌʂ̔zg
+	nana::path::HtmlPathPlan::Workspace workspace;
+	nana::path::HtmlPathPlan::HtmlNodePtrs result;
+	sw.restart();
+	for(auto d = docs.begin(); d != docs.end(); ++d){
+		for(auto p = plans.begin(); p != plans.end(); ++p){
+			result.clear();
+			(*p)->exec((*d)->rootNode(), result, workspace);
+			reusedFound += result.size();
+		}
+	}
+	report("HtmlPathPlan x200 (workspace)", sw.sec(), bytes);
+	cout << "  found " << found << " / " << planFound << " / " << reusedFound << endl;
+};
+
+
+/**
+//title  /html/head/script oB؂ĂsꍇƁAp[Xɕ]ꍇiŌ܂ŁA~߂j
+*/
+BENCH_FUNC(bench_HtmlPathStreamHandler){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	const nana::path::HtmlPathPlan title("//title"), script("/html/head/script");
+	std::size_t found = 0;
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		nana::DocumentHtmlSaxParserHandler handler;
+		parser.parse(i->data(), i->size(), handler);
+		unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+		found += title.exec(docUptr->rootNode())->size() + script.exec(docUptr->rootNode())->size();
+	}
+	report("tree + HtmlPathPlan", sw.sec(), bytes);
+	for(int limit = 0; limit < 2; ++limit){
+		std::size_t streamFound = 0;
+		nana::path::HtmlPathStreamHandler handler;
+		handler.addQuery(title, limit);
+		handler.addQuery(script, limit);
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			handler.parse(parser, i->data(), i->size());
+			streamFound += handler.matches(0).size() + handler.matches(1).size();
+		}
+		report(limit == 0 ? "HtmlPathStreamHandler" : "HtmlPathStreamHandler (stop)", sw.sec(), bytes);
+		cout << "  found " << found << " / " << streamFound << endl;
+	}
+};
+
+
+/////aA//imgA//*[@id='x'] [gm[hHꍇƁAgꍇi̍쐬Ԃ͕ʂɑj
+BENCH_FUNC(bench_HtmlNodeIndex){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	vector<unique_ptr<nana::HtmlDocument>> docs;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		nana::DocumentHtmlSaxParserViewHandler handler;
+		parser.parse(i->data(), i->size(), handler);
+		docs.push_back(handler.result());
+	}
+	//y[W̓rɂidT
+	const string& page = corpus.front();
+	const std::size_t idPos = page.find("id='", page.size() / 2) + 4;
+	const string id = page.substr(idPos, page.find('\'', idPos) - idPos);
+	nana::path::HtmlPathExecutor anchors, images, byId;
+	anchors.slash2().tag("a");
+	images.slash2().tag("img");
+	byId.slash2().tag("*").predAttr("id", id);
+	nana::path::HtmlPathExecutor* executors[] = {&anchors, &images, &byId};
+	const char* names[] = {"//a", "//img", "//*[@id='x']"};
+	StopWatch sw;
+	for(auto d = docs.begin(); d != docs.end(); ++d) (*d)->index();
+	report("HtmlDocument::index()", sw.sec(), bytes);
+	for(int e = 0; e < 3; ++e){
+		std::size_t found = 0, indexFound = 0;
+		sw.restart();
+		for(auto d = docs.begin(); d != docs.end(); ++d) found += executors[e]->exec((*d)->rootNode())->size();
+		report(string(names[e]) + " from root", sw.sec(), bytes);
+		sw.restart();
+		for(auto d = docs.begin(); d != docs.end(); ++d) indexFound += executors[e]->exec(**d)->size();
+		report(string(names[e]) + " by index", sw.sec(), bytes);
+		cout << "  found " << found << " / " << indexFound << endl;
+	}
+};
+
+
+///gƔz̃m[ho^ς݂mapŏdďW߂iȑO DescendantsHtmlPath Brpj
+void mapDescendants(nana::path::HtmlPath::HtmlNodePtrs& p_ret, const nana::path::HtmlPath::HtmlNodePtrs& p_nodePtrs, std::map<const nana::HtmlNode*, int>& p_regMap){
+	for(auto i = p_nodePtrs.begin(); i != p_nodePtrs.end(); ++i){
+		if(p_regMap.find(*i) == p_regMap.end()){
+			p_ret.push_back(*i);
+			p_regMap[*i] = 1;
+		}
+		if((*i)->childNodeList().empty()) continue;
+		unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> childrenUptr(new nana::path::HtmlPath::HtmlNodePtrs);
+		for(auto j = (*i)->begin(); j != (*i)->end(); ++j) childrenUptr->push_back(j->get());
+		mapDescendants(p_ret, *childrenUptr, p_regMap);
+	}
+}
+
+/**
+qm[h̒oi//jBs̔ԍŒHꍇƁAȑOmapŏdꍇ
+*/
+BENCH_FUNC(bench_DescendantsHtmlPath){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	vector<unique_ptr<nana::HtmlDocument>> docs;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		nana::DocumentHtmlSaxParserViewHandler handler;
+		parser.parse(i->data(), i->size(), handler);
+		docs.push_back(handler.result());
+	}
+	//[gAƏdȂ̂́iSĂdiv̔zj
+	nana::path::HtmlPathExecutor divs;
+	divs.slash2().tag("div");
+	for(int n = 0; n < 2; ++n){
+		const string name = (n == 0) ? "// from root" : "// from every div";
+		vector<nana::path::HtmlPath::HtmlNodePtrs> inputs;
+		for(auto d = docs.begin(); d != docs.end(); ++d){
+			if(n == 0) inputs.push_back(nana::path::HtmlPath::HtmlNodePtrs(1, &(*d)->rootNode()));
+			else inputs.push_back(*divs.exec((*d)->rootNode()));
+		}
+		std::size_t found = 0, mapFound = 0;
+		StopWatch sw;
+		for(auto i = inputs.begin(); i != inputs.end(); ++i){
+			nana::path::DescendantsHtmlPath path;
+			found += path.filter(*i)->size();
+		}
+		report(name + " by order", sw.sec(), bytes);
+		sw.restart();
+		for(auto i = inputs.begin(); i != inputs.end(); ++i){
+			nana::path::HtmlPath::HtmlNodePtrs result;
+			std::map<const nana::HtmlNode*, int> regMap;
+			mapDescendants(result, *i, regMap);
+			mapFound += result.size();
+		}
+		report(name + " by map", sw.sec(), bytes);
+		cout << "  found " << found << " / " << mapFound << endl;
+	}
+};
+
+
+///ċAŏƍ郏ChJ[hiȑO wildcardMatch() Brpj
+const bool recursiveWildcardMatch(const char *ptn, const char *str){
+	switch(*ptn){
+	case '\0':
+		return '\0' == *str;
+	case '*':
+		return recursiveWildcardMatch(ptn + 1, str) || (('\0' != *str) && recursiveWildcardMatch(ptn, str + 1));
+	case '?':
+		return ('\0' != *str) && recursiveWildcardMatch(ptn + 1, str + 1);
+	default:
+		if(*ptn == '\\') ++ptn;
+		if(*ptn == '\0' && *str != '\0') return false;
+		if(*ptn == '\0' && *str == '\0') return true;
+		return ((unsigned char)*ptn == (unsigned char)*str) && recursiveWildcardMatch(ptn + 1, str + 1);
+	}
+}
+
+///*𑽂܂ރp^[̏ƍi}b`ȂjƁÃp^[ł̑̌
+BENCH_FUNC(bench_wildcardMatch_pathological){
+	const string ptn("*a*a*a*a*a*a*b");
+	const std::size_t lengths[] = {20, 30, 40};
+	for(int i = 0; i < 3; ++i){
+		const string str(lengths[i], 'a');
+		StopWatch sw;
+		const bool recursive = recursiveWildcardMatch(ptn.c_str(), str.c_str());
+		report("recursive " + ptn + " len " + std::to_string(lengths[i]), sw.sec(), 0);
+		sw.restart();
+		bool linear = false;
+		for(int n = 0; n < 1000; ++n) linear = nana::wildcardMatch(ptn.c_str(), str.c_str());
+		report("wildcardMatch x1000 len " + std::to_string(lengths[i]), sw.sec(), 0);
+		if(recursive != linear) cout << "  (result differs)" << endl;
+	}
+	//class񂾃y[W
+	string page("<html><body>\n");
+	for(int i = 0; i < 2000; ++i) page += "<div class='" + string(200, 'a') + "'>x</div>\n";
+	page += "</body></html>";
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler handler;
+	parser.parse(page.data(), page.size(), handler);
+	unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+	nana::path::HtmlPathExecutor executor;
+	executor.slash2().tag("div").predAttr("class", ptn);
+	StopWatch sw;
+	const std::size_t found = executor.exec(docUptr->rootNode())->size();
+	report("//div[@class='" + ptn + "'] 2000 tags", sw.sec(), page.size());
+	if(found != 0) cout << "  (unexpected match)" << endl;
+};
+
+
+///100Kw̓q̃m[h́iċAȂj̎Ԃƃgp
+BENCH_FUNC(bench_HtmlNodeBuilder_deep){
+	const std::size_t depth = 1000000;
+	string str;
+	str.reserve(depth * 6);
+	for(std::size_t i = 0; i < depth / 2; ++i) str += "<div><font>";
+	nana::HtmlSaxParser parser;
+	const char* names[] = {"HIERARCHY_MATCH", "SAME_TAG_MATCH"};
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		const std::size_t memStart = peakMemoryBytes();
+		StopWatch sw;
+		nana::SimpleHtmlSaxParserViewHandler handler(nana::HtmlDocument::ARENA);
+		parser.parse(str.data(), str.size(), handler);
+		unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+		unique_ptr<nana::MonotonicArena> arenaUptr = handler.releaseArena();
+		report(string(names[p]) + " parse", sw.sec(), str.size());
+		sw.restart();
+		unique_ptr<nana::HtmlNode> rootUptr(new nana::HtmlNode(nullptr, nullptr, nullptr));
+		std::size_t builtDepth = 0;
+		{
+			//r_[͔jɊJĂm[h̂ŁAm[hɔj
+			nana::HtmlNodeBuilder builder(*rootUptr, policies[p]);
+			for(auto i = partsUptr->begin(); i != partsUptr->end(); ++i) builder.push(**i);
+			builtDepth = builder.depth();
+		}
+		report(string(names[p]) + " build", sw.sec(), str.size());
+		sw.restart();
+		rootUptr.reset();
+		report(string(names[p]) + " teardown", sw.sec(), str.size());
+		partsUptr.reset();
+		cout << "  depth " << builtDepth << ", peak memory +" << (peakMemoryBytes() - memStart) / (1024 * 1024) << " MB" << endl;
+	}
+};
+
+
+///t@C HtmlDocument ̍쐬iifstreamƃ}bvjBt@C̓y[WLbVɂԂőB
+BENCH_FUNC(bench_parseHtmlFile){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	vector<string> paths;
+	for(std::size_t i = 0; i < corpus.size(); ++i){
+		paths.push_back("bench_parse_html_file_" + std::to_string(i) + ".tmp");
+		std::ofstream ofs(paths.back().c_str(), std::ios::binary);
+		ofs << corpus[i];
+	}
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler handler;
+	nana::DocumentHtmlSaxParserViewHandler viewHandler;
+	StopWatch sw;
+	//ifstreamubNPʂœǂݍ
+	for(auto i = paths.begin(); i != paths.end(); ++i){
+		std::ifstream ifs(i->c_str(), std::ios::binary);
+		parser.parseBuffered(ifs, handler);
+		unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+	}
+	report("ifstream parseBuffered", sw.sec(), bytes);
+	//ifstream當ɓǂݍ݁AQƂ
+	sw.restart();
+	for(auto i = paths.begin(); i != paths.end(); ++i){
+		std::ifstream ifs(i->c_str(), std::ios::binary);
+		std::shared_ptr<string> strSptr(new string);
+		std::ostringstream oss;
+		oss << ifs.rdbuf();
+		*strSptr = oss.str();
+		parser.parse(strSptr->data(), strSptr->size(), viewHandler);
+		unique_ptr<nana::HtmlDocument> docUptr = viewHandler.result();
+		docUptr->holdSource(strSptr);
+	}
+	report("ifstream read + view", sw.sec(), bytes);
+	//}bvĕRs[
+	sw.restart();
+	for(auto i = paths.begin(); i != paths.end(); ++i){
+		unique_ptr<nana::HtmlDocument> docUptr = nana::parseHtmlFile(*i, handler);
+	}
+	report("mmap copy", sw.sec(), bytes);
+	//}bvă}bsOQƂ
+	const nana::MappedFile::Advice advices[] = {nana::MappedFile::NORMAL, nana::MappedFile::SEQUENTIAL, nana::MappedFile::WILLNEED};
+	const char* names[] = {"mmap view NORMAL", "mmap view SEQUENTIAL", "mmap view WILLNEED"};
+	for(int a = 0; a < 3; ++a){
+		sw.restart();
+		for(auto i = paths.begin(); i != paths.end(); ++i){
+			unique_ptr<nana::HtmlDocument> docUptr = nana::parseHtmlFile(*i, viewHandler, advices[a]);
+		}
+		report(names[a], sw.sec(), bytes);
+	}
+	for(auto i = paths.begin(); i != paths.end(); ++i) std::remove(i->c_str());
+};
+
+
+///1̕ҏW̔fi HtmlDocumentEditor ƁAŜ̃p[XjBҏWƂ̎Ԃ𑪂B
+BENCH_FUNC(bench_HtmlDocumentEditor_edit){
+	const std::size_t editCnt = 200;
+	const std::size_t sizes[] = {1024 * 1024, 4 * 1024 * 1024};
+	for(int s = 0; s < 2; ++s){
+		const string page = makeHtmlPage(sizes[s], 41 + s);
+		//eLXg̒̕ҏWʒuiP̐擪j
+		vector<std::size_t> positions;
+		for(std::size_t i = 0; i < editCnt; ++i){
+			const std::size_t pos = page.find(" ipsum", page.size() / editCnt * i);
+			positions.push_back(pos == string::npos ? page.size() / 2 : pos + 1);
+		}
+		cout << "  page " << page.size() / 1024 << " KB, " << editCnt << " edits" << endl;
+		nana::HtmlDocumentEditor editor(page);
+		StopWatch sw;
+		std::size_t fullCnt = 0, rebuiltParts = 0;
+		for(std::size_t i = 0; i < editCnt; ++i){
+			editor.replace(positions[i] + i, 0, "x");
+			if(editor.lastStats().fullRebuild) ++fullCnt;
+			rebuiltParts += editor.lastStats().rebuiltParts;
+		}
+		const double editorSec = sw.sec();
+		report("HtmlDocumentEditor::replace", editorSec, 0);
+		cout << "  " << editorSec / editCnt * 1e6 << " usec/edit, full rebuild " << fullCnt
+			<< ", rebuilt parts " << rebuiltParts / editCnt << "/edit of " << editor.document().size() << endl;
+		//ҏWāAŜp[X
+		nana::HtmlSaxParser parser;
+		nana::DocumentHtmlSaxParserHandler handler;
+		string source(page);
+		sw.restart();
+		for(std::size_t i = 0; i < editCnt; ++i){
+			source.insert(positions[i] + i, "x");
+			parser.parse(source.data(), source.size(), handler);
+			unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+		}
+		const double fullSec = sw.sec();
+		report("full reparse", fullSec, 0);
+		cout << "  " << fullSec / editCnt * 1e6 << " usec/edit" << endl;
+	}
+};
+
+
+} //namespace
@@ -0,0 +1,349 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <sstream>
+
+
+#include "bench.hpp"
+
+
+#include "../html_element.hpp"
+#include "../html_scan.hpp"
+#include "../html_charset.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::bench;
+
+
+///g[Nnhip[T̂̑x𑪂j
+class CountHtmlSaxParserHandler :public nana::HtmlSaxParserHandler{
+public:
+	CountHtmlSaxParserHandler(): m_count(0){};
+	virtual void start(){};
+	virtual void text(const std::string& p_str, const long p_line, const long p_pos){ ++m_count; };
+	virtual void tag(const std::string& p_str, const long p_line, const long p_pos){ ++m_count; };
+	virtual void comment(const std::string& p_str, const long p_line, const long p_pos){ ++m_count; };
+	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos){ ++m_count; };
+	long m_count;
+};
+
+
+///1̃p[XƃubNPʂ̃p[X̃X[vbg
+BENCH_FUNC(bench_HtmlSaxParser_throughput){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	CountHtmlSaxParserHandler handler;
+	StopWatch sw;
+	//1iistream::getj
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		istringstream is(*i);
+		parser.parse(is, handler);
+	}
+	report("parse(istream&) per-char", sw.sec(), bytes);
+	const long countChar = handler.m_count;
+	//ubNPʁiistream܂Ƃ߂ēǂݍ݁j
+	handler.m_count = 0;
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		istringstream is(*i);
+		parser.parseBuffered(is, handler);
+	}
+	report("parseBuffered(istream&)", sw.sec(), bytes);
+	//ubNPʁiHTMLj
+	handler.m_count = 0;
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+	}
+	report("parse(const char*, size)", sw.sec(), bytes);
+	if(countChar != handler.m_count) cout << "  token count mismatch!! " << countChar << " != " << handler.m_count << endl;
+};
+
+
+///</head>ő̒~vnhiwb_̃^f[^ozj
+class HeadOnlyHtmlSaxParserHandler :public nana::SimpleHtmlSaxParserHandler{
+public:
+	virtual void tag(const std::string& p_str, const long p_line, const long p_pos){
+		nana::SimpleHtmlSaxParserHandler::tag(p_str, p_line, p_pos);
+		if(p_str == "</head>") requestStop();
+	};
+};
+
+///wb_KvȏꍇɁAŌ܂Ńp[Xꍇ</head>Ŏ~߂ꍇ
+BENCH_FUNC(bench_HtmlSaxParser_stop){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler handler;
+	HeadOnlyHtmlSaxParserHandler headHandler;
+	std::size_t parts = 0, headParts = 0;
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		parts += handler.result()->size();
+	}
+	report("parse to the end", sw.sec(), bytes);
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), headHandler);
+		headParts += headHandler.result()->size();
+	}
+	report("stop at </head>", sw.sec(), bytes);
+	cout << "  parts " << parts << " / " << headParts << endl;
+};
+
+
+///XNvg̑HTMLŁAscriptAstyle̓e^OƂđꍇƐeLXgƂēǂݔ΂ꍇׂ
+BENCH_FUNC(bench_HtmlSaxParser_rawText){
+	vector<string> corpus;
+	std::size_t bytes = 0;
+	for(unsigned int i = 0; i < 4; ++i){
+		corpus.push_back(makeScriptHeavyHtmlPage(4 * 1024 * 1024, i + 1));
+		bytes += corpus.back().size();
+	}
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserViewHandler handler;
+	for(int raw = 0; raw < 2; ++raw){
+		parser.setRawTextElements(raw != 0);
+		const string name(raw != 0 ? "raw text" : "markup");
+		CountHtmlSaxParserHandler countHandler;
+		StopWatch sw;
+		for(auto i = corpus.begin(); i != corpus.end(); ++i) parser.parse(i->data(), i->size(), countHandler);
+		report(name + " parse(const char*, size)", sw.sec(), bytes);
+		std::size_t parts = 0;
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			parser.parse(i->data(), i->size(), handler);
+			parts += handler.result()->size();
+		}
+		report(name + " parse + parseTag", sw.sec(), bytes);
+		cout << "  tokens " << countHandler.m_count << ", parts " << parts << endl;
+	}
+};
+
+
+///vbV^̃p[Tɕēnꍇ̃X[vbgilbg[NMTCYƂɓnzj
+BENCH_FUNC(bench_HtmlPushParser_throughput){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	CountHtmlSaxParserHandler handler;
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+	}
+	report("parse(const char*, size)", sw.sec(), bytes);
+	const long count = handler.m_count;
+	const std::size_t feedSizes[] = {1460, 16 * 1024, 64 * 1024};
+	for(int f = 0; f < 3; ++f){
+		handler.m_count = 0;
+		nana::HtmlPushParser pushParser(handler);
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			for(std::size_t pos = 0; pos < i->size(); pos += feedSizes[f]){
+				pushParser.feed(i->data() + pos, std::min(feedSizes[f], i->size() - pos));
+			}
+			pushParser.finish();
+		}
+		report("HtmlPushParser feed " + std::to_string(feedSizes[f]), sw.sec(), bytes);
+		if(count != handler.m_count) cout << "  token count mismatch!! " << count << " != " << handler.m_count << endl;
+	}
+};
+
+
+///nh HtmlPart 쐬ꍇ̃X[vbg
+BENCH_FUNC(bench_SimpleHtmlSaxParserHandler_throughput){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler handler;
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		istringstream is(*i);
+		parser.parse(is, handler);
+		handler.result();
+	}
+	report("parse(istream&) per-char", sw.sec(), bytes);
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		handler.result();
+	}
+	report("parse(const char*, size)", sw.sec(), bytes);
+	//Rs[Ȃnh
+	nana::SimpleHtmlSaxParserViewHandler viewHandler;
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), viewHandler);
+		viewHandler.result();
+	}
+	report("parse(const char*, size) view", sw.sec(), bytes);
+};
+
+
+///߃ZbgƂ̑ƃp[X̃X[vbg
+BENCH_FUNC(bench_scan_levels){
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const nana::scan::Level orgLevel = nana::scan::level();
+	const char* names[] = {"SCALAR", "SSE2", "AVX2"};
+	const nana::scan::ByteSet set("<>\"'\n");
+	nana::HtmlSaxParser parser;
+	for(int lv = nana::scan::SCALAR; lv <= nana::scan::AVX2; ++lv){
+		if(!nana::scan::setLevel(static_cast<nana::scan::Level>(lv))) continue;
+		const string name(names[lv]);
+		//s𐔂
+		std::size_t lines = 0;
+		StopWatch sw;
+		for(auto i = corpus.begin(); i != corpus.end(); ++i) lines += nana::scan::countChar(i->data(), i->data() + i->size(), '\n');
+		report(name + " countChar('\\n')", sw.sec(), bytes);
+		//\𐔂
+		std::size_t structural = 0;
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			const char* end = i->data() + i->size();
+			for(const char* p = nana::scan::findFirstOf(i->data(), end, set); p != end; p = nana::scan::findFirstOf(p + 1, end, set)) ++structural;
+		}
+		report(name + " findFirstOf(<>\"'\\n)", sw.sec(), bytes);
+		//p[X
+		CountHtmlSaxParserHandler countHandler;
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i) parser.parse(i->data(), i->size(), countHandler);
+		report(name + " parse(const char*, size)", sw.sec(), bytes);
+		//^Ỏ͂܂
+		nana::SimpleHtmlSaxParserHandler handler;
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i){
+			parser.parse(i->data(), i->size(), handler);
+			handler.result();
+		}
+		report(name + " parse + parseTag", sw.sec(), bytes);
+		if(lines == 0 || structural == 0) cout << "  (no lines)" << endl;
+	}
+	nana::scan::setLevel(orgLevel);
+};
+
+
+///̑HTML̃p[XB͒x͂Ȃ̂ŁAp[X̏ꍇƑS^ȎQƂꍇׂ
+BENCH_FUNC(bench_TagHtmlPart_lazyAttr){
+	vector<string> corpus;
+	std::size_t bytes = 0;
+	for(unsigned int i = 0; i < 4; ++i){
+		corpus.push_back(makeAttrHeavyHtmlPage(4 * 1024 * 1024, i + 1));
+		bytes += corpus.back().size();
+	}
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserViewHandler handler;
+	//p[X̂݁i^Ój
+	StopWatch sw;
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		handler.result();
+	}
+	report("parse only", sw.sec(), bytes);
+	//̑QƂ
+	std::size_t found = 0;
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+		for(auto j = partsUptr->begin(); j != partsUptr->end(); ++j){
+			if((*j)->tagName() == "a" && !(*j)->attr("href", 0).empty()) ++found;
+		}
+	}
+	report("parse + a@href", sw.sec(), bytes);
+	//S^Ȏ͂ĖÖꗗ擾
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+		for(auto j = partsUptr->begin(); j != partsUptr->end(); ++j) found += (*j)->attrNames()->size();
+	}
+	report("parse + attrNames()", sw.sec(), bytes);
+	//̈mۂȂ̈ꗗ
+	sw.restart();
+	for(auto i = corpus.begin(); i != corpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+		for(auto j = partsUptr->begin(); j != partsUptr->end(); ++j) found += (*j)->attrs().size();
+	}
+	report("parse + attrs()", sw.sec(), bytes);
+	if(found == 0) cout << "  (no attributes)" << endl;
+};
+
+
+///R[h̕ϊAp[X̑OɕŜ1sꍇƁAp[XɃeLXgƂɍsꍇ̔rBUTF-8̌؂̑x
+BENCH_FUNC(bench_charset_toUtf8){
+	vector<string> sjisCorpus;
+	std::size_t sjisBytes = 0;
+	for(unsigned int i = 0; i < 8; ++i){
+		sjisCorpus.push_back(makeShiftJisHtmlPage(4 * 1024 * 1024, i + 1));
+		sjisBytes += sjisCorpus.back().size();
+	}
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserViewHandler handler;
+	//p[XɃeLXgƂɕϊ
+	std::size_t textBytes = 0;
+	StopWatch sw;
+	for(auto i = sjisCorpus.begin(); i != sjisCorpus.end(); ++i){
+		parser.parse(i->data(), i->size(), handler);
+		unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+		for(auto p = partsUptr->begin(); p != partsUptr->end(); ++p){
+			if((*p)->type() != nana::HtmlPart::TEXT) continue;
+			string text;
+			nana::charset::decode((*p)->view().data(), (*p)->view().data() + (*p)->view().size(), nana::charset::SHIFT_JIS, text);
+			textBytes += text.size();
+		}
+	}
+	report("parse + decode each text", sw.sec(), sjisBytes);
+	//p[X̑OɕŜϊ
+	vector<string> utf8Corpus(sjisCorpus.size());
+	std::size_t utf8Bytes = 0;
+	sw.restart();
+	for(std::size_t i = 0; i < sjisCorpus.size(); ++i){
+		nana::charset::Charset cs = nana::charset::UNKNOWN;
+		const nana::StrView utf8 = nana::charset::toUtf8(sjisCorpus[i].data(), sjisCorpus[i].size(), utf8Corpus[i], cs);
+		parser.parse(utf8.data(), utf8.size(), handler);
+		handler.result();
+		utf8Bytes += utf8.size();
+	}
+	report("toUtf8 (sniff + decode) + parse", sw.sec(), sjisBytes);
+	cout << "  text " << textBytes << " bytes, document " << utf8Bytes << " bytes" << endl;
+	//UTF-8̌؁iASCII唼̕ƁA{ꂪj
+	const vector<string>& corpus = Bench::bench.corpus();
+	const std::size_t bytes = Bench::bench.corpusBytes();
+	const nana::scan::Level orgLevel = nana::scan::level();
+	const char* names[] = {"SCALAR", "SSE2", "AVX2"};
+	for(int lv = nana::scan::SCALAR; lv <= nana::scan::AVX2; ++lv){
+		if(!nana::scan::setLevel(static_cast<nana::scan::Level>(lv))) continue;
+		const string name(names[lv]);
+		std::size_t valid = 0;
+		sw.restart();
+		for(auto i = corpus.begin(); i != corpus.end(); ++i) valid += nana::charset::isValidUtf8(i->data(), i->size());
+		report(name + " isValidUtf8 (ASCII)", sw.sec(), bytes);
+		sw.restart();
+		for(auto i = utf8Corpus.begin(); i != utf8Corpus.end(); ++i) valid += nana::charset::isValidUtf8(i->data(), i->size());
+		report(name + " isValidUtf8 (Japanese)", sw.sec(), utf8Bytes);
+		if(valid != corpus.size() + utf8Corpus.size()) cout << "  (invalid)" << endl;
+	}
+	nana::scan::setLevel(orgLevel);
+};
+
+
+} //namespace
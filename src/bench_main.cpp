@@ -0,0 +1,28 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+#include "html_element.hpp"
+#include "html_analysys.hpp"
+
+/* x`}[Nsp̃\[Xł
+gF bench_main [ÕtB^] [R[pXHTMLt@C...]
+*/
+
+
+using namespace std;
+
+
+#include "bench/bench.hpp"
+#include "bench/bench_parser.hpp"
+#include "bench/bench_document.hpp"
+#include "bench/bench_batch.hpp"
+
+
+int main(int argc, char *argv[]){
+	string filter(argc > 1 ? argv[1] : "");
+	for(int i = 2; i < argc; ++i) nana::bench::Bench::bench.addCorpusFile(argv[i]);
+	nana::bench::Bench::bench.exec(filter);
+
+	return 0;
+}
@@ -22,6 +22,8 @@
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 
 #include "html_analysys.hpp"
@@ -54,184 +56,483 @@ const bool backwardMatch(const string& p_targetStr, const string& p_searchStr){
 	if(p_targetStr.find(p_searchStr, p_targetStr.size() - p_searchStr.size()) != std::string::npos) return true;
 	return false;
 }
+
+//Ō*蒼2̃|C^ŏƍiO(p^[~)BċAȂj
 const bool wildcardMatch(const char *ptn, const char *str){
-	switch(*ptn){
-	case '\0':
-		return '\0' == *str;
-	case '*':
-		return wildcardMatch(ptn + 1, str)
-			|| (('\0' != *str) && wildcardMatch(ptn, str + 1));
-	case '?':
-		return ('\0' != *str)
-			&& wildcardMatch(ptn + 1, str + 1);
-	default:
-		if(*ptn == '\\') ++ptn;
-		if(*ptn == '\0' && *str != '\0') return false;
-		if(*ptn == '\0' && *str == '\0') return true;
-		return ((unsigned char)*ptn == (unsigned char)*str)
-			&& wildcardMatch(ptn + 1, str + 1);
+	const char* starPtn = nullptr;//Ō*̎̈ʒu
+	const char* starStr = nullptr;//Ō*ɑΉ̏I
+	for(;;){
+		if(*ptn == '*'){
+			//*0ɑΉAƍɎs1΂
+			starPtn = ++ptn;
+			starStr = str;
+			continue;
+		}
+		if(*str == '\0'){
+			//̏IBp^[IȂ}b`iŌ\͖j
+			return *ptn == '\0' || (*ptn == '\\' && ptn[1] == '\0');
+		}
+		if(*ptn == '?'){
+			++ptn;
+			++str;
+			continue;
+		}
+		//\̎͂̂̕܂ܔr
+		const char* lit = (*ptn == '\\') ? ptn + 1 : ptn;
+		if(*lit != '\0' && (unsigned char)*lit == (unsigned char)*str){
+			ptn = lit + 1;
+			++str;
+			continue;
+		}
+		//vȂꍇAŌ*ɑΉ镶1₷
+		if(starPtn == nullptr) return false;
+		ptn = starPtn;
+		str = ++starStr;
 	}
 }
 
 namespace{
 
 ///Ă͂Ȃ^O
-static const map<string, int> g_mapNotClosed = {
-	{"<!--", 0}, {"<!doctype", 0}, {"br", 0}, {"img", 0}, {"hr", 0}, {"meta", 0},
-	{"input", 0}, {"embed", 0}, {"area", 0}, {"base", 0}, {"col", 0},
-	{"keygen", 0}, {"link", 0}, {"param", 0}, {"source", 0}
+static const atom::AtomSet g_notClosedTags = {
+	"<!--", "<!doctype", "br", "img", "hr", "meta",
+	"input", "embed", "area", "base", "col",
+	"keygen", "link", "param", "source"
 };
 
-/**
-@return I^OBȂꍇNULLBp_curNodeɃ^O𗭂߂B
-@note input,imgȂǂ̏I^OȂĂ悢^OlĂ
-*/
-const HtmlPart* _htmlNodeAnalyze(HtmlNode& p_curNode, const string& startTagName,
-	HtmlDocument::const_iterator& i, HtmlDocument::const_iterator end){
-	string curCloseTagName("");
-	if(!startTagName.empty()) curCloseTagName = "/" + startTagName;
-
-	//
-	for(; i != end; ++i){
-		const HtmlPart& ele = **i;
-		if(ele.type() == HtmlPart::NOT_END){
-			//^ȌIȂꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, NULL, &p_curNode)));
-			continue;
-		}
-		if(ele.type() != HtmlPart::TAG)continue;
-		if(ele.str()[ele.str().size() - 2] == '/'){
-			//P^Ȍꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, &ele, &p_curNode)));
-			continue;
-		}
-		if(g_mapNotClosed.find(ele.tagName()) != g_mapNotClosed.end()){
-			//ȂĂ^OiinputȂǁj̏ꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, &ele, &p_curNode)));
-			continue;
-		}
-		if(ele.tagName()[0] == '/'){
-			//^O
-			if(ele.tagName() == curCloseTagName){
-				//ړIiTĂj̕^O 
-				return &ele;
-			} else{
-				//ړIȊO̕^O
-				p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(nullptr, &ele, &p_curNode)));
-				continue;
-			}
-		}
-		//Jn^ȌꍇB1̊Kw𑖍 
-		unique_ptr<HtmlNode> childNodeUptr(new HtmlNode(&ele, nullptr, &p_curNode));
-		const HtmlPart* endTag = _htmlNodeAnalyze(*childNodeUptr, ele.tagName(), ++i, end);
-		childNodeUptr->setEndTag(endTag);
-		p_curNode.appendChild(move(childNodeUptr));
+///ȂĂ^OiinputȂǁj
+inline const bool isNotClosedTag(const HtmlPart& p_part){
+	return !p_part.isEndTag() && g_notClosedTags.contains(p_part.tagAtom());
+}
 
-		//Ō܂ōsĂȂΎցBŌȂI 
-		if(i != end) continue;
-		return nullptr;
-	}
-	return nullptr;
+///em[hƓA[iiȂꍇ̓q[vjɎqm[h쐬
+HtmlNode::NodeUptr newChildNode(const HtmlNode& p_parent, const HtmlPart* p_start, const HtmlPart* p_end){
+	MonotonicArena* arena = p_parent.arena();
+	return HtmlNode::NodeUptr(NewInArena<HtmlNode>(arena, p_start, p_end, &p_parent, arena));
 }
 
 
-void _htmlNodeAnalyzeBySameTagMatch(HtmlNode& p_curNode, const string& startTagName,
-	HtmlDocument::const_iterator& i, HtmlDocument::const_iterator end, multimap<string, HtmlNode*>& p_stockTagNameMap)
-{
-	string curCloseTagName("");
-	if(!startTagName.empty()) curCloseTagName = "/" + startTagName;
+}//namespace{ 
 
-	//
-	for(; i != end; ++i){
-		const HtmlPart& ele = **i;
-		if(ele.type() == HtmlPart::NOT_END){
-			//^ȌIȂꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, NULL, &p_curNode)));
-			continue;
-		}
-		if(ele.type() != HtmlPart::TAG)continue;
-		if(ele.str()[ele.str().size() - 2] == '/'){
-			//P^Ȍꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, &ele, &p_curNode)));
-			continue;
-		}
-		if(g_mapNotClosed.find(ele.tagName()) != g_mapNotClosed.end()){
-			//ȂĂ^OiinputȂǁj̏ꍇ
-			p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(&ele, &ele, &p_curNode)));
-			continue;
-		}
-		if(ele.tagName()[0] == '/'){
-			const char* tagName = ele.tagName().c_str() + 1;
-			if(p_stockTagNameMap.find(tagName) != p_stockTagNameMap.end()){
-				//Jn^Oꍇ
-				auto ite = p_stockTagNameMap.equal_range(tagName).second;
-				--ite;
-				HtmlNode& startNode = *(ite->second);
-				p_stockTagNameMap.erase(ite);
-				startNode.setEndTag(&ele);
-				if(startTagName == tagName) return;
-			}else{
-				//Jn^OȂꍇ
-				p_curNode.appendChild(unique_ptr<HtmlNode>(new HtmlNode(nullptr, &ele, &p_curNode)));
-			}
-			continue;
-		}
-		//Jn^ȌꍇB1̊Kw𑖍 
-		unique_ptr<HtmlNode> childNodeUptr(new HtmlNode(&ele, nullptr, &p_curNode));
-		p_stockTagNameMap.insert(std::make_pair(ele.tagName(), childNodeUptr.get()));
-		//z̑BċNĂяo
-		_htmlNodeAnalyzeBySameTagMatch(*childNodeUptr, ele.tagName(), ++i, end, p_stockTagNameMap);
-		p_curNode.appendChild(move(childNodeUptr));
-
-		//Ō܂ōsĂȂΎցBŌȂI 
-		if(i != end) continue;
-		return;
-	}
-	return;
-} //end _htmlNodeAnalyzeBySameTagMatch(){
 
-}//namespace{ 
 
 
 
+//HtmlNodeBuilder-----------------------------------------------
+HtmlNodeBuilder::~HtmlNodeBuilder(){
+	while(!m_frames.empty()) popFrame();
+}
+
+HtmlNode::NodeUptr HtmlNodeBuilder::newNode(const HtmlNode& p_parent, const HtmlPart* p_start, const HtmlPart* p_end){
+	HtmlNode::NodeUptr ret(newChildNode(p_parent, p_start, p_end));
+	ret->setOrder(m_nextOrder++);
+	return ret;
+}
+
+//W̖O̓^O Atom ̂܂܎g
+const Atom HtmlNodeBuilder::tagKey(const HtmlPart& p_part){
+	if(p_part.tagAtom() != atom::UNKNOWN) return p_part.tagAtom();
+	const string& name = p_part.tagName();
+	const std::size_t skip = p_part.isEndTag() ? 1 : 0;
+	return m_localAtoms.intern(name.data() + skip, name.size() - skip);
+}
+
+//m[h̎q́AJĂԂɍ쐬m[h
+void HtmlNodeBuilder::popFrame(){
+	m_frames.back().node->setLastOrder(m_nextOrder - 1);
+	m_frames.pop_back();
+}
+
+void HtmlNodeBuilder::push(const HtmlPart& p_part){
+	if(m_finished) return;
+	if(m_frames.empty()){
+		//ŏ̃^OiI^Ȍꍇ/܂߂Oj^OA[g̕^OƂ
+		m_frames.push_back(Frame(&m_root, m_localAtoms.intern(p_part.tagName())));
+	}
+	HtmlNode& curNode = *m_frames.back().node;
+	if(p_part.type() == HtmlPart::NOT_END){
+		//^ȌIȂꍇ
+		curNode.appendChild(newNode(curNode, &p_part, NULL));
+		return;
+	}
+	if(p_part.type() != HtmlPart::TAG) return;
+	if(p_part.view()[p_part.view().size() - 2] == '/'){
+		//P^Ȍꍇ
+		curNode.appendChild(newNode(curNode, &p_part, &p_part));
+		return;
+	}
+	if(isNotClosedTag(p_part)){
+		//ȂĂ^OiinputȂǁj̏ꍇ
+		curNode.appendChild(newNode(curNode, &p_part, &p_part));
+		return;
+	}
+	if(p_part.isEndTag()){
+		if(m_policy == HIERARCHY_MATCH) endTagByHierarchy(p_part);
+		else endTagBySameTag(p_part);
+		return;
+	}
+	//Jn^ȌꍇB1̊Kwɂiqm[h͐ɐeɒǉĂj
+	HtmlNode::NodeUptr childNodeUptr(newNode(curNode, &p_part, nullptr));
+	HtmlNode* childNodePtr = childNodeUptr.get();
+	curNode.appendChild(move(childNodeUptr));
+	const Atom key = tagKey(p_part);
+	if(m_policy == SAME_TAG_MATCH) m_stockTagMap[key].push_back(childNodePtr);
+	m_frames.push_back(Frame(childNodePtr, key));
+}
+
+///Kw}b`̏ꍇ̕^O
+void HtmlNodeBuilder::endTagByHierarchy(const HtmlPart& p_part){
+	const Frame& frame = m_frames.back();
+	if(frame.startTagAtom != atom::EMPTY && tagKey(p_part) == frame.startTagAtom){
+		//ړIiTĂj̕^OB[g̏ꍇ͂ŉ͂I
+		if(m_frames.size() == 1){
+			m_finished = true;
+			return;
+		}
+		frame.node->setEndTag(&p_part);
+		popFrame();
+	} else{
+		//ړIȊO̕^O
+		frame.node->appendChild(newNode(*frame.node, nullptr, &p_part));
+	}
+}
+
+///^OǂŃ}b`ꍇ̕^O
+void HtmlNodeBuilder::endTagBySameTag(const HtmlPart& p_part){
+	const Frame& frame = m_frames.back();
+	const Atom key = tagKey(p_part);
+	auto ite = m_stockTagMap.find(key);
+	if(ite != m_stockTagMap.end() && !ite->second.empty()){
+		//Jn^OꍇiԍŌ̊Jn^Oƃ}b`j
+		ite->second.back()->setEndTag(&p_part);
+		ite->second.pop_back();
+		if(frame.startTagAtom == key){
+			//̊Kw̃^OƓꍇ1̊Kwɖ߂B[g̏ꍇ͂ŉ͂I
+			if(m_frames.size() == 1) m_finished = true;
+			else popFrame();
+		}
+	} else{
+		//Jn^OȂꍇ
+		frame.node->appendChild(newNode(*frame.node, nullptr, &p_part));
+	}
+}
 
 
-//HTML^Õ^O͂iċNjB
+//HTML^Õ^O͂iKw}b`jB
 void analyzeHtmlNode(HtmlNode& p_ret, const HtmlDocument::HtmlPartUptrs& p_allDocParts){
-	HtmlDocument::const_iterator i = p_allDocParts.begin();
-	_htmlNodeAnalyze(p_ret, (*i)->tagName(), i, p_allDocParts.end());
+	HtmlNodeBuilder builder(p_ret, HtmlNodeBuilder::HIERARCHY_MATCH);
+	for(auto i = p_allDocParts.begin(); i != p_allDocParts.end() && !builder.finished(); ++i) builder.push(**i);
 }
 
 //HTML^Õ^O͂i^OǂŏoɊKwă}b`@jB
 void analyzeHtmlNodeBySameTagMatch(HtmlNode& p_ret, const HtmlDocument::HtmlPartUptrs& p_allDocParts){
-	HtmlDocument::const_iterator i = p_allDocParts.begin();
-	multimap<string, HtmlNode*> map;
-	_htmlNodeAnalyzeBySameTagMatch(p_ret, (*i)->tagName(), i, p_allDocParts.end(), map);
+	HtmlNodeBuilder builder(p_ret, HtmlNodeBuilder::SAME_TAG_MATCH);
+	for(auto i = p_allDocParts.begin(); i != p_allDocParts.end() && !builder.finished(); ++i) builder.push(**i);
 }
 
-//HTML͂A^OzԂHTMLp[TnhB
+//p[XJnɁAm[h̊Kw쐬郋[gm[hpӂ
+void DocumentHtmlSaxParserHandler::start(){
+	m_builderUptr.reset();
+	m_rootNodeUptr.reset();
+	SimpleHtmlSaxParserHandler::start();
+	//m[h^OƓA[iɍ쐬
+	m_rootNodeUptr.reset(NewInArena<HtmlNode>(arena(), nullptr, nullptr, nullptr, arena()));
+	m_builderUptr.reset(new HtmlNodeBuilder(*m_rootNodeUptr, m_policy));
+};
+
+//HTML͂A쐬ς݂̃m[h̊Kwƃ^Oz񂩂 HtmlDocument ԂB
 unique_ptr<HtmlDocument> DocumentHtmlSaxParserHandler::result(){
-	unique_ptr<HtmlDocument::HtmlPartUptrs> htmlPartsUptrVecUptr = SimpleHtmlSaxParserHandler::result();
-	unique_ptr<HtmlNode> rootNodeUptr(new HtmlNode(nullptr, nullptr, nullptr));
-	analyzeHtmlNode(*rootNodeUptr, *htmlPartsUptrVecUptr);
-	return unique_ptr<HtmlDocument>(new HtmlDocument(move(htmlPartsUptrVecUptr), move(rootNodeUptr)));
+	unique_ptr<HtmlDocument::HtmlPartUptrs> partsUptr(SimpleHtmlSaxParserHandler::result());
+	if(!partsUptr) return nullptr;
+	m_builderUptr.reset();
+	return unique_ptr<HtmlDocument>(new HtmlDocument(move(partsUptr), move(m_rootNodeUptr), releaseArena()));
 };
 
+//p[XJnɁAm[h̊Kw쐬郋[gm[hpӂ
+void DocumentHtmlSaxParserViewHandler::start(){
+	m_builderUptr.reset();
+	m_rootNodeUptr.reset();
+	SimpleHtmlSaxParserViewHandler::start();
+	m_rootNodeUptr.reset(NewInArena<HtmlNode>(arena(), nullptr, nullptr, nullptr, arena()));
+	m_builderUptr.reset(new HtmlNodeBuilder(*m_rootNodeUptr, m_policy));
+};
+
+//HTML͂A̓obt@QƂ HtmlDocument ԂB
+unique_ptr<HtmlDocument> DocumentHtmlSaxParserViewHandler::result(){
+	unique_ptr<HtmlDocument::HtmlPartUptrs> partsUptr(SimpleHtmlSaxParserViewHandler::result());
+	if(!partsUptr) return nullptr;
+	m_builderUptr.reset();
+	return unique_ptr<HtmlDocument>(new HtmlDocument(move(partsUptr), move(m_rootNodeUptr), releaseArena()));
+};
+
+
+
+namespace{
+
+///}bvt@Cp[XA HtmlDocument Ƀ}bsOێ
+unique_ptr<HtmlDocument> parseMappedFile(const std::shared_ptr<const MappedFile>& p_file, DocumentHtmlSaxParserViewHandler& p_handler){
+	HtmlSaxParser parser;
+	parser.parse(p_file->data(), p_file->size(), p_handler);
+	unique_ptr<HtmlDocument> ret = p_handler.result();
+	ret->holdSource(p_file);
+	return ret;
+}
+
+///}bvt@Cp[Xi}bsO͕ێȂj
+unique_ptr<HtmlDocument> parseMappedFile(const MappedFile& p_file, DocumentHtmlSaxParserHandler& p_handler){
+	HtmlSaxParser parser;
+	parser.parse(p_file.data(), p_file.size(), p_handler);
+	return p_handler.result();
+}
+
+}//namespace{
+
+unique_ptr<HtmlDocument> parseHtmlFile(const string& p_path, DocumentHtmlSaxParserViewHandler& p_handler, const MappedFile::Advice p_advice){
+	return parseMappedFile(std::make_shared<const MappedFile>(p_path, p_advice), p_handler);
+}
+
+unique_ptr<HtmlDocument> parseHtmlFile(const int p_fd, DocumentHtmlSaxParserViewHandler& p_handler, const MappedFile::Advice p_advice){
+	return parseMappedFile(std::make_shared<const MappedFile>(p_fd, p_advice), p_handler);
+}
+
+unique_ptr<HtmlDocument> parseHtmlFile(const string& p_path, DocumentHtmlSaxParserHandler& p_handler, const MappedFile::Advice p_advice){
+	return parseMappedFile(MappedFile(p_path, p_advice), p_handler);
+}
+
+unique_ptr<HtmlDocument> parseHtmlFile(const int p_fd, DocumentHtmlSaxParserHandler& p_handler, const MappedFile::Advice p_advice){
+	return parseMappedFile(MappedFile(p_fd, p_advice), p_handler);
+}
+
+unique_ptr<HtmlDocument> parseHtmlAsUtf8(const char* p_data, const std::size_t p_size, DocumentHtmlSaxParserViewHandler& p_handler,
+	charset::Charset& p_charset){
+	std::shared_ptr<string> bufPtr = std::make_shared<string>();
+	const StrView utf8 = charset::toUtf8(p_data, p_size, *bufPtr, p_charset);
+	HtmlSaxParser parser;
+	parser.parse(utf8.data(), utf8.size(), p_handler);
+	unique_ptr<HtmlDocument> ret = p_handler.result();
+	if(utf8.data() == bufPtr->data()) ret->holdSource(bufPtr);
+	return ret;
+}
+
+
+//HtmlDocumentEditor-----------------------------------------------
+
+namespace{
+
+///m[h̊Kw蒼Õm[h̐iȏO͑Ŝ蒼j
+const std::size_t REBUILD_ATTEMPTS = 3;
+
+///p_indexԖڂ̃^O_i^OARg̒jn܂邩
+const bool startsAtSync(const HtmlDocument::HtmlPartUptrs& p_parts, const std::size_t p_index){
+	if(p_index == 0) return true;
+	const HtmlPart::Type type = p_parts[p_index - 1]->type();
+	return type == HtmlPart::TAG || type == HtmlPart::COMMENT || type == HtmlPart::DECLARATION;
+}
+
+///^O̒̕𑫂ĂA擪̃oCg
+void appendOffsets(vector<std::size_t>& p_offsets, std::size_t p_offset, const HtmlDocument::HtmlPartUptrs& p_parts){
+	for(auto i = p_parts.begin(); i != p_parts.end(); ++i){
+		p_offsets.push_back(p_offset);
+		p_offset += (*i)->view().size();
+	}
+}
+
+///p_chain̍Ō̃m[h̎qm[h蒼Aɑm[h̔ԍ炷
+void shiftOrders(const vector<HtmlNode*>& p_chain){
+	HtmlNode& node = *p_chain.back();
+	const HtmlNode::NodeUptrs& children = node.childNodeList();
+	const std::size_t newLast = children.empty() ? node.order() : children.back()->lastOrder();
+	if(newLast == node.lastOrder()) return;
+	//Ȃ̍AΌꍇ
+	const std::size_t delta = newLast - node.lastOrder();
+	node.setLastOrder(newLast);
+	vector<HtmlNode*> stack;
+	for(std::size_t c = p_chain.size() - 1; c > 0; --c){
+		HtmlNode& parent = *p_chain[c - 1];
+		parent.setLastOrder(parent.lastOrder() + delta);
+		//蒼m[h܂ގqm[ȟZ̕
+		const HtmlNode::NodeUptrs& siblings = parent.childNodeList();
+		const std::size_t order = p_chain[c]->order();
+		for(auto i = std::partition_point(siblings.begin(), siblings.end(),
+			[order](const HtmlNode::NodeUptr& p_sibling){ return p_sibling->order() <= order; }); i != siblings.end(); ++i){
+			stack.push_back(i->get());
+			while(!stack.empty()){
+				HtmlNode* cur = stack.back();
+				stack.pop_back();
+				const std::size_t last = cur->lastOrder() + delta;
+				cur->setOrder(cur->order() + delta);
+				cur->setLastOrder(last);
+				for(auto j = cur->childNodeList().begin(); j != cur->childNodeList().end(); ++j) stack.push_back(j->get());
+			}
+		}
+	}
+}
+
+}//namespace{
+
+
+HtmlDocumentEditor::HtmlDocumentEditor(const string& p_html, const HtmlNodeBuilder::Policy p_policy)
+	: m_source(p_html), m_policy(p_policy){
+	DocumentHtmlSaxParserHandler handler(HtmlDocument::HEAP, m_policy);
+	m_parser.parse(m_source.data(), m_source.size(), handler);
+	m_docUptr = handler.result();
+	m_offsets.reserve(m_docUptr->size());
+	appendOffsets(m_offsets, 0, *m_docUptr->m_stockedPartUptrsUptr);
+}
+
+
+void HtmlDocumentEditor::replace(const std::size_t p_begin, const std::size_t p_size, const string& p_text){
+	if(p_begin > m_source.size() || p_size > m_source.size() - p_begin){
+		throw std::out_of_range("HtmlDocumentEditor::replace() : range is out of source");
+	}
+	m_stats = EditStats();
+	m_docUptr->m_indexUptr.reset();
+	HtmlDocument::HtmlPartUptrs& parts = *m_docUptr->m_stockedPartUptrsUptr;
+	const std::size_t oldEnd = p_begin + p_size;
+	const std::size_t newEnd = p_begin + p_text.size();
+	//ҏWʒuOŁA_n܂Ō̃^O瑖
+	std::size_t first = std::upper_bound(m_offsets.begin(), m_offsets.end(), p_begin) - m_offsets.begin();
+	if(first > 0) --first;
+	while(first > 0 && !startsAtSync(parts, first)) --first;
+	const std::size_t restart = parts.empty() ? 0 : m_offsets[first];
+	const long line = parts.empty() ? 1 : parts[first]->lineNum();
+	const long pos = parts.empty() ? 0 : parts[first]->posNum();
+	m_source.replace(p_begin, p_size, p_text);
+	//ҏW͈͂ŁAҏWOƓ_ɖ߂~߂iȍ~̃^O͎g񂷁j
+	std::size_t last = parts.size();
+	long shiftLine = 0, shiftPos = 0;
+	m_stats.scannedBytes = m_source.size() - restart;
+	SimpleHtmlSaxParserHandler handler;
+	handler.start();
+	m_parser.resume(m_source.data(), m_source.size(), restart, line, pos, handler,
+		[&](const std::size_t p_offset, const long p_line, const long p_pos)->bool{
+			if(p_offset < newEnd) return true;
+			const std::size_t oldOffset = p_offset - newEnd + oldEnd;
+			auto ite = std::lower_bound(m_offsets.begin(), m_offsets.end(), oldOffset);
+			if(ite == m_offsets.end() || *ite != oldOffset) return true;
+			const std::size_t index = ite - m_offsets.begin();
+			if(!startsAtSync(parts, index)) return true;
+			last = index;
+			shiftLine = p_line - parts[index]->lineNum();
+			shiftPos = p_pos - parts[index]->posNum();
+			m_stats.scannedBytes = p_offset - restart;
+			return false;
+		});
+	unique_ptr<HtmlDocument::HtmlPartUptrs> newPartsUptr(handler.result());
+	const std::size_t inserted = newPartsUptr->size();
+	m_stats.reparsedParts = inserted;
+	m_stats.removedParts = last - first;
+	//蒼m[h́A^OւO̔ԍŒT
+	vector<Enclosing> enclosings;
+	if(m_policy == HtmlNodeBuilder::HIERARCHY_MATCH) enclosings = enclosingNodes(first, last);
+	//^OւBҏW͈͂ɂ^ÓAm[h̊Kw蒼܂ŎcĂ
+	HtmlDocument::HtmlPartUptrs removed(std::make_move_iterator(parts.begin() + first), std::make_move_iterator(parts.begin() + last));
+	vector<std::size_t> newOffsets;
+	newOffsets.reserve(inserted);
+	appendOffsets(newOffsets, restart, *newPartsUptr);
+	parts.erase(parts.begin() + first, parts.begin() + last);
+	parts.insert(parts.begin() + first, std::make_move_iterator(newPartsUptr->begin()), std::make_move_iterator(newPartsUptr->end()));
+	m_offsets.erase(m_offsets.begin() + first, m_offsets.begin() + last);
+	m_offsets.insert(m_offsets.begin() + first, newOffsets.begin(), newOffsets.end());
+	//g񂷃^Öʒu炷
+	for(std::size_t i = first + inserted; i < parts.size(); ++i){
+		m_offsets[i] = m_offsets[i] - oldEnd + newEnd;
+		if(shiftLine != 0 || shiftPos != 0) parts[i]->shiftPos(shiftLine, shiftPos);
+	}
+	//̃m[h珇ɁAqm[h蒼
+	std::size_t attempts = 0;
+	for(auto i = enclosings.rbegin(); i != enclosings.rend() && attempts < REBUILD_ATTEMPTS; ++i, ++attempts){
+		if(rebuildChildren(*i->node, i->start, i->end - last + first + inserted)){
+			//m[h̐ςÃm[h̔ԍ炷
+			vector<HtmlNode*> chain(1, m_docUptr->m_rootNodeUptr.get());
+			for(auto j = enclosings.begin(); j != i.base(); ++j) chain.push_back(j->node);
+			shiftOrders(chain);
+			return;
+		}
+	}
+	rebuildAll();
+}
+
+
+//^O̔ԍB posNum() ͐擪猸Ȃ̂œ񕪒TAʒũ^OT
+const std::size_t HtmlDocumentEditor::partIndex(const HtmlPart* p_part)const{
+	const HtmlDocument::HtmlPartUptrs& parts = *m_docUptr->m_stockedPartUptrsUptr;
+	auto ite = std::lower_bound(parts.begin(), parts.end(), p_part->posNum(),
+		[](const HtmlDocument::HtmlPartUptr& p_item, const long p_pos){ return p_item->posNum() < p_pos; });
+	while(ite->get() != p_part) ++ite;
+	return ite - parts.begin();
+}
+
+
+//[p_first, p_last)Ԗڂ̃^O܂ޕm[hAO珇ɕԂi[gm[h͊܂܂Ȃj
+vector<HtmlDocumentEditor::Enclosing> HtmlDocumentEditor::enclosingNodes(const std::size_t p_first, const std::size_t p_last)const{
+	vector<Enclosing> ret;
+	const HtmlNode* node = m_docUptr->m_rootNodeUptr.get();
+	for(;;){
+		//qm[h͏oɕł̂ŁAp_firstOn܂Ō̎qm[hT
+		const HtmlNode::NodeUptrs& children = node->childNodeList();
+		auto ite = std::partition_point(children.begin(), children.end(), [&](const HtmlNode::NodeUptr& p_child){
+			const HtmlPart* part = (p_child->startTag() != nullptr) ? p_child->startTag() : p_child->endTag();
+			return partIndex(part) < p_first;
+		});
+		if(ite == children.begin()) break;
+		HtmlNode* child = (--ite)->get();
+		if(!child->isClosed() || child->startTag() == child->endTag()) break;
+		const std::size_t end = partIndex(child->endTag());
+		if(end < p_last) break;
+		ret.push_back(Enclosing(child, partIndex(child->startTag()), end));
+		node = child;
+	}
+	return ret;
+}
+
+
+//p_node̎qm[h蒼Bp_end̃^Oł傤p_nodeꍇu
+const bool HtmlDocumentEditor::rebuildChildren(HtmlNode& p_node, const std::size_t p_start, const std::size_t p_end){
+	const HtmlDocument::HtmlPartUptrs& parts = *m_docUptr->m_stockedPartUptrsUptr;
+	HtmlNode scratch(p_node.startTag(), nullptr, p_node.parent());
+	//qm[h̔ԍp_node̔ԍ瑱
+	scratch.setOrder(p_node.order());
+	HtmlNodeBuilder builder(scratch, m_policy, *p_node.startTag());
+	for(std::size_t i = p_start + 1; i <= p_end; ++i){
+		if(builder.finished()) return false;
+		builder.push(*parts[i]);
+		++m_stats.rebuiltParts;
+	}
+	if(!builder.finished()) return false;
+	p_node.replaceChildren(scratch);
+	return true;
+}
+
+
+void HtmlDocumentEditor::rebuildAll(){
+	const HtmlDocument::HtmlPartUptrs& parts = *m_docUptr->m_stockedPartUptrsUptr;
+	HtmlNode::NodeUptr rootUptr(new HtmlNode());
+	HtmlNodeBuilder builder(*rootUptr, m_policy);
+	for(auto i = parts.begin(); i != parts.end() && !builder.finished(); ++i){
+		builder.push(**i);
+		++m_stats.rebuiltParts;
+	}
+	m_docUptr->m_rootNodeUptr = move(rootUptr);
+	m_stats.fullRebuild = true;
+}
 
 
 void EndTagAccessor::access(const HtmlNode& p_node){
 	if(p_node.isClosed()) return;
 	if(p_node.startTag() == nullptr){
-		const char* tagName = p_node.tagName().c_str() + 1;
-		//I^Ô݂ꍇ
-		if(m_stockMap.find(tagName) == m_stockMap.end()){
+		//I^Ô݂ꍇi擪/OBWȊO̖O m_localAtoms Ŕrj
+		const string& name = p_node.tagName();
+		const Atom tagAtom = (p_node.isEndTag() && p_node.tagAtom() != atom::UNKNOWN) ? p_node.tagAtom()
+			: m_localAtoms.intern(name.data() + (name.empty() ? 0 : 1), name.empty() ? 0 : name.size() - 1);
+		auto ite = m_stockMap.find(tagAtom);
+		if(ite == m_stockMap.end()){
 			m_nonClosedResult->push_back(&p_node);
-		} else if(m_stockMap[tagName].empty()){
+		} else if(ite->second.empty()){
 			m_nonClosedResult->push_back(&p_node);
 		} else{
 			//΂ɂȂJn^Oꍇ
-			//const HtmlNode& node = *m_stockMap[tagName].back();
-			m_stockMap[tagName].pop_back();
+			ite->second.pop_back();
 			//eJnEI^OꍇANGʂɒǉ
 			if(p_node.parent() == nullptr){
 				m_alternatedResult->push_back(&p_node);
@@ -244,26 +545,91 @@ void EndTagAccessor::access(const HtmlNode& p_node){
 		m_nonClosedResult->push_back(&p_node);
 	} else{
 		//Jn^Ô݂ꍇ
-		m_stockMap[p_node.tagName()].push_back(&p_node);
+		m_stockMap[p_node.tagAtom() != atom::UNKNOWN ? p_node.tagAtom() : m_localAtoms.intern(p_node.tagName())].push_back(&p_node);
 	}
 };
 
 EndTagAccessor::SearchResultsUptr EndTagAccessor::nonClosedResult(){
-	for(auto i = m_stockMap.begin(); i != m_stockMap.end(); ++i){
-		vector<const HtmlNode*>& vec = i->second;
+	//^Ȍɒǉ
+	vector<Atom> tagAtoms;
+	for(auto i = m_stockMap.begin(); i != m_stockMap.end(); ++i) tagAtoms.push_back(i->first);
+	std::sort(tagAtoms.begin(), tagAtoms.end(),
+		[this](const Atom a, const Atom b){ return m_localAtoms.name(a) < m_localAtoms.name(b); });
+	for(auto i = tagAtoms.begin(); i != tagAtoms.end(); ++i){
+		vector<const HtmlNode*>& vec = m_stockMap[*i];
 		if(vec.empty()) continue;
 		m_nonClosedResult->insert(m_nonClosedResult->end(), vec.begin(), vec.end());
 	}
 	return move(m_nonClosedResult);
 };
 
-const std::map<std::string, int> DeprecatedInHtml5Accessor::s_deprecatedTagMap({{"center", 0}, {"font", 0}, {"blink", 0}, {"strike", 0}, {"s", 0}, {"u", 0}, {"bgsound", 0}, {"marquee", 0}, {"applet", 0}, {"acronym", 0}, {"dir", 0},
-{"frame", 0}, {"frameset", 0}, {"noframes", 0}, {"isindex", 0}, {"listing", 0}, {"xmp", 0}, {"noembed", 0}, {"plaintext", 0}, {"rb", 0}, {"basefont", 0}, {"big", 0}, {"spacer", 0}, {"tt", 0}});
+const atom::AtomSet DeprecatedInHtml5Accessor::s_deprecatedTags({"center", "font", "blink", "strike", "s", "u", "bgsound", "marquee", "applet", "acronym", "dir",
+"frame", "frameset", "noframes", "isindex", "listing", "xmp", "noembed", "plaintext", "rb", "basefont", "big", "spacer", "tt"});
 
 
 //------------------------------
 namespace path{
 
+namespace{
+
+///ChJ[hi*A?A\j܂܂Ȃ
+inline const bool isLiteral(const string& p_ptn){
+	return p_ptn.find_first_of("*?\\") == string::npos;
+}
+
+/**
+ChJ[h܂܂ȂW̖ȌꍇAp^[ Atom ԂiȊO atom::UNKNOWN jB
+WȊO̖O̓p[X^Oł atom::UNKNOWN Ȃ̂ŁAŔrB
+*/
+const Atom literalAtom(const string& p_ptn){
+	return isLiteral(p_ptn) ? atom::findStandard(p_ptn) : atom::UNKNOWN;
+}
+
+///Ȏ̂ŏ̂̂
+const bool isFirstAttr(const HtmlAttrs& p_attrs, HtmlAttrs::const_iterator p_ite){
+	for(auto i = p_attrs.begin(); i != p_ite; ++i){
+		if(i->nameAtom == p_ite->nameAtom && (i->nameAtom != atom::UNKNOWN || i->name == p_ite->name)) return false;
+	}
+	return true;
+}
+
+///^Ov邩ip_tagAtom atom::UNKNOWN ̏ꍇ̓ChJ[hŔrj
+inline const bool matchTagName(const HtmlNode& p_node, const string& p_tagName, const Atom p_tagAtom, const bool p_isEndTag){
+	if(p_tagAtom != atom::UNKNOWN) return p_node.tagAtom() == p_tagAtom && p_node.isEndTag() == p_isEndTag;
+	return wildcardMatch(p_tagName.c_str(), p_node.tagName().c_str());
+}
+
+///Jn^OɎw̑ƒl̑邩iȎ͍ŏ̒lj
+const bool matchAttr(const HtmlNode& p_node, const string& p_attrName, const Atom p_attrNameAtom, const string& p_attrVal){
+	const HtmlPart* startTagPartsP = p_node.startTag();
+	if(startTagPartsP == nullptr) return false;
+	const HtmlAttrs& attrs = startTagPartsP->attrs();
+	for(auto j = attrs.begin(); j != attrs.end(); ++j){
+		if(p_attrNameAtom != atom::UNKNOWN){
+			if(j->nameAtom != p_attrNameAtom) continue;
+		} else if(!p_attrName.empty()){
+			if(!wildcardMatch(p_attrName.c_str(), j->name.c_str())) continue;
+		}
+		if(!p_attrVal.empty()){
+			if(!isFirstAttr(attrs, j)) continue;
+			if(!wildcardMatch(p_attrVal.c_str(), j->value.c_str())) continue;
+		}
+		//w̃L[Al}b`ꍇ
+		return true;
+	}
+	return false;
+}
+
+}//namespace{
+
+PathHtmlPath::PathHtmlPath(const string& p_tagName)
+	: m_tagName(p_tagName), m_isEndTag(!p_tagName.empty() && p_tagName[0] == '/'),
+	m_tagAtom(m_isEndTag ? literalAtom(p_tagName.substr(1)) : literalAtom(p_tagName)){};
+
+AttributesHtmlPath::AttributesHtmlPath(const string& p_attrName, const string& p_attrVal)
+	: m_attrName(p_attrName), m_attrVal(p_attrVal),
+	m_attrNameAtom(p_attrName.empty() ? atom::UNKNOWN : literalAtom(p_attrName)){};
+
 //̃pXi1Kw/tagj
 unique_ptr<HtmlPath::HtmlNodePtrs> PathHtmlPath::filter(HtmlNodePtrs& p_nodePtrs){
 	unique_ptr<HtmlNodePtrs> resultNodeVecUptr(new HtmlNodePtrs);
@@ -271,9 +637,7 @@ unique_ptr<HtmlPath::HtmlNodePtrs> PathHtmlPath::filter(HtmlNodePtrs& p_nodePtrs
 		const HtmlNode& node = **i;
 		vector<const HtmlNode*> matchedChildrenNodeList;
 		for(auto j = node.begin(); j != node.end(); ++j){
-			if(wildcardMatch(m_tagName.c_str(), (*j)->tagName().c_str())){
-				matchedChildrenNodeList.push_back(j->get());
-			}
+			if(matchTagName(**j, m_tagName, m_tagAtom, m_isEndTag)) matchedChildrenNodeList.push_back(j->get());
 		}
 		//̃tB^
 		match(*resultNodeVecUptr, matchedChildrenNodeList);
@@ -291,6 +655,34 @@ void PathHtmlPath::match(HtmlNodePtrs& p_retNodePtrs, const vector<const HtmlNod
 	p_retNodePtrs.insert(p_retNodePtrs.end(), resultNodeVecUptr->begin(), resultNodeVecUptr->end());
 }
 
+//̌₩A[g̎qm[h filter() ꍇƓʂ
+const bool PathHtmlPath::filterDescendantsByIndex(const HtmlNodeIndex& p_index, HtmlNodePtrs& p_result)const{
+	const HtmlNodeIndex::Nodes* candidates = nullptr;
+	if(m_tagAtom != atom::UNKNOWN) candidates = &p_index.byTag(m_tagAtom);
+	//ŏ̏qꂪ̎w̏ꍇȀȂgȉq͑Ɉvm[hɂKpj
+	const AttributesHtmlPath* attrPath = m_htmlPathUptrList.empty() ? nullptr : dynamic_cast<const AttributesHtmlPath*>(m_htmlPathUptrList.front().get());
+	if(attrPath != nullptr){
+		const HtmlNodeIndex::Nodes* attrCandidates = attrPath->candidates(p_index);
+		if(attrCandidates != nullptr && (candidates == nullptr || attrCandidates->size() < candidates->size())) candidates = attrCandidates;
+	}
+	if(candidates == nullptr) return false;
+	// filter() ͐em[hƁiem[h̍sjɎqm[hqɂ̂ŁAem[hƂɂ܂Ƃ߂
+	vector<std::pair<std::size_t, const HtmlNode*>> byParent;
+	for(auto i = candidates->begin(); i != candidates->end(); ++i){
+		if(matchTagName(**i, m_tagName, m_tagAtom, m_isEndTag)) byParent.push_back(std::make_pair((*i)->parent()->order(), *i));
+	}
+	std::stable_sort(byParent.begin(), byParent.end(),
+		[](const std::pair<std::size_t, const HtmlNode*>& p_a, const std::pair<std::size_t, const HtmlNode*>& p_b){ return p_a.first < p_b.first; });
+	vector<const HtmlNode*> children;
+	for(auto i = byParent.begin(); i != byParent.end(); ++i){
+		children.push_back(i->second);
+		if(i + 1 == byParent.end() || (i + 1)->first != i->first){
+			match(p_result, children);
+			children.clear();
+		}
+	}
+	return true;
+};
 
 //vfԍ̎wBtagname[n]
 unique_ptr<HtmlPath::HtmlNodePtrs> PositionHtmlPath::filter(HtmlNodePtrs& p_nodePtrs){
@@ -302,64 +694,407 @@ unique_ptr<HtmlPath::HtmlNodePtrs> PositionHtmlPath::filter(HtmlNodePtrs& p_node
 };
 
 
-
 //w
 unique_ptr<HtmlPath::HtmlNodePtrs> AttributesHtmlPath::filter(HtmlNodePtrs& p_nodePtrs){
 	unique_ptr<HtmlNodePtrs> resultNodeVecUptr(new HtmlNodePtrs);
 	for(auto i = p_nodePtrs.begin(); i != p_nodePtrs.end(); ++i){
-		const HtmlPart* startTagPartsP = (*i)->startTag();
-		if(startTagPartsP == nullptr) continue;
-		unique_ptr<vector<const string*>> keyPVecUptr = startTagPartsP->attrNames();
-		//L[̒Ɏw̃L[ƒl݂邩`FbN
-		for(auto j = keyPVecUptr->begin(); j != keyPVecUptr->end(); ++j){
-			if(!m_attrName.empty()){
-				if(!wildcardMatch(m_attrName.c_str(), (*j)->c_str())) continue;
-			}
-			if(!m_attrVal.empty()){
-				const string& attrVal = startTagPartsP->attr((**j), 0);
-				if(!wildcardMatch(m_attrVal.c_str(), attrVal.c_str())) continue;
-			}
-			//w̃L[Al}b`ꍇ
-			resultNodeVecUptr->push_back(*i);
-			break;
-		}
+		if(matchAttr(**i, m_attrName, m_attrNameAtom, m_attrVal)) resultNodeVecUptr->push_back(*i);
 	}
 	return move(resultNodeVecUptr);
 };
 
+//ChJ[hłȂΑ̍AidAclass̒lChJ[hłȂΒl̍g
+const HtmlNodeIndex::Nodes* AttributesHtmlPath::candidates(const HtmlNodeIndex& p_index)const{
+	static const Atom idAtom = atom::intern("id"), classAtom = atom::intern("class");
+	if(m_attrNameAtom == atom::UNKNOWN) return nullptr;
+	if(!m_attrVal.empty() && isLiteral(m_attrVal)){
+		if(m_attrNameAtom == idAtom) return &p_index.byId(m_attrVal);
+		if(m_attrNameAtom == classAtom && m_attrVal.find_first_of(" \t\r\n\f") == string::npos) return &p_index.byClass(m_attrVal);
+	}
+	return &p_index.byAttrName(m_attrNameAtom);
+};
 
 //q̃^Oi//Descendant or selfj
+namespace{
+
+///p_node̎ɍsŒHm[hBԍp_last𒴂ꍇnullptr
+const HtmlNode* nextInSubtree(const HtmlNode* p_node, const std::size_t p_last){
+	if(p_node->order() >= p_last) return nullptr;
+	if(!p_node->childNodeList().empty()) return p_node->childNodeList().front().get();
+	//qȂ΁ǍZ킪鏊܂ŐeHiZ͔ԍɕłj
+	for(;;){
+		const HtmlNode::NodeUptrs& siblings = p_node->parent()->childNodeList();
+		const std::size_t order = p_node->order();
+		auto ite = std::partition_point(siblings.begin(), siblings.end(),
+			[order](const HtmlNode::NodeUptr& p_sibling){ return p_sibling->order() <= order; });
+		if(ite != siblings.end()) return ite->get();
+		p_node = p_node->parent();
+	}
+}
+
+/**
+p_node̕؂ɍs̔ԍtĂ邩B
+ HtmlNode ̃RXgN^ appendChild() ō؂͔ԍȂiׂ0ĵŁAq̂ɔԍ͈̔͂ɂȂB
+*/
+const bool isNumbered(const HtmlNode& p_node){
+	const HtmlNode::NodeUptrs& children = p_node.childNodeList();
+	return children.empty() || (p_node.order() < p_node.lastOrder() && children.back()->lastOrder() == p_node.lastOrder());
+}
+
+///ԍtĂȂ؂AX^bNgčsɒHp_retɒǉiǉς݂̃m[h͕؂Ɣ΂j
+void appendPreorder(const HtmlNode& p_node, HtmlPath::HtmlNodePtrs& p_ret, std::unordered_set<const HtmlNode*>& p_added){
+	vector<const HtmlNode*> stack(1, &p_node);
+	while(!stack.empty()){
+		const HtmlNode* node = stack.back();
+		stack.pop_back();
+		if(!p_added.insert(node).second) continue;
+		p_ret.push_back(node);
+		const HtmlNode::NodeUptrs& children = node->childNodeList();
+		for(auto i = children.rbegin(); i != children.rend(); ++i) stack.push_back(i->get());
+	}
+}
+
+}//namespace{
+
+//g̃m[h܂߂Ĕz̃m[hׂĕԂB؂͔ԍAĂ̂ŁAdȂ͔ԍ͈̔͂ŏ
 unique_ptr<HtmlPath::HtmlNodePtrs> DescendantsHtmlPath::filter(HtmlNodePtrs& p_nodePtrs){
-	std::map<const HtmlNode*, int> alreadyRegNodeMap;
+	if(!std::all_of(p_nodePtrs.begin(), p_nodePtrs.end(), [](const HtmlNode* p_node){ return isNumbered(*p_node); })){
+		//ԍȂꍇ́Aw̏ԂɒH
+		unique_ptr<HtmlNodePtrs> vecUptr(new HtmlNodePtrs);
+		std::unordered_set<const HtmlNode*> added;
+		for(auto i = p_nodePtrs.begin(); i != p_nodePtrs.end(); ++i) appendPreorder(**i, *vecUptr, added);
+		return vecUptr;
+	}
+	auto byOrder = [](const HtmlNode* p_a, const HtmlNode* p_b){ return p_a->order() < p_b->order(); };
+	HtmlNodePtrs sorted;
+	const HtmlNodePtrs* inputs = &p_nodePtrs;
+	if(!std::is_sorted(p_nodePtrs.begin(), p_nodePtrs.end(), byOrder)){
+		sorted = p_nodePtrs;
+		std::stable_sort(sorted.begin(), sorted.end(), byOrder);
+		inputs = &sorted;
+	}
+	//̃m[h̔zɂm[h͏
+	HtmlNodePtrs roots;
+	std::size_t total = 0;
+	for(auto i = inputs->begin(); i != inputs->end(); ++i){
+		if(!roots.empty() && roots.back()->contains(**i)) continue;
+		roots.push_back(*i);
+		total += (*i)->lastOrder() - (*i)->order() + 1;
+	}
 	unique_ptr<HtmlNodePtrs> vecUptr(new HtmlNodePtrs);
-	_filter(*vecUptr, p_nodePtrs, alreadyRegNodeMap);
+	vecUptr->reserve(total);
+	for(auto i = roots.begin(); i != roots.end(); ++i){
+		const std::size_t last = (*i)->lastOrder();
+		for(const HtmlNode* node = *i; node != nullptr; node = nextInSubtree(node, last)) vecUptr->push_back(node);
+	}
 	return move(vecUptr);
 };
 
-//g̃m[h܂߂Ĕz̃m[hׂp_retNodePtrsɐݒ肷
-void DescendantsHtmlPath::_filter(HtmlNodePtrs& p_retNodePtrs, const HtmlNodePtrs& p_nodePtrs, std::map<const HtmlNode*, int>& p_alreadyRegNodeMap){
-	unique_ptr<HtmlNodePtrs> resultNodeVecUptr(new HtmlNodePtrs);
-	for(auto i = p_nodePtrs.begin(); i != p_nodePtrs.end(); ++i){
-		const HtmlNode& curNode = **i;
-		//go^
-		if(p_alreadyRegNodeMap.find(&curNode) == p_alreadyRegNodeMap.end()){
-			p_retNodePtrs.push_back(&curNode);
-			p_alreadyRegNodeMap[&curNode] = 1;
+
+
+//------------------------------------
+//XPathǂ̕RpCpX
+HtmlPathPlan::HtmlPathPlan(const string& p_path)
+	: m_path(p_path), m_posCnt(0), m_descendantMask(0){
+	parse();
+};
+
+namespace{
+
+///pX̏G[
+std::runtime_error pathError(const string& p_path, const std::size_t p_pos, const char* p_msg){
+	return std::runtime_error("HtmlPathPlan: " + string(p_msg) + " at " + std::to_string(p_pos) + " in \"" + p_path + "\"");
+}
+
+///p_endŝꂩ̑̕O܂œǂݍށi\̎͂̂̕܂ܓǂݍށj
+string readUntil(const string& p_path, std::size_t& p_pos, const char* p_ends){
+	const std::size_t start = p_pos;
+	while(p_pos < p_path.size() && std::strchr(p_ends, p_path[p_pos]) == nullptr){
+		if(p_path[p_pos] == '\\' && p_pos + 1 < p_path.size()) ++p_pos;
+		++p_pos;
+	}
+	return p_path.substr(start, p_pos - start);
+}
+
+}//namespace{
+
+void HtmlPathPlan::parse(){
+	const string& path = m_path;
+	std::size_t i = 0;
+	if(path.empty()) throw pathError(path, 0, "empty path");
+	while(i < path.size()){
+		if(path[i] != '/') throw pathError(path, i, "'/' expected");
+		if(m_steps.size() == MAX_STEPS) throw pathError(path, i, "too many steps");
+		Step step;
+		++i;
+		if(i < path.size() && path[i] == '/'){
+			step.isDescendant = true;
+			++i;
 		}
+		step.tagName = readUntil(path, i, "/[");
+		if(step.tagName.empty()) throw pathError(path, i, "tag name expected");
+		step.tagAtom = literalAtom(step.tagName);
+		//q
+		while(i < path.size() && path[i] == '['){
+			++i;
+			Pred pred;
+			if(i < path.size() && path[i] == '@'){
+				++i;
+				pred.name = readUntil(path, i, "=]");
+				if(pred.name.empty()) throw pathError(path, i, "attribute name expected");
+				pred.nameAtom = literalAtom(pred.name);
+				if(i < path.size() && path[i] == '='){
+					++i;
+					if(i < path.size() && (path[i] == '\'' || path[i] == '"')){
+						const char quote[] = {path[i], '\0'};
+						++i;
+						pred.value = readUntil(path, i, quote);
+						if(i == path.size()) throw pathError(path, i, "unterminated attribute value");
+						++i;
+					} else{
+						pred.value = readUntil(path, i, "]");
+					}
+				}
+			} else{
+				const std::size_t start = i;
+				while(i < path.size() && '0' <= path[i] && path[i] <= '9') pred.pos = pred.pos * 10 + (path[i++] - '0');
+				if(i == start || pred.pos == 0) throw pathError(path, start, "position (1 or more) or '@' expected");
+				pred.isPos = true;
+				pred.slot = m_posCnt++;
+			}
+			if(i == path.size() || path[i] != ']') throw pathError(path, i, "']' expected");
+			++i;
+			step.preds.push_back(pred);
+		}
+		if(step.isDescendant) m_descendantMask |= std::uint64_t(1) << m_steps.size();
+		m_steps.push_back(step);
+	}
+};
+
+//m[hXebvɈv邩Bvfԍ́A܂ł̏qɈvZm[h̐Ŕ肷
+const bool HtmlPathPlan::matchStep(const Step& p_step, const HtmlNode& p_node, std::size_t* p_counters)const{
+	if(!matchTagName(p_node, p_step.tagName, p_step.tagAtom, false)) return false;
+	for(auto i = p_step.preds.begin(); i != p_step.preds.end(); ++i){
+		if(i->isPos){
+			if(++p_counters[i->slot] != i->pos) return false;
+		} else if(!matchAttr(p_node, i->name, i->nameAtom, i->value)){
+			return false;
+		}
+	}
+	return true;
+};
+
+unique_ptr<HtmlPathPlan::HtmlNodePtrs> HtmlPathPlan::exec(const HtmlNode& p_node)const{
+	unique_ptr<HtmlNodePtrs> resultNodePtrsUptr(new HtmlNodePtrs);
+	Workspace workspace;
+	exec(p_node, *resultNodePtrsUptr, workspace);
+	return resultNodePtrsUptr;
+};
+
+void HtmlPathPlan::exec(const HtmlNode& p_node, HtmlNodePtrs& p_result, Workspace& p_workspace)const{
+	typedef Workspace::Frame Frame;
+	vector<Frame>& frames = p_workspace.m_frames;
+	vector<std::size_t>& counters = p_workspace.m_counters;
+	const std::size_t lastStep = m_steps.size() - 1;
+	//N_̃m[hŏ̃Xebv𒲂ׂBċAɍsŒH
+	frames.clear();
+	frames.push_back(Frame(&p_node, 1, 1 & m_descendantMask));
+	counters.assign(m_posCnt, 0);
+	while(!frames.empty()){
+		Frame& frame = frames.back();
+		if(frame.next == frame.node->end()){
+			frames.pop_back();
+			continue;
+		}
+		const HtmlNode& child = **(frame.next++);
+		const std::uint64_t candidates = frame.context | frame.descendant;
+		std::size_t* frameCounters = counters.data() + (frames.size() - 1) * m_posCnt;
+		std::uint64_t context = 0;
+		bool matched = false;
+		for(std::size_t s = 0; s <= lastStep && (candidates >> s) != 0; ++s){
+			if(((candidates >> s) & 1) == 0) continue;
+			if(!matchStep(m_steps[s], child, frameCounters)) continue;
+			if(s == lastStep) matched = true;
+			else context |= std::uint64_t(1) << (s + 1);
+		}
+		if(matched) p_result.push_back(&child);
+		//ׂXebvcĂꍇqm[hH
+		const std::uint64_t descendant = frame.descendant | (context & m_descendantMask);
+		if((context | descendant) != 0 && !child.childNodeList().empty()){
+			frames.push_back(Frame(&child, context, descendant));
+			counters.resize(frames.size() * m_posCnt);
+			std::fill(counters.end() - m_posCnt, counters.end(), 0);
+		}
+	}
+};
+
+
+//------------------------------------
+//m[h̊Kw炸ɁAp[XɃpX]nh
+const std::size_t HtmlPathStreamHandler::addQuery(const HtmlPathPlan& p_plan, const std::size_t p_limit){
+	m_queries.push_back(Query(p_plan, p_limit, m_posCnt));
+	m_posCnt += p_plan.m_posCnt;
+	return m_queries.size() - 1;
+};
+
+void HtmlPathStreamHandler::start(){
+	m_finished = false;
+	m_frameAtoms.clear();
+	m_masks.clear();
+	m_counters.clear();
+	m_stockTagCnt.clear();
+	m_localAtoms.clear();
+	m_captures.clear();
+	for(auto i = m_queries.begin(); i != m_queries.end(); ++i) i->matches.clear();
+};
+
+void HtmlPathStreamHandler::text(const std::string& p_str, const long p_line, const long p_pos){
+	if(m_finished) return;
+	pushRoot(TextHtmlPart(StrView(p_str), p_line, p_pos));
+	for(auto i = m_captures.begin(); i != m_captures.end(); ++i) m_queries[i->query].matches[i->match].text += p_str;
+};
+
+void HtmlPathStreamHandler::comment(const std::string& p_str, const long p_line, const long p_pos){
+	if(m_finished) return;
+	pushRoot(CommentHtmlPart(StrView(p_str), p_line, p_pos));
+};
+
+void HtmlPathStreamHandler::notEnd(const std::string& p_str, const long p_line, const long p_pos){
+	if(m_finished) return;
+	const NotEndHtmlPart part(StrView(p_str), p_line, p_pos);
+	pushRoot(part);
+	pushNode(&part, nullptr, false);
+};
+
+//SẴNG𖞂Ap[Tɑ~߂悤v
+void HtmlPathStreamHandler::tag(const std::string& p_str, const long p_line, const long p_pos){
+	pushTag(p_str, p_line, p_pos);
+	if(satisfied()) requestStop();
+};
+
+// HtmlNodeBuilder::push() ƓKŃm[hɁAm[h𒲂ׂ
+void HtmlPathStreamHandler::pushTag(const std::string& p_str, const long p_line, const long p_pos){
+	if(m_finished) return;
+	if(isDeclaration(p_str)){
+		pushRoot(DeclarationHtmlPart(StrView(p_str), p_line, p_pos));
+		return;
+	}
+	const TagHtmlPart part(StrView(p_str), p_line, p_pos);
+	pushRoot(part);
+	if(p_str[p_str.size() - 2] == '/' || isNotClosedTag(part)){
+		//P^OAȂĂ^Ȍꍇ
+		pushNode(&part, &part, false);
+		return;
+	}
+	if(!part.isEndTag()){
+		pushNode(&part, nullptr, true);
+		if(m_policy == HtmlNodeBuilder::SAME_TAG_MATCH) ++m_stockTagCnt[tagKey(part)];
+		return;
+	}
+	const Atom frameAtom = m_frameAtoms.back();
+	const Atom key = tagKey(part);
+	bool close = false;
+	if(m_policy == HtmlNodeBuilder::HIERARCHY_MATCH){
+		close = frameAtom != atom::EMPTY && key == frameAtom;
+	} else{
+		auto ite = m_stockTagCnt.find(key);
+		if(ite == m_stockTagCnt.end() || ite->second == 0){
+			pushNode(nullptr, &part, false);
+			return;
+		}
+		--ite->second;
+		close = frameAtom == key;
+	}
+	if(!close){
+		if(m_policy == HtmlNodeBuilder::HIERARCHY_MATCH) pushNode(nullptr, &part, false);
+	} else if(m_frameAtoms.size() == 1){
+		m_finished = true;
+	} else{
+		popFrame();
+	}
+};
+
+void HtmlPathStreamHandler::pushRoot(const HtmlPart& p_part){
+	if(!m_frameAtoms.empty()) return;
+	//[gm[h̎qm[hAeNG̍ŏ̃Xebv𒲂ׂ
+	m_nodeMasks.clear();
+	for(auto i = m_queries.begin(); i != m_queries.end(); ++i){
+		m_nodeMasks.push_back(1);
+		m_nodeMasks.push_back(1 & i->plan->m_descendantMask);
+	}
+	pushFrame(m_localAtoms.intern(p_part.tagName()));
+};
 
-		//gԉ̃^ȌꍇÃm[h
-		if(curNode.childNodeList().size() == 0) continue;
+// HtmlNodeBuilder::tagKey() Ɠ
+const Atom HtmlPathStreamHandler::tagKey(const HtmlPart& p_part){
+	if(p_part.tagAtom() != atom::UNKNOWN) return p_part.tagAtom();
+	const string& name = p_part.tagName();
+	const std::size_t skip = p_part.isEndTag() ? 1 : 0;
+	return m_localAtoms.intern(name.data() + skip, name.size() - skip);
+}
 
-		//q̔zAfilterɂ
-		unique_ptr<HtmlNodePtrs> childNodeVecUptr(new HtmlNodePtrs);
-		for(auto j = curNode.begin(); j != curNode.end(); ++j){
-			const HtmlNode& childNode = **j;
-			childNodeVecUptr->push_back(&childNode);
+// HtmlPathPlan::exec() Ŏqm[h𒲂ׂ̂Ɠ
+void HtmlPathStreamHandler::pushNode(const HtmlPart* p_start, const HtmlPart* p_end, const bool p_open){
+	const HtmlNode node(p_start, p_end, nullptr);
+	const std::size_t depth = m_frameAtoms.size() - 1;
+	const std::size_t queryCnt = m_queries.size();
+	const std::uint64_t* masks = m_masks.data() + depth * 2 * queryCnt;
+	std::size_t* counters = m_counters.data() + depth * m_posCnt;
+	m_nodeMasks.assign(2 * queryCnt, 0);
+	for(std::size_t q = 0; q < queryCnt; ++q){
+		Query& query = m_queries[q];
+		if(query.limit != 0 && query.matches.size() >= query.limit) continue;
+		const HtmlPathPlan& plan = *query.plan;
+		const std::size_t lastStep = plan.m_steps.size() - 1;
+		const std::uint64_t candidates = masks[2 * q] | masks[2 * q + 1];
+		std::uint64_t context = 0;
+		bool matched = false;
+		for(std::size_t s = 0; s <= lastStep && (candidates >> s) != 0; ++s){
+			if(((candidates >> s) & 1) == 0) continue;
+			if(!plan.matchStep(plan.m_steps[s], node, counters + query.posBegin)) continue;
+			if(s == lastStep) matched = true;
+			else context |= std::uint64_t(1) << (s + 1);
 		}
-		_filter(p_retNodePtrs, *childNodeVecUptr, p_alreadyRegNodeMap);
+		if(matched){
+			const HtmlPart& first = (p_start != nullptr) ? *p_start : *p_end;
+			HtmlDocument::HtmlPartUptr partUptr;
+			if(first.type() == HtmlPart::NOT_END) partUptr.reset(new NotEndHtmlPart(first.view().str(), first.lineNum(), first.posNum()));
+			else partUptr.reset(new TagHtmlPart(first.view().str(), first.lineNum(), first.posNum()));
+			query.matches.push_back(Match(move(partUptr)));
+			if(p_open) m_captures.push_back(Capture(depth + 1, q, query.matches.size() - 1));
+		}
+		m_nodeMasks[2 * q] = context;
+		m_nodeMasks[2 * q + 1] = masks[2 * q + 1] | (context & plan.m_descendantMask);
+	}
+	if(p_open) pushFrame(tagKey(*p_start));
+};
+
+void HtmlPathStreamHandler::pushFrame(const Atom p_startTagAtom){
+	m_frameAtoms.push_back(p_startTagAtom);
+	m_masks.insert(m_masks.end(), m_nodeMasks.begin(), m_nodeMasks.end());
+	m_counters.resize(m_counters.size() + m_posCnt, 0);
+};
+
+void HtmlPathStreamHandler::popFrame(){
+	const std::size_t depth = m_frameAtoms.size() - 1;
+	while(!m_captures.empty() && m_captures.back().depth == depth) m_captures.pop_back();
+	m_frameAtoms.pop_back();
+	m_masks.resize(m_masks.size() - 2 * m_queries.size());
+	m_counters.resize(m_counters.size() - m_posCnt);
+};
+
+const bool HtmlPathStreamHandler::satisfied()const{
+	if(m_finished) return true;
+	if(!m_captures.empty()) return false;
+	for(auto i = m_queries.begin(); i != m_queries.end(); ++i){
+		if(i->limit == 0 || i->matches.size() < i->limit) return false;
 	}
+	return true;
 };
 
+const bool HtmlPathStreamHandler::parse(HtmlSaxParser& p_parser, const char* p_data, const std::size_t p_size){
+	return !p_parser.parse(p_data, p_size, *this);
+};
 
 
 //------------------------------------
@@ -382,6 +1117,19 @@ unique_ptr<HtmlPath::HtmlNodePtrs> HtmlPathExecutor::exec(const HtmlNodePtrs& p_
 	return move(resultNodePtrsUptr);
 };
 
+//[gm[hɎsB//tagn܂ꍇ͍g
+unique_ptr<HtmlPath::HtmlNodePtrs> HtmlPathExecutor::exec(const HtmlDocument& p_doc)const{
+	if(m_htmlPathVec.size() < 2 || dynamic_cast<const DescendantsHtmlPath*>(m_htmlPathVec[0].get()) == nullptr) return exec(p_doc.rootNode());
+	const PathHtmlPath* tagPath = dynamic_cast<const PathHtmlPath*>(m_htmlPathVec[1].get());
+	if(tagPath == nullptr) return exec(p_doc.rootNode());
+	unique_ptr<HtmlNodePtrs> resultNodePtrsUptr(new HtmlNodePtrs);
+	if(!tagPath->filterDescendantsByIndex(p_doc.index(), *resultNodePtrsUptr)) return exec(p_doc.rootNode());
+	for(auto i = m_htmlPathVec.begin() + 2; i != m_htmlPathVec.end(); ++i){
+		resultNodePtrsUptr = (*i)->filter(*resultNodePtrsUptr);
+	}
+	return resultNodePtrsUptr;
+};
+
 //ŃpXRɒǉ
 HtmlPathExecutor& HtmlPathExecutor::add(HtmlPath* p_path){
 	m_htmlPathVec.push_back(unique_ptr<HtmlPath>(p_path));
@@ -19,14 +19,18 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <memory>
 #include <cstring>
 #include <cstdlib>
 #include <exception>
+#include <cstdint>
 
 
 #include "html_element.hpp"
+#include "html_file.hpp"
+#include "html_charset.hpp"
 
 
 namespace nana{
@@ -48,6 +52,10 @@ using std::unique_ptr;
 const bool forwardMatch(const string& targetStr, const string& searchStr);
 
 const bool backwardMatch(const string& targetStr, const string& searchStr);
+/**
+ChJ[hi*0ȏA?1A\̎͂̂̕܂ܔrjŕŜrB
+p^[*̐ɂ炸Ap^[~񒷂ɔႷ鎞ԂŏIB
+*/
 const bool wildcardMatch(const char *ptn, const char *str);
 
 
@@ -84,16 +92,268 @@ HTML
 */
 void analyzeHtmlNodeBySameTagMatch(HtmlNode& p_ret, const HtmlDocument::HtmlPartUptrs& p_allDocParts);
 
+
+/**
+@brief ^O1󂯎ăm[h̊Kw쐬B analyzeHtmlNode() A analyzeHtmlNodeBySameTagMatch() ƓʂɂȂB
+ċAĂяoɊJĂm[hX^bNŊǗ̂ŁAKw̐[̗̓ʂŐB
+m[hɂ͍쐬ɍs̔ԍi HtmlNode::order() jtAijɊJĂm[h͔jj
+qm[h̍Ō̔ԍi HtmlNode::lastOrder() jtB
+jɊJĂm[hɏނ̂ŁA[g̃m[hiƂ̎qjɔj邱ƁB
+*/
+class HtmlNodeBuilder : noncopyable{
+public:
+	///͎@
+	enum Policy {
+		/**ԓ̊Jn^O܂őĂ@i analyzeHtmlNode() j*/HIERARCHY_MATCH,
+		/**^OǂŏoɃ}b`@i analyzeHtmlNodeBySameTagMatch() j*/SAME_TAG_MATCH };
+	/**
+	@param p_root [out]̃m[hɌʂǉ
+	@param p_policy [in]͎@
+	*/
+	HtmlNodeBuilder(HtmlNode& p_root, const Policy p_policy)
+		: m_root(p_root), m_policy(p_policy), m_finished(false), m_nextOrder(1){ p_root.setOrder(0); };
+	/**
+	Jn^Om[h̎qm[h蒼ꍇɎgBp_rootStartTag^O[g̕^OɂȂB
+	 HIERARCHY_MATCH ̏ꍇAp_root̊Jn^O̎̃^O push() ƁAŜ͂ꍇƓqm[hɂȂB
+	qm[h̔ԍp_root̔ԍ瑱ĕt̂ŁAqm[h̐ςꍇ͌ɑm[h̔ԍ炷ƁB
+	@param p_rootStartTag [in]p_root̊Jn^O
+	*/
+	HtmlNodeBuilder(HtmlNode& p_root, const Policy p_policy, const HtmlPart& p_rootStartTag)
+		: m_root(p_root), m_policy(p_policy), m_finished(false), m_nextOrder(p_root.order() + 1){
+		m_frames.push_back(Frame(&p_root, tagKey(p_rootStartTag)));
+	};
+	///JĂm[hɎqm[h̍Ō̔ԍt
+	~HtmlNodeBuilder();
+	/**
+	^OǉBHTMLLq̏ԒʂɌĂяoƁBŏ̃^Õ^O^O[g̕^OɂȂB
+	@param p_part [in]^OBm[hQƂ̂ŁAm[h蒷݂ȂƂȂB
+	*/
+	void push(const HtmlPart& p_part);
+	/**
+	쐬ȂeLXgi HtmlDocument::DROP_WHITESPACE ŏ󔒂̃eLXgjm点B
+	ŏ̃^Ȍꍇ́AeLXg push() ꍇƓ[g̕^OȂ̂ƂB
+	*/
+	void skipText(){ if(m_frames.empty()) m_frames.push_back(Frame(&m_root, atom::EMPTY)); };
+	///[g̕^O͂Iǐ push() ^O͖j
+	const bool finished()const{ return m_finished; };
+	///JĂiI^OĂȂjm[h̐[
+	const std::size_t depth()const{ return m_frames.empty() ? 0 : m_frames.size() - 1; };
+private:
+	void endTagByHierarchy(const HtmlPart& p_part);
+	void endTagBySameTag(const HtmlPart& p_part);
+	///^Or邽߂ Atom iI^O͐擪/OBWȊO̖O m_localAtoms Ŋ蓖Ăj
+	const Atom tagKey(const HtmlPart& p_part);
+	///ԍtqm[h쐬
+	HtmlNode::NodeUptr newNode(const HtmlNode& p_parent, const HtmlPart* p_start, const HtmlPart* p_end);
+	///ԏ̊JĂm[h
+	void popFrame();
+	///JĂm[hƁÅJn^Oi tagKey() j
+	struct Frame{
+		Frame(HtmlNode* p_node, const Atom p_startTagAtom): node(p_node), startTagAtom(p_startTagAtom){};
+		HtmlNode* node;
+		Atom startTagAtom;
+	};
+	HtmlNode& m_root;
+	const Policy m_policy;
+	bool m_finished;
+	std::size_t m_nextOrder;//ɍ쐬m[h̔ԍ
+	vector<Frame> m_frames;
+	///^OƂ́AI^OĂȂJn^Õm[hi SAME_TAG_MATCH Ŏgpj
+	std::unordered_map<Atom, vector<HtmlNode*>> m_stockTagMap;
+	///WȊÕ^O Atom ĩr_[̒Ŏgj
+	atom::LocalAtomTable m_localAtoms;
+};
+
 /**
 @brief HTML͂A HtmlDocument 쐬ĕԂHTMLp[TnhB
-@see analyzeHtmlNode
+^O󂯎邽тɃm[h̊Kw쐬̂ŁAp[XI_Ńm[h̊KwłĂB
+@see HtmlNodeBuilder
 */
 class DocumentHtmlSaxParserHandler :public SimpleHtmlSaxParserHandler {
 public:
-	DocumentHtmlSaxParserHandler(){};
+	/**
+	@param p_ownership [in] HtmlDocument::ARENA ̏ꍇA^Oƃm[h HtmlDocument A[iɍ쐬
+	@param p_policy [in]m[h̊Kw͎̉@
+	*/
+	explicit DocumentHtmlSaxParserHandler(const HtmlDocument::Ownership p_ownership = HtmlDocument::HEAP,
+		const HtmlNodeBuilder::Policy p_policy = HtmlNodeBuilder::HIERARCHY_MATCH)
+		: SimpleHtmlSaxParserHandler(p_ownership), m_policy(p_policy){};
 	virtual ~DocumentHtmlSaxParserHandler(){};
+	virtual void start();
+	virtual void text(const std::string& p_str, const long p_line, const long p_pos){
+		const std::size_t size = resultParts().size();
+		SimpleHtmlSaxParserHandler::text(p_str, p_line, p_pos);
+		//󔒂̃eLXg쐬Ȃꍇ̓m[hȂi[g̕^O̔ɂ͎gj
+		if(resultParts().size() != size) pushLastPart();
+		else m_builderUptr->skipText();
+	};
+	virtual void tag(const std::string& p_str, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserHandler::tag(p_str, p_line, p_pos);
+		pushLastPart();
+	};
+	virtual void comment(const std::string& p_str, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserHandler::comment(p_str, p_line, p_pos);
+		pushLastPart();
+	};
+	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserHandler::notEnd(p_str, p_line, p_pos);
+		pushLastPart();
+	};
 	//p[Xʂ擾BsOʎ擾nullptrԂB
 	unique_ptr<HtmlDocument> result();
+	///m[h̊Kw͎̉@
+	const HtmlNodeBuilder::Policy policy()const{ return m_policy; };
+private:
+	///ǉ^OŃm[h̊KwXV
+	void pushLastPart(){ if(!m_builderUptr->finished()) m_builderUptr->push(*resultParts().back()); };
+	const HtmlNodeBuilder::Policy m_policy;
+	HtmlNode::NodeUptr m_rootNodeUptr;
+	unique_ptr<HtmlNodeBuilder> m_builderUptr;//m_rootNodeUptrQƂ
+};
+
+/**
+@brief HTML͂A̓obt@QƂ HtmlDocument 쐬ĕԂHTMLp[TnhB
+̓obt@ HtmlDocument 蒷݂邩A HtmlDocument::holdSource() ŕێ邱ƁB
+m[h̊Kw DocumentHtmlSaxParserHandler ƓlɃ^O󂯎邽тɍ쐬B
+@see HtmlNodeBuilder
+*/
+class DocumentHtmlSaxParserViewHandler :public SimpleHtmlSaxParserViewHandler {
+public:
+	/**
+	@param p_ownership [in] HtmlDocument::ARENA ̏ꍇA^Oƃm[h HtmlDocument A[iɍ쐬
+	@param p_policy [in]m[h̊Kw͎̉@
+	*/
+	explicit DocumentHtmlSaxParserViewHandler(const HtmlDocument::Ownership p_ownership = HtmlDocument::HEAP,
+		const HtmlNodeBuilder::Policy p_policy = HtmlNodeBuilder::HIERARCHY_MATCH)
+		: SimpleHtmlSaxParserViewHandler(p_ownership), m_policy(p_policy){};
+	virtual ~DocumentHtmlSaxParserViewHandler(){};
+	virtual void start();
+	virtual void text(const StrView& p_view, const long p_line, const long p_pos){
+		const std::size_t size = resultParts().size();
+		SimpleHtmlSaxParserViewHandler::text(p_view, p_line, p_pos);
+		//󔒂̃eLXg쐬Ȃꍇ̓m[hȂi[g̕^O̔ɂ͎gj
+		if(resultParts().size() != size) pushLastPart();
+		else m_builderUptr->skipText();
+	};
+	virtual void tag(const StrView& p_view, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserViewHandler::tag(p_view, p_line, p_pos);
+		pushLastPart();
+	};
+	virtual void comment(const StrView& p_view, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserViewHandler::comment(p_view, p_line, p_pos);
+		pushLastPart();
+	};
+	virtual void notEnd(const StrView& p_view, const long p_line, const long p_pos){
+		SimpleHtmlSaxParserViewHandler::notEnd(p_view, p_line, p_pos);
+		pushLastPart();
+	};
+	//p[Xʂ擾BsOʎ擾nullptrԂB
+	unique_ptr<HtmlDocument> result();
+	///m[h̊Kw͎̉@
+	const HtmlNodeBuilder::Policy policy()const{ return m_policy; };
+private:
+	///ǉ^OŃm[h̊KwXV
+	void pushLastPart(){ if(!m_builderUptr->finished()) m_builderUptr->push(*resultParts().back()); };
+	const HtmlNodeBuilder::Policy m_policy;
+	HtmlNode::NodeUptr m_rootNodeUptr;
+	unique_ptr<HtmlNodeBuilder> m_builderUptr;//m_rootNodeUptrQƂ
+};
+
+
+/**
+t@C}bvA̓Xg[g킸Ƀp[XB
+ HtmlPart ̓}bsO𒼐ڎQƂA}bsO͕Ԃ HtmlDocument j܂ŕێi HtmlDocument::holdSource() jB
+@param p_path [in]HTMLt@C̃pX
+@param p_handler [in]p[XɎgnhi̊mە@Am[h͎̉@w肵́j
+@param p_advice [in]y[W̓ǂݍݕ̃qg
+@throw std::runtime_error t@CJȂA}bvłȂꍇ
+*/
+unique_ptr<HtmlDocument> parseHtmlFile(const string& p_path, DocumentHtmlSaxParserViewHandler& p_handler,
+	const MappedFile::Advice p_advice = MappedFile::SEQUENTIAL);
+///JĂt@CfBXNv^̓e}bvăp[Xip_fd͕ȂjB
+unique_ptr<HtmlDocument> parseHtmlFile(const int p_fd, DocumentHtmlSaxParserViewHandler& p_handler,
+	const MappedFile::Advice p_advice = MappedFile::SEQUENTIAL);
+/**
+t@C}bvăp[XB HtmlPart ͕Rs[̂ŁA}bsO̓p[XɉB
+@throw std::runtime_error t@CJȂA}bvłȂꍇ
+*/
+unique_ptr<HtmlDocument> parseHtmlFile(const string& p_path, DocumentHtmlSaxParserHandler& p_handler,
+	const MappedFile::Advice p_advice = MappedFile::SEQUENTIAL);
+///JĂt@CfBXNv^̓e}bvăp[Xip_fd͕ȂjB
+unique_ptr<HtmlDocument> parseHtmlFile(const int p_fd, DocumentHtmlSaxParserHandler& p_handler,
+	const MappedFile::Advice p_advice = MappedFile::SEQUENTIAL);
+/**
+R[h𔻒肵UTF-8ɂĂi charset::toUtf8() jp[XBŜ܂Ƃ߂1񂾂ϊB
+ϊꍇ́AϊԂ HtmlDocument ɕێi HtmlDocument::holdSource() jB
+ϊȂiUTF-8AASCIÍjꍇ HtmlPart p_dataQƂ̂ŁAp_data HtmlDocument 蒷݂ȂƂȂB
+@param p_charset [in,out] charset::toUtf8() Ɠi charset::UNKNOWN ̏ꍇ͔肵R[hݒ肷j
+*/
+unique_ptr<HtmlDocument> parseHtmlAsUtf8(const char* p_data, const std::size_t p_size, DocumentHtmlSaxParserViewHandler& p_handler,
+	charset::Charset& p_charset);
+
+
+/**
+@brief HTMLҏWAҏW͈͂͂ HtmlDocument XVNXB
+<pre>
+EҏWʒuO̍Ō̓_i^OARg̒j瑖ĊJAҏWOƓ_ɖ߂ƂŎ~߂B
+@ȍ~̃^O͍sEʒu炵Ďg񂷁B
+Em[h̊KẃAҏW͈͂܂ވԓ̕m[h̎qm[h蒼B
+@I^ȎΉςꍇ͊Õm[hō蒼AłȂꍇ͑Ŝ蒼B
+@ SAME_TAG_MATCH ͗ꂽ^OǂΉ̂ŁAɑŜ蒼B
+</pre>
+ʂ͕ҏW͈͂̑傫Ō܂邪Ã^O̍sEʒû炵ƃ^O̔z̋lߒ̓^O̐ɔႷB
+^O͕Rs[Ďi HtmlDocument::HEAP jB
+*/
+class HtmlDocumentEditor : noncopyable{
+public:
+	///O replace() ̏
+	struct EditStats{
+		EditStats(): scannedBytes(0), reparsedParts(0), removedParts(0), rebuiltParts(0), fullRebuild(false){};
+		std::size_t scannedBytes;//oCg
+		std::size_t reparsedParts;//č쐬^O̐
+		std::size_t removedParts;//jҏWÕ^O̐
+		std::size_t rebuiltParts;//m[h̊Kw̍蒼ŏ^O̐
+		bool fullRebuild;//m[h̊KwŜō蒼
+	};
+	/**
+	@param p_html [in]ҏWHTML
+	@param p_policy [in]m[h̊Kw͎̉@
+	*/
+	explicit HtmlDocumentEditor(const string& p_html, const HtmlNodeBuilder::Policy p_policy = HtmlNodeBuilder::HIERARCHY_MATCH);
+	/**
+	p_beginp_sizeoCgp_textɒuA document() XVB
+	ҏW͈͂ɂ HtmlPart ƁA蒼m[h͔jB
+	@param p_begin [in]uʒui source() ̐擪̃oCgj
+	@param p_size [in]uoCgi0̏ꍇ͑}j
+	@param p_text [in]u镶ȉꍇ͍폜j
+	@throw std::out_of_range ͈͂ source() ̊Ȍꍇ
+	*/
+	void replace(const std::size_t p_begin, const std::size_t p_size, const string& p_text);
+	///ҏWHTML
+	const string& source()const{ return m_source; };
+	///ҏWHTML͂
+	const HtmlDocument& document()const{ return *m_docUptr; };
+	///O replace() ̏
+	const EditStats& lastStats()const{ return m_stats; };
+	///m[h̊Kw͎̉@
+	const HtmlNodeBuilder::Policy policy()const{ return m_policy; };
+private:
+	///ҏW͈͂܂ޕm[hƁÅJnEI^O̔ԍ
+	struct Enclosing{
+		Enclosing(HtmlNode* p_node, const std::size_t p_start, const std::size_t p_end): node(p_node), start(p_start), end(p_end){};
+		HtmlNode* node;
+		std::size_t start, end;
+	};
+	const std::size_t partIndex(const HtmlPart* p_part)const;
+	vector<Enclosing> enclosingNodes(const std::size_t p_first, const std::size_t p_last)const;
+	const bool rebuildChildren(HtmlNode& p_node, const std::size_t p_start, const std::size_t p_end);
+	void rebuildAll();
+	string m_source;
+	const HtmlNodeBuilder::Policy m_policy;
+	HtmlSaxParser m_parser;
+	unique_ptr<HtmlDocument> m_docUptr;
+	vector<std::size_t> m_offsets;//^OƂ́A source() ̐擪̃oCg
+	EditStats m_stats;
 };
 
 
@@ -125,11 +385,17 @@ public:
 	};
 protected:
 	void _access(const HtmlNode& p_node, HtmlNodeAccessor& p_accessor){
-		//[gm[hȊȌꍇ
-		if(!(p_node.startTag() == nullptr && p_node.endTag() == nullptr))
-			p_accessor.access(p_node);
-		for(auto i = p_node.begin(); i != p_node.end(); ++i){
-			_access(**i, p_accessor);
+		//[KwłX^bNg؂Ȃ悤ɁAċAɍsŖK₷
+		vector<const HtmlNode*> stack(1, &p_node);
+		while(!stack.empty()){
+			const HtmlNode& node = *stack.back();
+			stack.pop_back();
+			//[gm[hȊȌꍇ
+			if(!(node.startTag() == nullptr && node.endTag() == nullptr))
+				p_accessor.access(node);
+			for(auto i = node.childNodeList().rbegin(); i != node.childNodeList().rend(); ++i){
+				stack.push_back(i->get());
+			}
 		}
 	};
 };
@@ -178,6 +444,7 @@ public:
 		m_nonClosedResult.reset(new SearchResults);
 		m_alternatedResult.reset(new SearchResults);
 		m_stockMap.clear();
+		m_localAtoms.clear();
 	};
 	///ĂȂ^O̒o
 	SearchResultsUptr nonClosedResult();
@@ -186,7 +453,8 @@ public:
 private:
 	SearchResultsUptr m_nonClosedResult;
 	SearchResultsUptr m_alternatedResult;
-	std::map<std::string, std::vector<const HtmlNode*>> m_stockMap;
+	std::unordered_map<Atom, std::vector<const HtmlNode*>> m_stockMap;
+	atom::LocalAtomTable m_localAtoms;//WȊÕ^O Atom
 };
 
 /**
@@ -198,7 +466,7 @@ public:
 	typedef unique_ptr<SearchResults> SearchResultsUptr;
 	virtual ~DeprecatedInHtml5Accessor(){};
 	virtual void access(const HtmlNode& p_node){
-		if(s_deprecatedTagMap.find(p_node.tagName()) != s_deprecatedTagMap.end()){
+		if(!p_node.isEndTag() && s_deprecatedTags.contains(p_node.tagAtom())){
 			m_result->push_back(&p_node);
 		}
 	};
@@ -210,7 +478,7 @@ public:
 	};
 private:
 	SearchResultsUptr m_result;
-	static const std::map<std::string, int> s_deprecatedTagMap;
+	static const atom::AtomSet s_deprecatedTags;
 };
 
 
@@ -223,7 +491,8 @@ public:
 	typedef unique_ptr<SearchResults> SearchResultsUptr;
 	virtual ~ImgAltAccessor(){};
 	virtual void access(const HtmlNode& p_node){
-		if(p_node.tagName() != "img") return;
+		static const Atom imgAtom = atom::intern("img");
+		if(p_node.tagAtom() != imgAtom || p_node.isEndTag()) return;
 		if(p_node.startTag() == nullptr) return; 
 		if(!p_node.startTag()->hasAttr("alt", 0)){
 			//alt݂Ȃꍇ
@@ -261,9 +530,9 @@ namespace path{
 	class PathHtmlPath :public HtmlPath{
 	public:
 		/**
-		@param p_tagName [in]^OChJ[hŎw
+		@param p_tagName [in]^OChJ[hŎwiChJ[h܂܂Ȃꍇ Atom Ŕrj
 		*/
-		PathHtmlPath(const string& p_tagName):m_tagName(p_tagName){};
+		PathHtmlPath(const string& p_tagName);
 		virtual ~PathHtmlPath(){};
 		/**
 		@param p_htmlPath [in]q(pred)w
@@ -273,12 +542,20 @@ namespace path{
 			return this;
 		};
 		virtual unique_ptr<HtmlNodePtrs> filter(HtmlNodePtrs& p_nodePVec);
+		/**
+		gA[g̎qm[hi//jɑ΂ filter() ꍇƓʂ𓯂Ԃ p_result ɒǉB
+		^Oŏ̏q̑ŌîŁAԂ͌̐ɔႷB
+		@return gȂiChJ[h̃^OŁAŏ̏qꂪ̎włȂjꍇfalse
+		*/
+		const bool filterDescendantsByIndex(const HtmlNodeIndex& p_index, HtmlNodePtrs& p_result)const;
 	protected:
 		///tB^ʂretVecɒǉ
 		void match(HtmlNodePtrs& retVec, const vector<const HtmlNode*>& p_matchedChildrenNodeList)const;
 	private:
 		vector<unique_ptr<HtmlPath>> m_htmlPathUptrList;
 		const string m_tagName;
+		const bool m_isEndTag;//^O/Ŏn܂邩
+		const Atom m_tagAtom;///^O Atom iChJ[h܂ޏꍇAWȊO̖Ȍꍇ atom::UNKNOWN j
 	};
 
 	/**
@@ -299,29 +576,201 @@ namespace path{
 	class AttributesHtmlPath :public HtmlPath{
 	public:
 		///ChJ[hŎw肷
-		AttributesHtmlPath(const string& p_attrName, const string& p_attrVal)
-			:  m_attrName(p_attrName), m_attrVal(p_attrVal){};
+		AttributesHtmlPath(const string& p_attrName, const string& p_attrVal);
 		///
 		virtual unique_ptr<HtmlNodePtrs> filter(HtmlNodePtrs& p_nodePVec);
+		///v\̂m[higȂꍇnullptrj
+		const HtmlNodeIndex::Nodes* candidates(const HtmlNodeIndex& p_index)const;
 	private:
 		const string m_attrName;
 		const string m_attrVal;
+		const Atom m_attrNameAtom;// Atom iChJ[h܂ޏꍇA󕶎̏ꍇAWȊO̖Ȍꍇ atom::UNKNOWN j
 	};
 
 	/**
 	@brief q̃^Oi//Descendant or selfjBC[ẂA//tagname
+	m[h̍s̔ԍi HtmlNode::order() jgĒHBԍ̂Ȃ؁i HtmlNode::appendChild() ō؂Ȃǁj̓X^bNŒHB
 	*/
 	class DescendantsHtmlPath :public HtmlPath{
 	public:
 		DescendantsHtmlPath(){};
-		///
+		/**
+		g̃m[h܂߂Ĕz̃m[hׂāAdȂɕ̏ԁisjŕԂB
+		 HtmlNode::order() ͈̔͂ŏdȂ𔻒肷̂ŁAp_nodePVec͓؂̃m[hł邱ƁB
+		*/
 		virtual unique_ptr<HtmlNodePtrs> filter(HtmlNodePtrs& p_nodePVec);
-	protected:
-		///g̃m[h܂߂Ĕz̃m[hׂresultɐݒ肷
-		void _filter(HtmlNodePtrs& p_result, const HtmlNodePtrs& p_nodePVec, std::map<const HtmlNode*, int>& p_alreadyRegNodeMap);
 	private:
 	};
 	
+	//------------------------------------
+	/**
+	@brief XPathǂ̕RpCpXBxRpC΁AxłsłB
+	<pre>
+	yz
+	@/tag            qm[hi HtmlPathExecutor::tag() j
+	@//tag           qm[hi HtmlPathExecutor::slash2().tag() j
+	@[@name='value'] ̎wi HtmlPathExecutor::predAttr() jBl"ł͂߂B='value'ȗƑ邩
+	@[n]             vfԍ̎wi HtmlPathExecutor::predPos() jBXPathƓ1琔
+	@^OAA̒l̓ChJ[hi*A?A\jŎwłB
+	yz//div[@class='item*']/a[2]
+	</pre>
+	؂1񑖍邾őSẴXebv]Brʂ̔z͍炸Aǂ̃XebvɂȂ؂͒HȂB
+	ʂ͓w HtmlPathExecutor Ɠm[hȀԁisjɕԂB
+	 exec() ̓IuWFNgύXȂ̂ŁÃXbhŋLłB
+	*/
+	class HtmlPathPlan : noncopyable{
+	public:
+		typedef HtmlPath::HtmlNodePtrs HtmlNodePtrs;
+		///Xebv̍ő吔
+		static const std::size_t MAX_STEPS = 64;
+		/// exec() ̍Ɨ̈BXbhƂɗpӂAg񂹂 exec() ̓mۂȂB
+		class Workspace : noncopyable{
+		public:
+			Workspace(){};
+		private:
+			friend class HtmlPathPlan;
+			///̃m[hƁÃm[hN_ɂXebv
+			struct Frame{
+				Frame(const HtmlNode* p_node, const std::uint64_t p_context, const std::uint64_t p_descendant)
+					: node(p_node), next(p_node->begin()), context(p_context), descendant(p_descendant){};
+				const HtmlNode* node;
+				HtmlNode::const_iteraotr next;//ɒׂqm[h
+				std::uint64_t context;//qm[h𒲂ׂXebv
+				std::uint64_t descendant;//qm[h𒲂ׂXebvi//j
+			};
+			vector<Frame> m_frames;
+			vector<std::size_t> m_counters;//vfԍ̎w育Ƃ́Aqm[h̐
+		};
+		/**
+		@param p_path [in]pX
+		@throw std::runtime_error Ȃꍇ
+		*/
+		explicit HtmlPathPlan(const string& p_path);
+		///m[hPɎsiʏ̓[gm[hnj
+		unique_ptr<HtmlNodePtrs> exec(const HtmlNode& p_node)const;
+		/**
+		m[hPɎsB
+		@param p_result [out]ʂǉ
+		@param p_workspace [in,out]Ɨ̈
+		*/
+		void exec(const HtmlNode& p_node, HtmlNodePtrs& p_result, Workspace& p_workspace)const;
+		///RpCpX
+		const string& str()const{ return m_path; };
+	private:
+		friend class HtmlPathStreamHandler;
+		///q
+		struct Pred{
+			Pred(): isPos(false), nameAtom(atom::UNKNOWN), pos(0), slot(0){};
+			bool isPos;//vfԍ̎w肩
+			string name;//
+			string value;//̒l
+			Atom nameAtom;// Atom iChJ[h܂ޏꍇA󕶎̏ꍇ atom::UNKNOWN j
+			std::size_t pos;//vfԍi1j
+			std::size_t slot;//vfԍ𐔂ꏊi Workspace::m_counters j
+		};
+		///Xebvi/tag[pred]...j
+		struct Step{
+			Step(): isDescendant(false), tagAtom(atom::UNKNOWN){};
+			bool isDescendant;//qm[hi//j
+			string tagName;
+			Atom tagAtom;//^O Atom iChJ[h܂ޏꍇ atom::UNKNOWN j
+			vector<Pred> preds;
+		};
+		void parse();
+		const bool matchStep(const Step& p_step, const HtmlNode& p_node, std::size_t* p_counters)const;
+		const string m_path;
+		vector<Step> m_steps;
+		std::size_t m_posCnt;//vfԍ̎w̐
+		std::uint64_t m_descendantMask;//qm[hi//j̃Xebv
+	};
+
+	//------------------------------------
+	/**
+	@brief m[h̊Kw炸ɁAp[X HtmlPathPlan ]HTMLp[TnhB
+	 HtmlNodeBuilder ƓKŊJĂvf̃X^bNǗA^O󂯎邽тɊeNG̃Xebv𒲂ׂB
+	vm[h̍ŏ̃^OiJn^OAI^Õm[h͏I^OjRs[AvfJĂԂ̃eLXgAĕێB
+	ʂ͖؂ HtmlPathPlan::exec() Ń[gm[hsꍇƓm[hȀԂŕԂB
+	SẴNG𖞂 requestStop() ĂԂ̂ŁAǂ̃p[Tœǂłő~܂B
+	<pre>
+		HtmlPathPlan title("//title"), desc("//meta[@name='description']");
+		HtmlPathStreamHandler handler;
+		handler.addQuery(title, 1);
+		handler.addQuery(desc, 1);
+		handler.parse(parser, data, size);//_Ŏ~߂
+	</pre>
+	*/
+	class HtmlPathStreamHandler :public HtmlSaxParserHandler{
+	public:
+		///vm[h
+		struct Match{
+			Match(HtmlDocument::HtmlPartUptr&& p_part): part(move(p_part)){};
+			Match(Match&& p_other): part(move(p_other.part)), text(move(p_other.text)){};
+			HtmlDocument::HtmlPartUptr part;//m[h̍ŏ̃^O
+			string text;//vfJĂԂɎ󂯎eLXgiRg͊܂܂Ȃj
+		};
+		typedef vector<Match> Matches;
+		explicit HtmlPathStreamHandler(const HtmlNodeBuilder::Policy p_policy = HtmlNodeBuilder::HIERARCHY_MATCH)
+			: m_policy(p_policy), m_posCnt(0), m_finished(false){};
+		virtual ~HtmlPathStreamHandler(){};
+		/**
+		NGǉBp[Xn߂OɌĂяoƁB
+		@param p_plan [in]spXB̃IuWFNg蒷݂ȂƂȂB
+		@param p_limit [in]̐vAvfNG𖞂Ƃi0̏ꍇ͍Ō܂ŒTj
+		@return NG̔ԍi matches() ̈j
+		*/
+		const std::size_t addQuery(const HtmlPathPlan& p_plan, const std::size_t p_limit = 0);
+		virtual void start();
+		virtual void text(const std::string& p_str, const long p_line, const long p_pos);
+		virtual void tag(const std::string& p_str, const long p_line, const long p_pos);
+		virtual void comment(const std::string& p_str, const long p_line, const long p_pos);
+		virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos);
+		///NGɈvm[h
+		const Matches& matches(const std::size_t p_query)const{ return m_queries.at(p_query).matches; };
+		///SẴNG𖞂i[g̕^Ǒ́Aȏvm[hȂ̂ŖƂj
+		const bool satisfied()const;
+		/**
+		HTMLp[XASẴNG𖞂_Ŏ~߂B
+		@return rŎ~߂ꍇtrue
+		*/
+		const bool parse(HtmlSaxParser& p_parser, const char* p_data, const std::size_t p_size);
+	private:
+		struct Query{
+			Query(const HtmlPathPlan& p_plan, const std::size_t p_limit, const std::size_t p_posBegin)
+				: plan(&p_plan), limit(p_limit), posBegin(p_posBegin){};
+			const HtmlPathPlan* plan;
+			std::size_t limit;
+			std::size_t posBegin;//vfԍ̐𐔂ꏊit[Ƃ m_counters ̒̈ʒuj
+			Matches matches;
+		};
+		///JĂvf̂AeLXgAĂvf
+		struct Capture{
+			Capture(const std::size_t p_depth, const std::size_t p_query, const std::size_t p_match)
+				: depth(p_depth), query(p_query), match(p_match){};
+			std::size_t depth;//vf̃t[̔ԍ
+			std::size_t query, match;//NG̔ԍA Query::matches ̔ԍ
+		};
+		void pushTag(const std::string& p_str, const long p_line, const long p_pos);
+		///ŏ̃^OŁA[g̃t[
+		void pushRoot(const HtmlPart& p_part);
+		///m[heNG̃XebvŒׂBp_opentruȅꍇ͗vfJ
+		void pushNode(const HtmlPart* p_start, const HtmlPart* p_end, const bool p_open);
+		void pushFrame(const Atom p_startTagAtom);
+		void popFrame();
+		///^Or邽߂ Atom i HtmlNodeBuilder::tagKey() Ɠj
+		const Atom tagKey(const HtmlPart& p_part);
+		const HtmlNodeBuilder::Policy m_policy;
+		vector<Query> m_queries;
+		std::size_t m_posCnt;//SẴNG̗vfԍ̎w̐
+		bool m_finished;//[g̕^O󂯎
+		vector<Atom> m_frameAtoms;//JĂvf̊Jn^Oi擪̓[gj
+		vector<std::uint64_t> m_masks;//t[ƁANGƂ́iqm[h𒲂ׂXebv, qm[h𒲂ׂXebvj
+		vector<std::uint64_t> m_nodeMasks;//ׂm[hJꍇ m_masks
+		vector<std::size_t> m_counters;//t[Ƃ̗vfԍ̎w育Ƃ́Aqm[h̐
+		std::unordered_map<Atom, std::size_t> m_stockTagCnt;//^OƂ́AI^OĂȂJn^O̐i SAME_TAG_MATCH Ŏgpj
+		atom::LocalAtomTable m_localAtoms;//WȊÕ^O Atom
+		vector<Capture> m_captures;
+	};
+
 	//------------------------------------
 	/**
 	@brief HtmlpX̎sҁB
@@ -334,6 +783,11 @@ namespace path{
 		unique_ptr<HtmlNodePtrs> exec(const HtmlNode& p_node)const;
 		/** ̃m[hɎsiHtmlPathsʂɃtB^ꍇȂǂɎgpj*/
 		unique_ptr<HtmlNodePtrs> exec(const HtmlNodePtrs& p_nodePtrs)const;
+		/**
+		[gm[hɎsBslash2().tag() n܂ꍇ HtmlDocument::index() gA
+		ŜH炸Ɍ̃m[h𒲂ׂiʂ exec(p_doc.rootNode()) ƓjB
+		*/
+		unique_ptr<HtmlNodePtrs> exec(const HtmlDocument& p_doc)const;
 		/** o^ANZTׂč폜 */
 		void clear(){ m_htmlPathVec.clear(); m_isTag = false; };
 		/** ŃpXRɒǉ */
@@ -0,0 +1,244 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <deque>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "html_atom.hpp"
+
+
+namespace nana{
+
+//PerfectHash-----------------------------------------------
+namespace{
+
+///p_nȏ2ׂ̂
+std::size_t ceilPow2(const std::size_t p_n){
+	std::size_t ret = 1;
+	while(ret < p_n) ret <<= 1;
+	return ret;
+}
+
+}//namespace{
+
+const std::size_t PerfectHash::NOT_FOUND;
+
+std::uint32_t PerfectHash::hash(const char* p_str, const std::size_t p_size, const std::uint32_t p_seed){
+	//FNV-1aɎAʃrbg΂Ȃ悤ɍŌɝa
+	std::uint32_t h = 2166136261u ^ (p_seed * 0x9E3779B9u);
+	for(std::size_t i = 0; i < p_size; ++i){
+		h ^= static_cast<unsigned char>(p_str[i]);
+		h *= 16777619u;
+	}
+	h ^= h >> 15;
+	h *= 0x2C1B3C6Du;
+	h ^= h >> 12;
+	return h;
+}
+
+PerfectHash::PerfectHash(const char* const* p_keys, const std::size_t p_count)
+	: m_keys(p_keys), m_count(p_count), m_sizes(p_count),
+	m_seeds(ceilPow2(p_count / 2 + 1), 0), m_slots(ceilPow2(p_count + 1), NOT_FOUND)
+{
+	for(std::size_t i = 0; i < m_count; ++i) m_sizes[i] = strlen(m_keys[i]);
+	//oPbgɕ
+	const std::size_t bucketMask = m_seeds.size() - 1, slotMask = m_slots.size() - 1;
+	std::vector<std::vector<std::size_t>> buckets(m_seeds.size());
+	for(std::size_t i = 0; i < m_count; ++i){
+		buckets[hash(m_keys[i], m_sizes[i], 0) & bucketMask].push_back(i);
+	}
+	//L[̑oPbgʒu߂
+	std::vector<std::size_t> order(buckets.size());
+	for(std::size_t b = 0; b < order.size(); ++b) order[b] = b;
+	std::stable_sort(order.begin(), order.end(),
+		[&buckets](const std::size_t a, const std::size_t b){ return buckets[a].size() > buckets[b].size(); });
+	std::vector<std::size_t> positions;
+	for(auto b = order.begin(); b != order.end(); ++b){
+		const std::vector<std::size_t>& keys = buckets[*b];
+		if(keys.empty()) break;
+		for(std::uint32_t seed = 1; ; ++seed){
+			if(seed > 10000000) throw std::logic_error("PerfectHash: duplicate keys?");
+			//SẴL[󂢂ĂʒuɓT
+			positions.clear();
+			bool ok = true;
+			for(auto k = keys.begin(); k != keys.end() && ok; ++k){
+				const std::size_t pos = hash(m_keys[*k], m_sizes[*k], seed) & slotMask;
+				ok = m_slots[pos] == NOT_FOUND && std::find(positions.begin(), positions.end(), pos) == positions.end();
+				positions.push_back(pos);
+			}
+			if(!ok) continue;
+			for(std::size_t k = 0; k < keys.size(); ++k) m_slots[positions[k]] = keys[k];
+			m_seeds[*b] = seed;
+			break;
+		}
+	}
+}
+
+const std::size_t PerfectHash::find(const char* p_str, const std::size_t p_size)const{
+	const std::uint32_t seed = m_seeds[hash(p_str, p_size, 0) & (m_seeds.size() - 1)];
+	const std::size_t index = m_slots[hash(p_str, p_size, seed) & (m_slots.size() - 1)];
+	if(index == NOT_FOUND) return NOT_FOUND;
+	if(m_sizes[index] != p_size || memcmp(m_keys[index], p_str, p_size) != 0) return NOT_FOUND;
+	return index;
+}
+
+
+//atom-----------------------------------------------
+namespace atom{
+
+namespace{
+
+///W̃^OƑiY Atom ɂȂB擪͋󕶎 EMPTY j
+const char* const STANDARD_NAMES[] = {
+	"", "a", "abbr", "acronym", "address", "applet", "area", "article", "aside", "audio", "b", "base", "basefont",
+	"bdi", "bdo", "bgsound", "big", "blink", "blockquote", "body", "br", "button", "canvas", "caption", "center",
+	"cite", "code", "col", "colgroup", "data", "datalist", "dd", "del", "details", "dfn", "dialog", "dir", "div",
+	"dl", "dt", "em", "embed", "fieldset", "figcaption", "figure", "font", "footer", "form", "frame", "frameset",
+	"h1", "h2", "h3", "h4", "h5", "h6", "head", "header", "hgroup", "hr", "html", "i", "iframe", "image", "img",
+	"input", "ins", "isindex", "kbd", "keygen", "label", "legend", "li", "link", "listing", "main", "map", "mark",
+	"marquee", "math", "menu", "menuitem", "meta", "meter", "nav", "nobr", "noembed", "noframes", "noscript",
+	"object", "ol", "optgroup", "option", "output", "p", "param", "picture", "plaintext", "pre", "progress", "q",
+	"rb", "rp", "rt", "rtc", "ruby", "s", "samp", "script", "search", "section", "select", "slot", "small",
+	"source", "spacer", "span", "strike", "strong", "style", "sub", "summary", "sup", "svg", "table", "tbody",
+	"td", "template", "textarea", "tfoot", "th", "thead", "time", "title", "tr", "track", "tt", "u", "ul", "var",
+	"video", "wbr", "xmp", "accept", "accept-charset", "accesskey", "action", "align", "alink", "alt", "archive",
+	"aria-describedby", "aria-hidden", "aria-label", "aria-labelledby", "async", "autocomplete", "autofocus",
+	"autoplay", "background", "bgcolor", "border", "cellpadding", "cellspacing", "charset", "checked", "class",
+	"classid", "clear", "codebase", "color", "cols", "colspan", "compact", "content", "contenteditable",
+	"controls", "coords", "crossorigin", "datetime", "decoding", "default", "defer", "dirname", "disabled",
+	"download", "draggable", "enctype", "face", "for", "formaction", "frameborder", "headers", "height", "hidden",
+	"high", "href", "hreflang", "hspace", "http-equiv", "id", "integrity", "ismap", "itemprop", "itemscope",
+	"itemtype", "kind", "lang", "language", "list", "loading", "loop", "low", "marginheight", "marginwidth",
+	"max", "maxlength", "media", "method", "min", "minlength", "multiple", "muted", "name", "nohref", "noresize",
+	"noshade", "nonce", "novalidate", "nowrap", "onblur", "onchange", "onclick", "ondblclick", "onerror",
+	"onfocus", "oninput", "onkeydown", "onkeypress", "onkeyup", "onload", "onmousedown", "onmousemove",
+	"onmouseout", "onmouseover", "onmouseup", "onreset", "onresize", "onscroll", "onselect", "onsubmit",
+	"onunload", "open", "optimum", "pattern", "ping", "placeholder", "poster", "preload", "profile", "property",
+	"readonly", "referrerpolicy", "rel", "required", "rev", "reversed", "role", "rows", "rowspan", "rules",
+	"sandbox", "scheme", "scope", "scrolling", "selected", "shape", "size", "sizes", "spellcheck", "src",
+	"srcdoc", "srclang", "srcset", "standby", "start", "step", "tabindex", "target", "text", "translate", "type",
+	"usemap", "valign", "value", "valuetype", "version", "vlink", "vspace", "width", "wrap", "xmlns"
+};
+const std::size_t STANDARD_COUNT = sizeof(STANDARD_NAMES) / sizeof(STANDARD_NAMES[0]);
+
+///W̖Õe[u
+struct StandardTable{
+	StandardTable(): hash(STANDARD_NAMES, STANDARD_COUNT), names(STANDARD_NAMES, STANDARD_NAMES + STANDARD_COUNT){};
+	const PerfectHash hash;
+	const std::vector<std::string> names;
+};
+
+const StandardTable& standardTable(){
+	static const StandardTable table;
+	return table;
+}
+
+///WȊO̖Oo^e[uiO̎QƂɂȂȂ悤dequeŕێj
+struct DynamicTable{
+	std::mutex mutex;
+	std::unordered_map<std::string, Atom> map;
+	std::deque<std::string> names;
+};
+
+DynamicTable& dynamicTable(){
+	static DynamicTable table;
+	return table;
+}
+
+}//namespace{
+
+const Atom intern(const char* p_str, const std::size_t p_size){
+	const std::size_t index = standardTable().hash.find(p_str, p_size);
+	if(index != PerfectHash::NOT_FOUND) return static_cast<Atom>(index);
+	DynamicTable& table = dynamicTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	std::string str(p_str, p_size);
+	auto i = table.map.find(str);
+	if(i != table.map.end()) return i->second;
+	const Atom ret = static_cast<Atom>(STANDARD_COUNT + table.names.size());
+	table.names.push_back(str);
+	table.map.insert(std::make_pair(str, ret));
+	return ret;
+}
+
+const Atom find(const char* p_str, const std::size_t p_size){
+	const std::size_t index = standardTable().hash.find(p_str, p_size);
+	if(index != PerfectHash::NOT_FOUND) return static_cast<Atom>(index);
+	DynamicTable& table = dynamicTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	auto i = table.map.find(std::string(p_str, p_size));
+	if(i != table.map.end()) return i->second;
+	return UNKNOWN;
+}
+
+const Atom findStandard(const char* p_str, const std::size_t p_size){
+	const std::size_t index = standardTable().hash.find(p_str, p_size);
+	return index != PerfectHash::NOT_FOUND ? static_cast<Atom>(index) : UNKNOWN;
+}
+
+const std::string& name(const Atom p_atom){
+	static const std::string strNull("");
+	if(p_atom < STANDARD_COUNT) return standardTable().names[p_atom];
+	DynamicTable& table = dynamicTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	if(p_atom - STANDARD_COUNT < table.names.size()) return table.names[p_atom - STANDARD_COUNT];
+	return strNull;
+}
+
+const bool isStandard(const Atom p_atom){
+	return p_atom < STANDARD_COUNT;
+}
+
+
+//LocalAtomTable-----------------------------------------------
+const Atom LocalAtomTable::intern(const char* p_str, const std::size_t p_size){
+	const Atom standard = findStandard(p_str, p_size);
+	if(standard != UNKNOWN) return standard;
+	std::string str(p_str, p_size);
+	auto i = m_map.find(str);
+	if(i != m_map.end()) return i->second;
+	if(m_names.size() >= UNKNOWN - LOCAL_BASE) throw std::length_error("LocalAtomTable::intern() : too many names");
+	i = m_map.insert(std::make_pair(std::move(str), static_cast<Atom>(LOCAL_BASE + m_names.size()))).first;
+	m_names.push_back(&i->first);
+	return i->second;
+}
+
+const std::string& LocalAtomTable::name(const Atom p_atom)const{
+	if(p_atom < LOCAL_BASE) return atom::name(p_atom);
+	static const std::string strNull("");
+	if(p_atom - LOCAL_BASE < m_names.size()) return *m_names[p_atom - LOCAL_BASE];
+	return strNull;
+}
+
+void LocalAtomTable::clear(){
+	m_names.clear();
+	m_map.clear();
+}
+
+
+AtomSet::AtomSet(std::initializer_list<const char*> p_names){
+	for(auto i = p_names.begin(); i != p_names.end(); ++i){
+		const Atom a = intern(*i, strlen(*i));
+		if(m_bits.size() <= a) m_bits.resize(a + 1, false);
+		m_bits[a] = true;
+	}
+}
+
+}//namespace atom
+}//namespace nana
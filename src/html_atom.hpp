@@ -0,0 +1,130 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_ATOM_INCLUDED
+#define NANA_HTML_ATOM_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <initializer_list>
+
+
+namespace nana{
+
+/**
+@brief ɍ쐬銮SnbVihash and displacejB쐬ɃL[̒ǉ͂łȂB
+L[ƂɏdȂȂʒuAoPbgƂ̎TČ߂BT͍쐬1񂾂ŁA̓nbV2Ɣr1ɂȂB
+*/
+class PerfectHash{
+public:
+	static const std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+	/**
+	@param p_keys [in]L[̈ꗗi'\0'I[AdȂjB̃IuWFNg蒷݂ȂƂȂB
+	@param p_count [in]L[̐
+	*/
+	PerfectHash(const char* const* p_keys, const std::size_t p_count);
+	///L[̈ʒui쐬̔z̓YjB݂Ȃꍇ NOT_FOUND B
+	const std::size_t find(const char* p_str, const std::size_t p_size)const;
+	///L[̐
+	const std::size_t size()const{ return m_count; };
+private:
+	PerfectHash(const PerfectHash&);
+	PerfectHash& operator=(const PerfectHash&);
+	static std::uint32_t hash(const char* p_str, const std::size_t p_size, const std::uint32_t p_seed);
+	const char* const* m_keys;
+	const std::size_t m_count;
+	std::vector<std::size_t> m_sizes;
+	std::vector<std::uint32_t> m_seeds;//oPbgƂ̎
+	std::vector<std::size_t> m_slots;//ʒuƂ̃L[̓Y
+};
+
+
+///ɂ^OA\
+typedef unsigned int Atom;
+
+/**
+^OAiɂ́j𐮐( Atom )ɂāA̔ȓɐŔrł悤ɂB
+HTML̕W̃^OƑ͊SnbVŌBȊO̖O intern() œIȃe[uɓo^ibNjB
+Iȃe[u̓vȌI܂ŉȂ̂ŁAvO߂閼Oo^邱ƁB
+p[X^OA Atom  findStandard() ŋ߁AWȊO̖O UNKNOWN ɂi͂ɂăe[uȂ悤ɁjB
+WȊO̖Oǂrꍇ́AO̕Ŕr邩 LocalAtomTable gB
+*/
+namespace atom{
+
+///󕶎
+const Atom EMPTY = 0;
+///o^ĂȂOi find() ̌ʁjAp[X^OA̕WȊO̖O
+const Atom UNKNOWN = static_cast<Atom>(-1);
+/// LocalAtomTable 蓖Ă Atom ̍ŏl
+const Atom LOCAL_BASE = static_cast<Atom>(0x80000000u);
+
+///Oo^ Atom Ԃio^ς݂̏ꍇ͂ Atom jBXbhĂяoĂ悢B
+const Atom intern(const char* p_str, const std::size_t p_size);
+inline const Atom intern(const std::string& p_str){ return intern(p_str.data(), p_str.size()); }
+///O Atom ԂBo^ĂȂꍇ UNKNOWN B
+const Atom find(const char* p_str, const std::size_t p_size);
+inline const Atom find(const std::string& p_str){ return find(p_str.data(), p_str.size()); }
+///W̖O Atom ԂBWȊO̖O UNKNOWN ibNAo^ȂBp[XɎgjB
+const Atom findStandard(const char* p_str, const std::size_t p_size);
+inline const Atom findStandard(const std::string& p_str){ return findStandard(p_str.data(), p_str.size()); }
+///Atom ̖O
+const std::string& name(const Atom p_atom);
+///W̃^OA Atom 
+const bool isStandard(const Atom p_atom);
+
+
+/**
+@brief Atom ̏WBrbgzŌB
+*/
+class AtomSet{
+public:
+	///Oo^ďWɂ
+	AtomSet(std::initializer_list<const char*> p_names);
+	///Atom ܂܂邩
+	const bool contains(const Atom p_atom)const{ return p_atom < m_bits.size() && m_bits[p_atom]; };
+private:
+	std::vector<bool> m_bits;
+};
+
+
+/**
+@brief WȊO̖OɁA̕\̒Ŏg Atom 蓖Ă\BbNȂ̂ŁA1̃XbhgƁB
+p[XɕWȊÕ^Or邽߂ɁAp[TnhȂǂ1̃p[X̊Ԃi\ƈꏏɉjB
+W̖O findStandard() Ɠ Atom ԂB蓖Ă Atom  LOCAL_BASE ȏŁA̕\ Atom Ƃ͔rłȂB
+*/
+class LocalAtomTable{
+public:
+	///O Atom ԂiWȊO̖O͏Ɋ蓖Ăj
+	const Atom intern(const char* p_str, const std::size_t p_size);
+	inline const Atom intern(const std::string& p_str){ return intern(p_str.data(), p_str.size()); }
+	///Atom ̖OiW̖OA̕\Ŋ蓖ĂOj
+	const std::string& name(const Atom p_atom)const;
+	///蓖ĂO̐
+	const std::size_t size()const{ return m_names.size(); };
+	///蓖ĂOSč폜
+	void clear();
+private:
+	std::unordered_map<std::string, Atom> m_map;
+	std::vector<const std::string*> m_names;//m_map̃L[ivf̎QƂ͖ɂȂȂj
+};
+
+}//namespace atom
+}//namespace nana
+
+
+#endif  // #ifndef NANA_HTML_ATOM_INCLUDED
@@ -0,0 +1,72 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <stdexcept>
+
+#include "html_batch.hpp"
+
+
+namespace nana{
+
+//HtmlBatchParser-----------------------------------------------
+
+HtmlBatchParser::HtmlBatchParser(const std::size_t p_threadCount, const HtmlDocument::Ownership p_ownership,
+	const HtmlNodeBuilder::Policy p_policy, const MappedFile::Advice p_advice)
+	: m_advice(p_advice), m_pool(p_threadCount){
+	for(std::size_t i = 0; i < m_pool.threadCount(); ++i){
+		m_workers.push_back(unique_ptr<Worker>(new Worker(p_ownership, p_policy)));
+	}
+}
+
+//1̓͂Xbh̃p[TƃnhŃp[X
+unique_ptr<HtmlDocument> HtmlBatchParser::parseOne(const HtmlBatchInput& p_input, Worker& p_worker)const{
+	if(!p_input.isFile()){
+		p_worker.parser.parse(p_input.data, p_input.size, p_worker.handler);
+		return p_worker.handler.result();
+	}
+	std::shared_ptr<const MappedFile> file = std::make_shared<const MappedFile>(p_input.path, m_advice);
+	p_worker.parser.parse(file->data(), file->size(), p_worker.handler);
+	unique_ptr<HtmlDocument> ret = p_worker.handler.result();
+	ret->holdSource(file);
+	return ret;
+}
+
+vector<unique_ptr<HtmlDocument>> HtmlBatchParser::parse(const vector<HtmlBatchInput>& p_inputs){
+	vector<unique_ptr<HtmlDocument>> ret(p_inputs.size());
+	//YƂɕʂ̗vfɏނ̂ŃbN͕sv
+	m_pool.run(p_inputs.size(), [&](const std::size_t p_index, const std::size_t p_worker){
+		ret[p_index] = parseOne(p_inputs[p_index], *m_workers[p_worker]);
+	});
+	return ret;
+}
+
+void HtmlBatchParser::parse(const vector<HtmlBatchInput>& p_inputs, const DocumentCallback& p_callback){
+	m_pool.run(p_inputs.size(), [&](const std::size_t p_index, const std::size_t p_worker){
+		p_callback(p_index, parseOne(p_inputs[p_index], *m_workers[p_worker]));
+	});
+}
+
+void HtmlBatchParser::visit(const vector<HtmlBatchInput>& p_inputs, const VisitCallback& p_callback){
+	m_pool.run(p_inputs.size(), [&](const std::size_t p_index, const std::size_t p_worker){
+		Worker& worker = *m_workers[p_worker];
+		unique_ptr<HtmlDocument> doc = parseOne(p_inputs[p_index], worker);
+		p_callback(p_index, *doc);
+		//A[ĩp[XŎg܂킷
+		worker.handler.reuseArena(HtmlDocument::recycleArena(move(doc)));
+	});
+}
+
+
+} //namespace nana
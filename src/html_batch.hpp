@@ -0,0 +1,115 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_BATCH_INCLUDED
+#define NANA_HTML_BATCH_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+
+#include "html_element.hpp"
+#include "html_analysys.hpp"
+#include "html_file.hpp"
+#include "html_pool.hpp"
+
+
+namespace nana{
+
+/**
+@brief p[X̓́B̃obt@At@C̃pXB
+*/
+struct HtmlBatchInput{
+	///̃obt@B쐬 HtmlDocument ̓obt@QƂ̂ŁAobt@͂蒷݂ȂƂȂB
+	HtmlBatchInput(const char* p_data, const std::size_t p_size): data(p_data), size(p_size), m_isFile(false){};
+	///obt@( std::string )B͍쐬 HtmlDocument 蒷݂ȂƂȂB
+	explicit HtmlBatchInput(const std::string& p_str): data(p_str.data()), size(p_str.size()), m_isFile(false){};
+	///t@CB}bvăp[XA}bsO͍쐬 HtmlDocument ێB
+	static HtmlBatchInput file(const std::string& p_path){
+		HtmlBatchInput ret(nullptr, 0);
+		ret.path = p_path;
+		ret.m_isFile = true;
+		return ret;
+	};
+	///t@Ci file() ō쐬B̃obt@̓t@Cł͂Ȃj
+	const bool isFile()const{ return m_isFile; };
+	const char* data;//obt@it@C̏ꍇ͎gȂj
+	std::size_t size;
+	std::string path;//t@C̃pX
+private:
+	bool m_isFile;
+};
+
+
+/**
+@brief HTML WorkStealingPool ŕɃp[XB
+p[Tƃnh̓XbhƂɍ쐬Ďg܂킷B^O͓͂QƂi DocumentHtmlSaxParserViewHandler jB
+*/
+class HtmlBatchParser : noncopyable{
+public:
+	///쐬 HtmlDocument 󂯎֐iƃXbhɌĂяoj
+	typedef std::function<void(const std::size_t p_index, unique_ptr<HtmlDocument>&& p_doc)> DocumentCallback;
+	///HtmlDocument QƂ֐iƃXbhɌĂяoBĂяo HtmlDocument ͔jj
+	typedef std::function<void(const std::size_t p_index, const HtmlDocument& p_doc)> VisitCallback;
+	/**
+	@param p_threadCount [in]XbhB0̏ꍇCPŨRAB
+	@param p_ownership [in]̊mە@
+	@param p_policy [in]m[h͎̉@
+	@param p_advice [in]t@C}bvꍇ̃y[W̓ǂݍݕ̃qg
+	*/
+	explicit HtmlBatchParser(const std::size_t p_threadCount = 0,
+		const HtmlDocument::Ownership p_ownership = HtmlDocument::HEAP,
+		const HtmlNodeBuilder::Policy p_policy = HtmlNodeBuilder::HIERARCHY_MATCH,
+		const MappedFile::Advice p_advice = MappedFile::SEQUENTIAL);
+	///Xbh
+	const std::size_t threadCount()const{ return m_pool.threadCount(); };
+	/**
+	SĂ̓͂p[XA͂ƓԂŕԂB
+	@throw std::runtime_error t@CJȂꍇȂǁi̓͂̓p[XĂAŏ̗O𓊂j
+	*/
+	vector<unique_ptr<HtmlDocument>> parse(const vector<HtmlBatchInput>& p_inputs);
+	///SĂ̓͂p[XAp[Xp_callbackɓn
+	void parse(const vector<HtmlBatchInput>& p_inputs, const DocumentCallback& p_callback);
+	/**
+	SĂ̓͂p[XAp_callbackŎQƂɔjB
+	 HtmlDocument::ARENA ̏ꍇAA[i̓XbhƂɎg܂킷i HtmlDocument::recycleArena() jB
+	*/
+	void visit(const vector<HtmlBatchInput>& p_inputs, const VisitCallback& p_callback);
+	///󔒂̃eLXg̈ݒ肷i SimpleHtmlSaxParserViewHandler::setWhitespace() jBp[XɌĂяoĂ͂ȂB
+	void setWhitespace(const HtmlDocument::Whitespace p_mode){
+		for(auto i = m_workers.begin(); i != m_workers.end(); ++i) (*i)->handler.setWhitespace(p_mode);
+	};
+private:
+	///XbhƂ̃p[Tƃnh
+	struct Worker{
+		Worker(const HtmlDocument::Ownership p_ownership, const HtmlNodeBuilder::Policy p_policy)
+			: handler(p_ownership, p_policy){};
+		HtmlSaxParser parser;
+		DocumentHtmlSaxParserViewHandler handler;
+	};
+	unique_ptr<HtmlDocument> parseOne(const HtmlBatchInput& p_input, Worker& p_worker)const;
+	const MappedFile::Advice m_advice;
+	WorkStealingPool m_pool;
+	vector<unique_ptr<Worker>> m_workers;
+};
+
+
+} //namespace nana
+
+
+#endif  // #ifndef NANA_HTML_BATCH_INCLUDED
@@ -0,0 +1,128 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_CHARSET_INCLUDED
+#define NANA_HTML_CHARSET_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "html_element.hpp"
+
+
+namespace nana{
+
+/**
+͂̕R[h̔ƁAUTF-8ւ̕ϊBp[X̑OɕŜ܂Ƃ߂ĕϊ邽߂ɎgB
+ϊłȂoCgU+FFFDɂiHTML5̎dlƓAsȕƂ1jB
+VtgJISEUC-JPWindowsiCP932j̑Ή\giNECꕶAIBMg܂ށBEUC-JP̕⏕i0x8FjU+FFFDjB
+*/
+namespace charset{
+
+///R[h
+enum Charset { UNKNOWN, UTF8, SHIFT_JIS, EUC_JP, UTF16LE, UTF16BE, WINDOWS_1252 };
+
+///R[h𔻒肷ۂ <meta charset> T擪̃oCg
+const std::size_t SNIFF_SIZE = 1024;
+
+///R[h̖Oi"UTF-8"A"Shift_JIS"ȂǁB UNKNOWN ͋󕶎j
+const std::string& name(const Charset p_charset);
+/**
+R[h̖Oixj當R[h߂B啶AŐ󔒂͋ʂȂB
+"sjis"A"windows-31j"A"x-euc-jp"A"latin1"Ȃǂ̕ʖgB
+@return ΉĂȂȌꍇ UNKNOWN
+*/
+const Charset fromName(const char* p_name, const std::size_t p_size);
+inline const Charset fromName(const std::string& p_name){ return fromName(p_name.data(), p_name.size()); }
+
+/**
+BOM當R[h𔻒肷B
+@param p_bomSize [out]BOM̃oCgiBOMȂꍇ0j
+@return BOMȂꍇ UNKNOWN
+*/
+const Charset sniffBom(const char* p_data, const std::size_t p_size, std::size_t& p_bomSize);
+/**
+擪 SNIFF_SIZE oCg <meta charset="..."> A <meta http-equiv="Content-Type" content="...; charset=..."> A
+ <?xml encoding="..."?> TĕR[h𔻒肷BUTF-16̎wUTF-8Ƃi܂œǂ߂_ASCII݊̂߁jB
+@return ȂAΉĂȂȌꍇ UNKNOWN
+*/
+const Charset sniffMeta(const char* p_data, const std::size_t p_size);
+/**
+oCg̓e當R[h𐄑BUTF-8ȂUTF-8AłȂ΃VtgJISEUC-JP̂sȃoCg񂪏ȂɂB
+ASCIȈꍇUTF-8ƂB
+*/
+const Charset guess(const char* p_data, const std::size_t p_size);
+///BOMA <meta charset> Ae̐̏ԂŕR[h𔻒肷
+const Charset sniff(const char* p_data, const std::size_t p_size);
+
+/**
+UTF-8؂iASCII scan::findNonAscii() œǂݔ΂jB
+璷ȕ\ATQ[gAU+10FFFF𒴂l͕sƂB
+@return sȃoCg̐擪Bꍇp_data + p_size
+*/
+const char* findInvalidUtf8(const char* p_data, const std::size_t p_size);
+///UTF-8
+inline const bool isValidUtf8(const char* p_data, const std::size_t p_size){ return findInvalidUtf8(p_data, p_size) == p_data + p_size; }
+
+///p_codePointUTF-8ɂp_outɏ݁A񂾌̈ʒuԂiő4oCgj
+inline char* putUtf8(char* p_out, const std::uint32_t p_codePoint){
+	if(p_codePoint < 0x80){
+		*p_out++ = static_cast<char>(p_codePoint);
+	} else if(p_codePoint < 0x800){
+		*p_out++ = static_cast<char>(0xC0 | (p_codePoint >> 6));
+		*p_out++ = static_cast<char>(0x80 | (p_codePoint & 0x3F));
+	} else if(p_codePoint < 0x10000){
+		*p_out++ = static_cast<char>(0xE0 | (p_codePoint >> 12));
+		*p_out++ = static_cast<char>(0x80 | ((p_codePoint >> 6) & 0x3F));
+		*p_out++ = static_cast<char>(0x80 | (p_codePoint & 0x3F));
+	} else{
+		*p_out++ = static_cast<char>(0xF0 | (p_codePoint >> 18));
+		*p_out++ = static_cast<char>(0x80 | ((p_codePoint >> 12) & 0x3F));
+		*p_out++ = static_cast<char>(0x80 | ((p_codePoint >> 6) & 0x3F));
+		*p_out++ = static_cast<char>(0x80 | (p_codePoint & 0x3F));
+	}
+	return p_out;
+}
+
+///Windows-12521oCg̃̕R[h|Cgi entity::decode() ̐lQƂ0x80`0x9Fłgj
+const std::uint32_t fromWindows1252(const unsigned char p_c);
+
+/**
+p_charset[p_begin, p_end)UTF-8ɂāAp_ouťɒǉBBOM͎菜ȂB
+@throw std::invalid_argument p_charset UNKNOWN ̏ꍇ
+*/
+void decode(const char* p_begin, const char* p_end, const Charset p_charset, std::string& p_out);
+
+/**
+R[h𔻒( sniff() )āAUTF-8ɂԂBp[X̑O1񂾂ĂяoB
+UTF-8̏ꍇ͌؂sARs[p_dataiBOMjQƂĕԂB
+ȊȌꍇp_bufɕϊāAp_bufQƂĕԂB
+<pre>
+	charset::Charset cs = charset::UNKNOWN;
+	string buf;
+	const StrView utf8 = charset::toUtf8(data, size, buf, cs);
+	parser.parse(utf8.data(), utf8.size(), handler);
+</pre>
+@param p_buf [out]ϊiϊȂꍇ͕ύXȂj
+@param p_charset [in,out] UNKNOWN ̏ꍇ͔肵R[hݒ肷BȊȌꍇ́ABOMȂ΂̕R[hƂĈ
+*/
+const StrView toUtf8(const char* p_data, const std::size_t p_size, std::string& p_buf, Charset& p_charset);
+
+}//namespace charset
+}//namespace nana
+
+
+#endif  // #ifndef NANA_HTML_CHARSET_INCLUDED
@@ -20,9 +20,13 @@
 #include <memory>
 #include <cstring>
 #include <cstdlib>
+#include <stdexcept>
 
 
 #include "html_element.hpp"
+#include "html_scan.hpp"
+#include "html_entity.hpp"
+#include "html_pool.hpp"
 
 namespace nana {
 
@@ -41,8 +45,7 @@ ASCII form feed (&#x000C;)
 Zero-width space (&#x200B;)
 */
 const bool IsSpace(const char& c){
-	static const std::string space(" \t\n");
-	return space.find_first_of(c) != std::string::npos;
+	return c == ' ' || c == '\t' || c == '\n';
 };
 
 
@@ -50,11 +53,55 @@ const bool IsSpace(const char& c){
 
 
 
-///vf̃^Cv̕\ 
-const std::string& HtmlPart::typeStr() const{
+//MonotonicArena-----------------------------------------------
+MonotonicArena::~MonotonicArena(){
+	for(auto i = m_blocks.begin(); i != m_blocks.end(); ++i) ::operator delete(*i);
+	for(auto i = m_largeBlocks.begin(); i != m_largeBlocks.end(); ++i) ::operator delete(*i);
+}
+
+//蓖Ă̈SĖɂiŏ̃ubN͎̊蓖ĂɎgj
+void MonotonicArena::reset(){
+	for(auto i = m_largeBlocks.begin(); i != m_largeBlocks.end(); ++i) ::operator delete(*i);
+	m_largeBlocks.clear();
+	if(m_blocks.empty()){
+		m_cur = m_end = nullptr;
+	} else{
+		for(auto i = m_blocks.begin() + 1; i != m_blocks.end(); ++i) ::operator delete(*i);
+		m_blocks.resize(1);
+		m_cur = m_blocks[0];
+		m_end = m_cur + m_blockSize;
+	}
+	m_allocatedBytes = 0;
+}
+
+///݂̃ubNɓȂꍇAVubNmۂĊ蓖Ă
+void* MonotonicArena::allocateSlow(const std::size_t p_size, const std::size_t p_align){
+	const std::size_t need = p_size + p_align;
+	if(need > m_blockSize / 4){
+		//傫Ȋ蓖Ă͐p̃ubNɂĩ݂ubN̎c𖳑ʂɂȂj
+		char* block = static_cast<char*>(::operator new(need));
+		m_largeBlocks.push_back(block);
+		m_allocatedBytes += p_size;
+		return block + (p_align - reinterpret_cast<std::size_t>(block) % p_align) % p_align;
+	}
+	m_cur = static_cast<char*>(::operator new(m_blockSize));
+	m_end = m_cur + m_blockSize;
+	m_blocks.push_back(m_cur);
+	return allocateUnlocked(p_size, p_align);
+}
+
+void* MonotonicArena::allocateLocked(const std::size_t p_size, const std::size_t p_align){
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return allocateUnlocked(p_size, p_align);
+}
+
+
+
+///^Cv̕\ 
+const std::string& HtmlPart::typeStr(const Type p_type){
 	static const std::string textStr("TEXT"), tagStr("TAG"), comStr("COMMENT"),
 		docStr("DECLARATION"), hateStr("?");
-	switch(this->type()){
+	switch(p_type){
 	case HtmlPart::TEXT:
 		return textStr;
 	case HtmlPart::TAG:
@@ -71,9 +118,38 @@ const std::string& HtmlPart::typeStr() const{
 
 
 
+//
+std::ostream& operator << (std::ostream& p_os, const StrView& p_view){
+	p_os.write(p_view.data(), p_view.size());
+	return p_os;
+}
+
+
+//^OŜ̕ 
+const std::string& HtmlPart::str() const{
+	if(m_isView){
+		//QƂ݂̂̏ꍇ͏ɃRs[iconstȃIuWFNg𕡐XbhǂłSȂ悤ɂj
+		std::call_once(m_contentOnce, [this](){ m_contentStr.assign(m_view.data(), m_view.size()); });
+	}
+	return m_contentStr;
+};
+
+
+const StrView TextHtmlPart::decoded() const{
+	std::call_once(m_decodeOnce, [this](){
+		const char* begin = view().data();
+		const char* end = begin + view().size();
+		if(!entity::contains(begin, end)) return;
+		m_decodedStrUptr.reset(new string);
+		entity::decode(begin, end, *m_decodedStrUptr, false);
+	});
+	return m_decodedStrUptr ? StrView(*m_decodedStrUptr) : view();
+};
+
+
 //
 std::ostream& operator << (std::ostream& p_os, const HtmlPart& p_htmlParts){
-	p_os << "[" << p_htmlParts.typeStr() << "(" << p_htmlParts.lineNum() << ")]" << p_htmlParts.str();
+	p_os << "[" << p_htmlParts.typeStr() << "(" << p_htmlParts.lineNum() << ")]" << p_htmlParts.view();
 	return p_os;
 }
 
@@ -87,6 +163,36 @@ const std::string& HtmlNode::tagName()const{
 	return m_startTagPartsPtr->tagName();
 };
 //
+HtmlNode::~HtmlNode(){
+	if(m_childNodeUptrs.empty()) return;
+	//qoĂ1jijm[h͎qȂj
+	vector<NodeUptr> pending;
+	for(auto i = m_childNodeUptrs.begin(); i != m_childNodeUptrs.end(); ++i) pending.push_back(move(*i));
+	while(!pending.empty()){
+		NodeUptr nodeUptr(move(pending.back()));
+		pending.pop_back();
+		NodeUptrs& children = nodeUptr->m_childNodeUptrs;
+		for(auto i = children.begin(); i != children.end(); ++i) pending.push_back(move(*i));
+		children.clear();
+	}
+};
+//
+void HtmlNode::replaceChildren(HtmlNode& p_other){
+	//Âqm[h͈ꎞm[hɈڂĔji[؂łċAȂj
+	HtmlNode holder(nullptr, nullptr, nullptr, arena());
+	holder.m_childNodeUptrs.swap(m_childNodeUptrs);
+	m_childNodeUptrs.swap(p_other.m_childNodeUptrs);
+	for(auto i = m_childNodeUptrs.begin(); i != m_childNodeUptrs.end(); ++i) (*i)->m_parentNodePtr = this;
+};
+//
+const Atom HtmlNode::tagAtom()const{
+	static const Atom nullAtom(atom::intern("[nullptr]")), errAtom(atom::intern("[err]"));
+	if(m_startTagPartsPtr == nullptr && m_endTagPartsPtr == nullptr) return nullAtom;
+	if(m_startTagPartsPtr == nullptr) return m_endTagPartsPtr->tagAtom();
+	if(m_startTagPartsPtr->type() == HtmlPart::NOT_END) return errAtom;
+	return m_startTagPartsPtr->tagAtom();
+};
+//
 const std::string HtmlNode::pathStr()const{
 	const HtmlNode* nodeP = this->m_parentNodePtr;
 	if(nodeP == nullptr) return "/";
@@ -120,6 +226,29 @@ std::ostream& operator << (std::ostream& p_os, const HtmlNode& p_htmlNode){
 
 
 //w̃^O͈͌(start  endłȂƂȂ)
+//hLgjAA[iėpłԂɂĕԂ
+unique_ptr<MonotonicArena> HtmlDocument::recycleArena(unique_ptr<HtmlDocument>&& p_doc){
+	unique_ptr<HtmlDocument> doc(move(p_doc));
+	if(!doc) return nullptr;
+	//A[iɔzum[hƃ^Oɔj
+	doc->m_rootNodeUptr.reset();
+	doc->m_stockedPartUptrsUptr.reset();
+	unique_ptr<MonotonicArena> ret(move(doc->m_arenaUptr));
+	doc.reset();
+	if(ret){
+		ret->reset();
+		ret->setSynchronized(false);
+	}
+	return ret;
+}
+
+//m[h̍BŏɌĂяoɍ쐬
+const HtmlNodeIndex& HtmlDocument::index()const{
+	std::lock_guard<std::mutex> lock(m_indexMutex);
+	if(!m_indexUptr) m_indexUptr.reset(new HtmlNodeIndex(*m_rootNodeUptr));
+	return *m_indexUptr;
+}
+
 HtmlDocument::SearchResultsUptr HtmlDocument::range(const HtmlPart* p_start, const HtmlPart* p_end)const{
 	auto i = m_stockedPartUptrsUptr->begin();
 	//Jnʒu܂Ői߂ 
@@ -133,63 +262,178 @@ HtmlDocument::SearchResultsUptr HtmlDocument::range(const HtmlPart* p_start, con
 	return move(htmlElementVecUPtr);
 };
 
+namespace{
+
+///̔zɒǉim[h͑ĒǉȂj
+inline void addIndex(HtmlNodeIndex::Nodes& p_nodes, const HtmlNode* p_node){
+	if(p_nodes.empty() || p_nodes.back() != p_node) p_nodes.push_back(p_node);
+}
+
+}//namespace{
+
+//qm[hsɒHč쐬
+HtmlNodeIndex::HtmlNodeIndex(const HtmlNode& p_root)
+	: m_nodeCount(1){
+	static const Atom idAtom = atom::intern("id"), classAtom = atom::intern("class");
+	vector<const HtmlNode*> stack;
+	for(auto i = p_root.childNodeList().rbegin(); i != p_root.childNodeList().rend(); ++i) stack.push_back(i->get());
+	while(!stack.empty()){
+		const HtmlNode* node = stack.back();
+		stack.pop_back();
+		++m_nodeCount;
+		//WȊO̖Oi atom::UNKNOWN j͍ɂȂ
+		if(node->tagAtom() != atom::UNKNOWN) m_tagMap[node->tagAtom()].push_back(node);
+		if(node->startTag() != nullptr){
+			const HtmlAttrs& attrs = node->startTag()->attrs();
+			for(auto j = attrs.begin(); j != attrs.end(); ++j){
+				if(j->nameAtom != atom::UNKNOWN) addIndex(m_attrNameMap[j->nameAtom], node);
+				if(j->nameAtom == idAtom){
+					addIndex(m_idMap[j->value], node);
+				} else if(j->nameAtom == classAtom){
+					//󔒂ŋ؂lƂɒǉ
+					std::size_t pos = 0;
+					while((pos = j->value.find_first_not_of(" \t\r\n\f", pos)) != string::npos){
+						const std::size_t end = std::min(j->value.find_first_of(" \t\r\n\f", pos), j->value.size());
+						addIndex(m_classMap[j->value.substr(pos, end - pos)], node);
+						pos = end;
+					}
+				}
+			}
+		}
+		for(auto i = node->childNodeList().rbegin(); i != node->childNodeList().rend(); ++i) stack.push_back(i->get());
+	}
+}
+
 static void toLowerCaseStr(string& p_str){
 	transform(p_str.begin(), p_str.end(), p_str.begin(), ::tolower);
 }
 
+/**
+^O[p_begin, p_end)̃^OiBI^O͐擪/܂ށjp_nameɐݒ肷i TagHtmlPart A HtmlPartTableViewHandler ŎgpjB
+@param p_tagAtom [out]^O Atom iI^O͐擪/O Atom BWȊO̖O atom::UNKNOWN j
+@return ^Ǒ̈ʒu
+*/
+static const char* parseTagNameOf(const char* p_begin, const char* p_end, string& p_name, Atom& p_tagAtom){
+	static const scan::ByteSet notTag(" \n\t=>/");
+	//^O(F"<tag")3ڂ^ȌI 
+	const char* p = scan::findFirstOf(std::min(p_begin + 2, p_end), p_end, notTag);
+	p_name.assign(p_begin + 1, p);
+	toLowerCaseStr(p_name);
+	const bool isEndTag = !p_name.empty() && p_name[0] == '/';
+	//WȊO̖O͓o^Ȃi atom::UNKNOWN j
+	p_tagAtom = isEndTag ? atom::findStandard(p_name.data() + 1, p_name.size() - 1) : atom::findStandard(p_name);
+	return p;
+}
+
+const HtmlAttr* TagHtmlPart::findAttr(const HtmlAttrs& p_attrs, const std::string& p_key, const std::size_t p_index){
+	//WȊO̖O͕Ŕr
+	const Atom key = atom::findStandard(p_key);
+	//Ȏ̂Ap_indexԖ
+	std::size_t n = p_index;
+	for(auto i = p_attrs.begin(); i != p_attrs.end(); ++i){
+		if(i->nameAtom != key || (key == atom::UNKNOWN && i->name != p_key)) continue;
+		if(n == 0) return &*i;
+		--n;
+	}
+	return nullptr;
+};
+
 const std::string& TagHtmlPart::attr(const std::string& p_key, const std::size_t p_index)const{
 	static const string strNull("");
-	AttrMap::const_iterator i = m_attrMap.find(p_key);
-	if(i != m_attrMap.end()){
-		if(p_index < (i->second).size()) return (i->second)[p_index];
-		return strNull;
-	}
-	return strNull;
+	ensureAttr();
+	const HtmlAttr* found = findAttr(m_attrs, p_key, p_index);
+	return found != nullptr ? found->value : strNull;
 };
 
 const bool TagHtmlPart::hasAttr(const std::string& p_key, const std::size_t p_index)const{
-	auto i = m_attrMap.find(p_key);
-	if(i != m_attrMap.end()){
-		if(p_index < (i->second).size()) return true;
-		return false;
-	}
-	return false;
+	ensureAttr();
+	return findAttr(m_attrs, p_key, p_index) != nullptr;
 };
 
+const std::string& TagHtmlPart::decodedAttr(const std::string& p_key, const std::size_t p_index)const{
+	static const string strNull("");
+	const HtmlAttr* found = findAttr(decodedAttrs(), p_key, p_index);
+	return found != nullptr ? found->value : strNull;
+};
+
+void TagHtmlPart::ensureDecoded()const{
+	ensureAttr();
+	std::call_once(m_decodeOnce, [this]{
+		//m_attrs͕ςɁA"&"܂ޒlꍇWJꗗʂɍ
+		for(auto i = m_attrs.begin(); i != m_attrs.end(); ++i){
+			const char* begin = i->value.data();
+			if(!entity::contains(begin, begin + i->value.size())) continue;
+			if(!m_decodedAttrsUptr) m_decodedAttrsUptr.reset(new HtmlAttrs(m_attrs));
+			HtmlAttr& decodedAttr = (*m_decodedAttrsUptr)[i - m_attrs.begin()];
+			decodedAttr.value.clear();
+			entity::decode(begin, begin + i->value.size(), decodedAttr.value, true);
+		}
+	});
+}
+
 ///̈ꗗ
 std::unique_ptr<vector<const std::string*>> TagHtmlPart::attrNames()const{
+	ensureAttr();
 	unique_ptr<vector<const std::string*>> keyVecUptr(new vector<const std::string*>);
-	for(auto i = m_attrMap.begin(); i != m_attrMap.end(); ++i) keyVecUptr->push_back(&(i->first));
+	for(auto i = m_attrs.begin(); i != m_attrs.end(); ++i) keyVecUptr->push_back(&(i->name));
+	//Oɂďd
+	std::sort(keyVecUptr->begin(), keyVecUptr->end(),
+		[](const std::string* a, const std::string* b){ return *a < *b; });
+	keyVecUptr->erase(std::unique(keyVecUptr->begin(), keyVecUptr->end(),
+		[](const std::string* a, const std::string* b){ return *a == *b; }), keyVecUptr->end());
 	return move(keyVecUptr);
 
 };
 
-void TagHtmlPart::parseTag(){
+namespace{
+
+///󔒂ł͂Ȃ܂ňʒui߂
+inline const char* skipSpace(const char* p_begin, const char* p_end){
+	while(p_begin != p_end && IsSpace(*p_begin)) ++p_begin;
+	return p_begin;
+}
+
+///ʒu̕iȈꍇ'\0'j
+inline const char charAt(const char* p_pos, const char* p_end){
+	return p_pos == p_end ? '\0' : *p_pos;
+}
+
+}//namespace{
+
+///ǉiȎĂǉj
+void TagHtmlPart::addAttr(const std::string& p_key, const std::string& p_val)const{
+	m_attrs.emplace_back(p_key, p_val, atom::findStandard(p_key));
+}
+
+///^O͂i parseAttr() ŉ͂j
+void TagHtmlPart::parseTagName(){
+	const char* const begin = view().data();
+	const char* const end = begin + view().size();
+	if(begin == end) return;
+	const char* p = parseTagNameOf(begin, end, m_tagName, m_tagAtom);
+	m_isEndTag = !m_tagName.empty() && m_tagName[0] == '/';
+	m_attrPos = p - begin;
+}
+
+///͂i ensureAttr() 1񂾂Ăяoj
+void TagHtmlPart::parseAttr()const{
 	//HTML񒆂ō̈ʒȕԂ\ 
-	enum Status { TAG, NONE, ATTR_KEY, ATTR_VAL };
-	enum Status s = TAG;
-	static const string notTag(" \n\t=>/");
-	static const string notKey(" \n\t=>/");
-	string::const_iterator end = str().end();
-	string::const_iterator p;
+	enum Status { NONE, ATTR_KEY, ATTR_VAL };
+	enum Status s = NONE;
+	static const scan::ByteSet notKey(" \n\t=>/");
+	const char* const begin = view().data();
+	const char* const end = begin + view().size();
+	const char* p;
 	string key, val;
 	//
-	for(string::const_iterator i = str().begin(); i != end; ++i){
+	for(const char* i = begin + m_attrPos; i != end; ++i){
 		switch(s){
-		case TAG:
-			//^O(F"<tag")3ڂ^ȌI 
-			p = find_first_of(i + 2, end, notTag.begin(), notTag.end());
-			m_tagName = string(&(*i) + 1, &(*p) - &(*i) - 1);
-			toLowerCaseStr(m_tagName);
-			s = NONE;
-			i = --p;
-			break;
 		case NONE:
 			//󔒂ł͂Ȃ܂ňʒui߂ 
-			i = find_if(i, end, IsNotSpace);
+			i = skipSpace(i, end);
 			s = NONE;
 			//̊Jn̏ꍇ
-			if(*i != '>' && *i != '/'){
+			if(charAt(i, end) != '>' && charAt(i, end) != '/'){
 				s = ATTR_KEY;
 				--i;
 			}
@@ -197,28 +441,28 @@ void TagHtmlPart::parseTag(){
 		case ATTR_KEY:
 			p = i;
 			//L[ł͂Ȃ܂ňʒui߂ 
-			i = find_first_of(i, end, notKey.begin(), notKey.end());
+			i = scan::findFirstOf(i, end, notKey);
 			//L[擾
-			key = string(p, i);
+			key.assign(p, i);
 			toLowerCaseStr(key);
 			//󔒂ł͂Ȃ܂ňʒui߂ 
-			i = find_if(i, end, IsNotSpace);
+			i = skipSpace(i, end);
 			//Gh̏ꍇ̓L[̂
 			if(i == end || *i == '>' || *i == '/'){
-				m_attrMap[key].push_back("");
+				addAttr(key, "");
 				s = NONE;
 				--i;
 				break;
 			}
 			//CR[邩`FbN
-			if(i != end && *i == '='){
+			if(*i == '='){
 				s = ATTR_VAL;
 				++i;
 				//󔒂ł͂Ȃ܂ňʒui߂ 
-				i = find_if(i, end, IsNotSpace);
+				i = skipSpace(i, end);
 			} else{
 				//L[݂̂̏ꍇ
-				m_attrMap[key].push_back("");
+				addAttr(key, "");
 				s = NONE;
 			}
 			--i;
@@ -226,23 +470,21 @@ void TagHtmlPart::parseTag(){
 		case ATTR_VAL:
 			p = i;
 			if(*i == '"'){
-				++i;
 				//"̈ʒu܂Ői߂
-				i = find(i, end, '"');
-				val = string(++p, i);
+				i = scan::findChar(i + 1, end, '"');
+				val.assign(p + 1, i);
 			} else if(*i == '\''){
-				++i;
 				//'̈ʒu܂Ői߂
-				i = find(i, end, '\'');
-				val = string(++p, i);
+				i = scan::findChar(i + 1, end, '\'');
+				val.assign(p + 1, i);
 			} else {
 				//NH[gȂBlł͂ȂƂ܂Ői߂
-				i = find_first_of(i, end, notKey.begin(), notKey.end());
-				val = string(p, i);
+				i = scan::findFirstOf(i, end, notKey);
+				val.assign(p, i);
 			}
 			if(i == end) --i;
 			//
-			m_attrMap[key].push_back(val);
+			addAttr(key, val);
 			//
 			s = NONE;
 			break;
@@ -252,35 +494,226 @@ void TagHtmlPart::parseTag(){
 
 
 
+///錾idoctypeA?xmlȂǁj
+const bool isDeclaration(const StrView& p_str){
+	//Ȃ̂ŁAdoctype͂肦Ȃ
+	if(p_str.size() < 10) return false;
+	//HŎn܂ꍇ
+	if(p_str[1] == '?') return true;
+	//doctype[]̏ꍇ
+	char lowerStr[11];
+	std::transform(p_str.begin(), p_str.begin() + 9, lowerStr, ::tolower);
+	return strncmp(lowerStr, "<!doctype", 9) == 0 && IsSpace(p_str[9]);
+}
+
+const bool isWhitespace(const StrView& p_str){
+	for(auto i = p_str.begin(); i != p_str.end(); ++i){
+		if(!IsSpace(*i) && *i != '\r' && *i != '\f') return false;
+	}
+	return true;
+}
+
 void SimpleHtmlSaxParserHandler::tag(const std::string& p_str, const long p_line, const long p_pos){
-	unique_ptr<HtmlPart> ptr;
+	HtmlDocument::HtmlPartUptr ptr;
 	//
-	if(p_str.size() < 10){
-		//Ȃ̂ŁAdoctype͂肦Ȃ
+	if(isDeclaration(p_str)){
+		ptr.reset(NewInArena<DeclarationHtmlPart>(arena(), p_str, p_line, p_pos));
+	} else{
 		//ʏ̃^Ȍꍇ
-		ptr.reset(new TagHtmlPart(p_str, p_line, p_pos));
+		ptr.reset(NewInArena<TagHtmlPart>(arena(), p_str, p_line, p_pos, arena()));
+	}
+	m_resultPartsUptrsUptr->push_back(move(ptr));
+};
+
+void SimpleHtmlSaxParserViewHandler::tag(const StrView& p_view, const long p_line, const long p_pos){
+	HtmlDocument::HtmlPartUptr ptr;
+	//
+	if(isDeclaration(p_view)){
+		ptr.reset(NewInArena<DeclarationHtmlPart>(arena(), p_view, p_line, p_pos));
 	} else{
-		char lowerStr[11];
-		transform(p_str.begin(), p_str.begin() + 9, lowerStr, ::tolower);
-		if(p_str[1] == '?'){
-			//HŎn܂ꍇ
-			ptr.reset(new DeclarationHtmlPart(p_str, p_line, p_pos));
-		}else if(strncmp(lowerStr, "<!doctype", 9) == 0 && IsSpace(p_str[9])){
-			//doctype[]̏ꍇ
-			ptr.reset(new DeclarationHtmlPart(p_str, p_line, p_pos));
-		} else{
-			//ʏ̃^Ȍꍇ
-			ptr.reset(new TagHtmlPart(p_str, p_line, p_pos));
-		}
+		//ʏ̃^Ȍꍇ
+		ptr.reset(NewInArena<TagHtmlPart>(arena(), p_view, p_line, p_pos, arena()));
 	}
 	m_resultPartsUptrsUptr->push_back(move(ptr));
 };
 
 
 
+//HtmlPartTable-----------------------------------------------
+const std::string HtmlPartRef::tagName()const{
+	if(type() != HtmlPart::TAG) return string();
+	if(tagAtom() == atom::UNKNOWN){
+		//WȊO̖O͓̓obt@͂
+		string name;
+		Atom a;
+		const StrView v = view();
+		parseTagNameOf(v.data(), v.data() + v.size(), name, a);
+		return name;
+	}
+	const string& name = atom::name(tagAtom());
+	return isEndTag() ? "/" + name : name;
+}
+
+HtmlDocument::HtmlPartUptr HtmlPartRef::part()const{
+	const StrView v = view();
+	const long line = lineNum(), pos = posNum();
+	switch(type()){
+	case HtmlPart::TEXT:
+		return HtmlDocument::HtmlPartUptr(new TextHtmlPart(v, line, pos));
+	case HtmlPart::TAG:
+		return HtmlDocument::HtmlPartUptr(new TagHtmlPart(v, line, pos));
+	case HtmlPart::COMMENT:
+		return HtmlDocument::HtmlPartUptr(new CommentHtmlPart(v, line, pos));
+	case HtmlPart::DECLARATION:
+		return HtmlDocument::HtmlPartUptr(new DeclarationHtmlPart(v, line, pos));
+	default:
+		return HtmlDocument::HtmlPartUptr(new NotEndHtmlPart(v, line, pos));
+	}
+}
+
+const std::size_t HtmlPartTable::memoryBytes()const{
+	return m_types.capacity() * sizeof(std::uint8_t) + m_offsets.capacity() * sizeof(std::size_t) + m_sizes.capacity() * sizeof(std::size_t)
+		+ m_lines.capacity() * sizeof(long) + m_poss.capacity() * sizeof(long) + m_tagAtoms.capacity() * sizeof(Atom);
+}
+
+void HtmlPartTable::reserve(const std::size_t p_count){
+	m_types.reserve(p_count);
+	m_offsets.reserve(p_count);
+	m_sizes.reserve(p_count);
+	m_lines.reserve(p_count);
+	m_poss.reserve(p_count);
+	m_tagAtoms.reserve(p_count);
+}
+
+void HtmlPartTable::clear(const StrView& p_source){
+	m_source = p_source;
+	m_types.clear();
+	m_offsets.clear();
+	m_sizes.clear();
+	m_lines.clear();
+	m_poss.clear();
+	m_tagAtoms.clear();
+}
+
+void HtmlPartTable::push(const HtmlPart::Type p_type, const bool p_isEndTag, const Atom p_tagAtom, const StrView& p_view, const long p_line, const long p_pos){
+	if(p_view.data() < m_source.data() || m_source.data() + m_source.size() < p_view.data() + p_view.size()){
+		throw std::out_of_range("HtmlPartTable::push() : view is out of source");
+	}
+	m_types.push_back(static_cast<std::uint8_t>(p_type | (p_isEndTag ? END_TAG : 0)));
+	m_offsets.push_back(static_cast<std::size_t>(p_view.data() - m_source.data()));
+	m_sizes.push_back(p_view.size());
+	m_lines.push_back(p_line);
+	m_poss.push_back(p_pos);
+	m_tagAtoms.push_back(p_tagAtom);
+}
+
+void HtmlPartTableViewHandler::start(){
+	if(m_spareTableUptr){
+		m_tableUptr = move(m_spareTableUptr);
+		m_tableUptr->clear(m_source);
+	} else{
+		m_tableUptr.reset(new HtmlPartTable(m_source));
+	}
+}
+
+void HtmlPartTableViewHandler::tag(const StrView& p_view, const long p_line, const long p_pos){
+	if(isDeclaration(p_view)){
+		m_tableUptr->push(HtmlPart::DECLARATION, false, atom::EMPTY, p_view, p_line, p_pos);
+		return;
+	}
+	Atom tagAtom = atom::EMPTY;
+	m_tagName.clear();
+	if(!p_view.empty()) parseTagNameOf(p_view.data(), p_view.data() + p_view.size(), m_tagName, tagAtom);
+	const bool isEndTag = !m_tagName.empty() && m_tagName[0] == '/';
+	m_tableUptr->push(HtmlPart::TAG, isEndTag, tagAtom, p_view, p_line, p_pos);
+}
+
+
+
 
 //HtmlSaxParser-----------------------------------------------
 
+namespace{
+
+///e𐶃eLXgƂĈvf̖Oij
+const char* const RAW_TEXT_NAMES[] = {"script", "style", "textarea"};
+
+///p_c^ȌIi󔒁A"/"A">"j
+inline const bool isTagNameEnd(const char p_c){
+	return IsSpace(p_c) || p_c == '/' || p_c == '>';
+}
+
+///[p_str, p_str + p_len)ɂp_lowerɈv邩
+const bool equalsLower(const char* p_str, const char* p_lower, const std::size_t p_len){
+	for(std::size_t k = 0; k < p_len; ++k){
+		if(::tolower(static_cast<unsigned char>(p_str[k])) != p_lower[k]) return false;
+	}
+	return true;
+}
+
+///^O[p_begin, p_end)eLXgvf̊Jn^OiP^OjȂvf̖OAłȂnullptr
+const char* rawTextName(const char* p_begin, const char* p_end){
+	if(p_end - p_begin < 3 || p_end[-1] != '>' || p_end[-2] == '/') return nullptr;
+	const char* nameEnd = p_begin + 1;
+	while(nameEnd != p_end && !isTagNameEnd(*nameEnd)) ++nameEnd;
+	const std::size_t len = static_cast<std::size_t>(nameEnd - p_begin - 1);
+	for(auto name : RAW_TEXT_NAMES){
+		if(len == strlen(name) && equalsLower(p_begin + 1, name, len)) return name;
+	}
+	return nullptr;
+}
+
+/**
+[p_begin, p_end)琶eLXgvfp_namȅI^OTB"<"̌ scan::findChar() iSIMDjōsB
+@return I^O"<"̈ʒuBȂꍇp_end
+*/
+const char* findRawTextEnd(const char* p_begin, const char* p_end, const char* p_name){
+	const std::size_t len = strlen(p_name);
+	for(const char* i = p_begin;; ++i){
+		i = scan::findChar(i, p_end, '<');
+		//"</"AvfA^ȌI1Ȃ΁Aȍ~ɂI^O͂Ȃ
+		if(static_cast<std::size_t>(p_end - i) < len + 3) return p_end;
+		if(i[1] == '/' && equalsLower(i + 2, p_name, len) && isTagNameEnd(i[2 + len])) return i;
+	}
+}
+
+}//namespace{
+
+
+void HtmlSaxParser::parseRawText(istream& p_is, HtmlSaxParserHandler& p_handler, string& p_str, long& p_line, long& p_pos, const char* p_name){
+	const std::size_t len = strlen(p_name);
+	char c;
+	while(p_is.get(c)){
+		++m_pos;
+		if(c == '\n') ++m_line;
+		p_str += c;
+		//"</vf"̌Ƀ^ȌI̕ΏI^O
+		if(p_str.size() < len + 2) continue;
+		const char* tail = p_str.data() + p_str.size() - (len + 2);
+		if(tail[0] != '<' || tail[1] != '/' || !equalsLower(tail + 2, p_name, len)) continue;
+		const int next = p_is.peek();
+		if(next == EOF || !isTagNameEnd(static_cast<char>(next))) continue;
+		//"<"̎"/"͍sEʒuɐȂ
+		--m_pos;
+		string tag(tail, len + 2);
+		p_str.resize(p_str.size() - (len + 2));
+		if(!p_str.empty()){
+			p_handler.text(p_str, p_line, p_pos);
+			p_line = m_line;
+			p_pos = m_pos - static_cast<long>(len);
+		}
+		p_str.swap(tag);
+		if(copyUntilFind(p_str, p_is, '>')){
+			p_handler.tag(p_str, p_line, p_pos);
+		} else{
+			p_handler.notEnd(p_str, p_line, p_pos);
+		}
+		clearStr(p_str, p_line, p_pos);
+		return;
+	}
+}
+
+
 const bool HtmlSaxParser::copyUntilFind(string& p_str, istream& p_is, const char p_targetC){
 	char c;
 	while(p_is.get(c)){
@@ -303,7 +736,7 @@ const bool HtmlSaxParser::copyUntilFindCommentClosed(string& p_str, istream& p_i
 }
 
 
-void HtmlSaxParser::parse(std::istream& p_is, HtmlSaxParserHandler& p_handler){
+const bool HtmlSaxParser::parse(std::istream& p_is, HtmlSaxParserHandler& p_handler){
 	string str("");
 	char c_c2[] = {'\0', '\0', '\0'};//cc2A
 	char &c = c_c2[0]; //c_c21ڂƌт
@@ -313,10 +746,16 @@ void HtmlSaxParser::parse(std::istream& p_is, HtmlSaxParserHandler& p_handler){
 	m_pos = 0;
 
 	//Jn
+	p_handler.clearStop();
 	p_handler.start();
 
 	//[v 
 	while(p_is.get(c)){
+		//^OARg̒i߂񂪂ȂjŒ~̗v𒲂ׂ
+		if(str.empty() && p_handler.stopRequested()){
+			p_is.unget();
+			return false;
+		}
 		++m_pos;
 		if(c == '\n') ++m_line;
 		//
@@ -356,8 +795,10 @@ void HtmlSaxParser::parse(std::istream& p_is, HtmlSaxParserHandler& p_handler){
 			}
 			if(strncmp(str.data(), "<!--", 4) != 0){
 				//Ŏn܂Ă邪Rgł͂Ȃ̂ŁA^OƔf
+				const char* rawName = m_rawText ? rawTextName(str.data(), str.data() + str.size()) : nullptr;
 				p_handler.tag(str, line, pos);
 				clearStr(str, line, pos);
+				if(rawName != nullptr) parseRawText(p_is, p_handler, str, line, pos, rawName);
 				continue;
 			}
 			//Rg̏ꍇBp_stȑI肪Rg̏I肩`FbN
@@ -389,10 +830,633 @@ void HtmlSaxParser::parse(std::istream& p_is, HtmlSaxParserHandler& p_handler){
 	if(!str.empty()){
 		p_handler.text(str, line, pos);
 	}
+	return true;
+};
+
+
+
+namespace{
+
+/**
+@brief HTMLubNPʂőg[NiCUB
+"<"A">"A"-->"̌Ɖs̐グ scan ̊֐iSIMDjōsBsEʒu HtmlSaxParser::parse(std::istream&, HtmlSaxParserHandler&) 
+lɂȂ悤ɌvZi"<"̒1͍sEʒuɐȂjB
+^OiRgj̒ł́AԂ͈ʒu Counters ɂȂi_jB_瑖ĊJƁA擪瑖ꍇƓʂɂȂB
+*/
+class BlockTokenizer{
+public:
+	enum Kind { TEXT, TAG, COMMENT, NOT_END };
+	///sEʒǔvZɎg
+	struct Counters{
+		Counters(): nlCnt(0), skip(0), skipNl(0){};
+		long nlCnt;//s̐
+		long skip, skipNl;//Ȃ̐Ẩs̐
+	};
+	///@param p_rawText [in]HtmlSaxParser::setRawTextElements() ̒l
+	BlockTokenizer(const char* p_data, const std::size_t p_size, const bool p_rawText)
+		: m_data(p_data), m_begin(p_data), m_end(p_data + p_size), m_nlCur(p_data), m_rawText(p_rawText){};
+	/**
+	_p_begin瑖ĊJBsEʒup_data擪ƂČvZB
+	@param p_counters [in]p_datap_begin܂ł Counters
+	*/
+	BlockTokenizer(const char* p_data, const char* p_begin, const char* p_end, const Counters& p_counters, const bool p_rawText)
+		: m_data(p_data), m_begin(p_begin), m_end(p_end), m_nlCur(p_begin), m_counters(p_counters), m_rawText(p_rawText){};
+	/**
+	Ō܂őAg[N邲Ƃ p_sink(, Jn, I, s, ʒu) ĂяoB
+	*/
+	template<class Sink>
+	void run(Sink& p_sink){
+		NoSync noSync;
+		run(p_sink, noSync);
+	};
+	/**
+	Ag[N邲Ƃ p_sink(, Jn, I, s, ʒu) ĂяoB
+	_Ƃ p_onSync(ʒu, Counters) ĂяoAfalseԂΑ~߂B
+	@return Ō܂őꍇtrue
+	*/
+	template<class Sink, class OnSync>
+	const bool run(Sink& p_sink, OnSync& p_onSync){
+		const char* textStart = m_begin;
+		const char* i = m_begin;
+		long line, pos; //g[N̊Jnʒuł̍sAʒu
+		counters(i, line, pos);
+		while(i != m_end){
+			const char* lt = scan::findChar(i, m_end, '<');
+			if(lt == m_end) break;
+			i = lt + 1;
+			//Xg[̏I
+			if(i == m_end) break;
+			//"<"̎1͍sEʒuɐȂ
+			const char c2 = *i++;
+			++m_counters.skip;
+			if(IsSpace(c2)){
+				//"< "̏ꍇA^Oł͂Ȃ̂Ŏɍs
+				if(c2 == '\n') ++m_counters.skipNl;
+				continue;
+			}
+			//߂nhɓn
+			if(textStart != lt){
+				p_sink(TEXT, textStart, lt, line, pos);
+				counters(i, line, pos);
+			}
+			//^ȌIT
+			Kind kind = TAG;
+			const char* gt = scan::findChar(i, m_end, '>');
+			if(gt == m_end){
+				//^ȌIijȂ
+				kind = NOT_END;
+				i = m_end;
+			} else{
+				i = gt + 1;
+				if(i - lt >= 6 && strncmp(lt, "<!--", 4) == 0){
+					//Rg̏ꍇBRg̏I肪܂ŒT
+					kind = COMMENT;
+					while(strncmp(i - 3, "-->", 3) != 0){
+						gt = scan::findChar(i, m_end, '>');
+						if(gt == m_end){
+							kind = NOT_END;
+							i = m_end;
+							break;
+						}
+						i = gt + 1;
+					}
+				}
+			}
+			p_sink(kind, lt, i, line, pos);
+			counters(i, line, pos);
+			textStart = i;
+			if(m_rawText && kind == TAG){
+				const char* rawName = rawTextName(lt, i);
+				if(rawName != nullptr){
+					//I^O̒O܂łeLXgɂie̓r͓_ł͂Ȃj
+					i = findRawTextEnd(i, m_end, rawName);
+					continue;
+				}
+			}
+			if(i != m_end && !p_onSync(i, m_counters)) return false;
+		}
+		//cnhɓn
+		if(textStart != m_end) p_sink(TEXT, textStart, m_end, line, pos);
+		return true;
+	};
+private:
+	struct NoSync{
+		const bool operator()(const char*, const Counters&)const{ return true; };
+	};
+	///p_cur̒O܂œǂݍ񂾎_̍sEʒu
+	void counters(const char* p_cur, long& p_line, long& p_pos){
+		m_counters.nlCnt += static_cast<long>(scan::countChar(m_nlCur, p_cur, '\n'));
+		m_nlCur = p_cur;
+		p_line = 1 + m_counters.nlCnt - m_counters.skipNl;
+		p_pos = static_cast<long>(p_cur - m_data) - m_counters.skip;
+	};
+	const char* const m_data;
+	const char* const m_begin;
+	const char* const m_end;
+	const char* m_nlCur;//s𐔂Iʒu
+	Counters m_counters;//m_nlCur܂ł̉s̐ƁAȂ̐
+	const bool m_rawText;//scriptAstyleAtextarea̓e𐶃eLXgƂĈ
+};
+
+///g[N𕶎ɂ HtmlSaxParserHandler ɓn
+class HandlerSink{
+public:
+	HandlerSink(HtmlSaxParserHandler& p_handler, string& p_buf): m_handler(p_handler), m_buf(p_buf){};
+	void operator()(const BlockTokenizer::Kind p_kind, const char* p_begin, const char* p_end, const long p_line, const long p_pos){
+		m_buf.assign(p_begin, p_end);
+		switch(p_kind){
+		case BlockTokenizer::TEXT:
+			m_handler.text(m_buf, p_line, p_pos);
+			break;
+		case BlockTokenizer::TAG:
+			m_handler.tag(m_buf, p_line, p_pos);
+			break;
+		case BlockTokenizer::COMMENT:
+			m_handler.comment(m_buf, p_line, p_pos);
+			break;
+		case BlockTokenizer::NOT_END:
+			m_handler.notEnd(m_buf, p_line, p_pos);
+			break;
+		}
+	};
+	const bool stopRequested()const{ return m_handler.stopRequested(); };
+private:
+	HtmlSaxParserHandler& m_handler;
+	string& m_buf;
+};
+
+///g[N𕶎̎QƂ̂܂ HtmlSaxParserViewHandler ɓn
+class ViewHandlerSink{
+public:
+	ViewHandlerSink(HtmlSaxParserViewHandler& p_handler): m_handler(p_handler){};
+	void operator()(const BlockTokenizer::Kind p_kind, const char* p_begin, const char* p_end, const long p_line, const long p_pos){
+		const StrView view(p_begin, p_end - p_begin);
+		switch(p_kind){
+		case BlockTokenizer::TEXT:
+			m_handler.text(view, p_line, p_pos);
+			break;
+		case BlockTokenizer::TAG:
+			m_handler.tag(view, p_line, p_pos);
+			break;
+		case BlockTokenizer::COMMENT:
+			m_handler.comment(view, p_line, p_pos);
+			break;
+		case BlockTokenizer::NOT_END:
+			m_handler.notEnd(view, p_line, p_pos);
+			break;
+		}
+	};
+	const bool stopRequested()const{ return m_handler.stopRequested(); };
+private:
+	HtmlSaxParserViewHandler& m_handler;
+};
+
+///_̈ʒu Counters AĊJłʒu
+HtmlSaxParser::SyncPoint toSyncPoint(const char* p_data, const char* p_cur, const BlockTokenizer::Counters& p_counters){
+	HtmlSaxParser::SyncPoint ret;
+	ret.offset = static_cast<std::size_t>(p_cur - p_data);
+	ret.line = 1 + p_counters.nlCnt - p_counters.skipNl;
+	ret.pos = static_cast<long>(ret.offset) - p_counters.skip;
+	return ret;
+}
+
+///nh璆~vꂽA_L^đ~߂
+template<class Sink>
+class StopOnRequest{
+public:
+	StopOnRequest(const Sink& p_sink, const char* p_data, HtmlSaxParser::SyncPoint& p_stoppedAt)
+		: m_sink(p_sink), m_data(p_data), m_stoppedAt(p_stoppedAt){};
+	const bool operator()(const char* p_cur, const BlockTokenizer::Counters& p_counters){
+		if(!m_sink.stopRequested()) return true;
+		m_stoppedAt = toSyncPoint(m_data, p_cur, p_counters);
+		return false;
+	};
+private:
+	const Sink& m_sink;
+	const char* const m_data;
+	HtmlSaxParser::SyncPoint& m_stoppedAt;
+};
+
+
+//񑖍-------------------------------------------------
+///`N𑖍ċL^g[N
+struct ChunkToken{
+	ChunkToken(const BlockTokenizer::Kind p_kind, const char* p_begin, const char* p_end, const long p_line, const long p_pos)
+		: begin(p_begin), end(p_end), line(p_line), pos(p_pos), kind(p_kind){};
+	const char* begin;
+	const char* end;
+	long line, pos;//`N̐擪ɂsEʒu
+	BlockTokenizer::Kind kind;
+};
+
+///`N𑖍̓_
+struct ChunkSyncPoint{
+	ChunkSyncPoint(const char* p_pos, const std::size_t p_tokenCount, const BlockTokenizer::Counters& p_counters)
+		: pos(p_pos), tokenCount(p_tokenCount), counters(p_counters){};
+	const char* pos;
+	std::size_t tokenCount;//_Õg[N̐
+	BlockTokenizer::Counters counters;//`N̐擪̐
+	const bool operator<(const char* p_pos)const{ return pos < p_pos; };
+};
+
+/**
+`NA擪eLXg̓ri^ORg̊OjłƐđʁB
+̃`N̐擪zŏ̓_܂őB
+*/
+struct ChunkResult{
+	ChunkResult(): begin(nullptr), end(nullptr), nlCnt(0), reachedEnd(false){};
+	const char* begin;
+	const char* end;
+	long nlCnt;//[begin, end)̉s̐
+	vector<ChunkToken> tokens;
+	vector<ChunkSyncPoint> syncs;//ʒuB擪̓`N̐擪B
+	bool reachedEnd;//͂̍Ō܂ő
+	///p_pos_
+	const ChunkSyncPoint* findSync(const char* p_pos)const{
+		auto ite = std::lower_bound(syncs.begin(), syncs.end(), p_pos);
+		return ite != syncs.end() && ite->pos == p_pos ? &*ite : nullptr;
+	};
+};
+
+///`Ñg[NL^
+class ChunkRecordSink{
+public:
+	ChunkRecordSink(ChunkResult& p_chunk): m_chunk(p_chunk){};
+	void operator()(const BlockTokenizer::Kind p_kind, const char* p_begin, const char* p_end, const long p_line, const long p_pos){
+		m_chunk.tokens.push_back(ChunkToken(p_kind, p_begin, p_end, p_line, p_pos));
+	};
+	///_L^Ã`Nɓ~߂
+	const bool operator()(const char* p_pos, const BlockTokenizer::Counters& p_counters){
+		m_chunk.syncs.push_back(ChunkSyncPoint(p_pos, m_chunk.tokens.size(), p_counters));
+		return p_pos < m_chunk.end;
+	};
+private:
+	ChunkResult& m_chunk;
+};
+
+///`N𑖍iƃXbhĂԁj
+void scanChunk(ChunkResult& p_chunk, const char* p_dataEnd, const bool p_rawText){
+	p_chunk.nlCnt = static_cast<long>(scan::countChar(p_chunk.begin, p_chunk.end, '\n'));
+	//g[N͂悻\oCg1Ȃ̂ŁAĊmۂNɂ悤ɊmۂĂ
+	const std::size_t estimate = static_cast<std::size_t>(p_chunk.end - p_chunk.begin) / 32;
+	p_chunk.tokens.reserve(estimate);
+	p_chunk.syncs.reserve(estimate / 2);
+	p_chunk.syncs.push_back(ChunkSyncPoint(p_chunk.begin, 0, BlockTokenizer::Counters()));
+	BlockTokenizer tokenizer(p_chunk.begin, p_chunk.begin, p_dataEnd, BlockTokenizer::Counters(), p_rawText);
+	ChunkRecordSink sink(p_chunk);
+	p_chunk.reachedEnd = tokenizer.run(sink, sink);
+}
+
+///p_pos܂ރ`N̔ԍip_fromȍ~j
+std::size_t chunkIndexOf(const vector<ChunkResult>& p_chunks, const char* p_pos, std::size_t p_from){
+	while(p_from + 1 < p_chunks.size() && p_chunks[p_from + 1].begin <= p_pos) ++p_from;
+	return p_from;
+}
+
+///Oꂽ͈͂𑖍ɁAꂩ̃`N̓_Ɉv~߂
+class FixupSync{
+public:
+	FixupSync(const vector<ChunkResult>& p_chunks, const std::size_t p_index)
+		: pos(nullptr), m_chunks(p_chunks), m_index(p_index){};
+	const bool operator()(const char* p_pos, const BlockTokenizer::Counters& p_counters){
+		m_index = chunkIndexOf(m_chunks, p_pos, m_index);
+		if(m_chunks[m_index].findSync(p_pos) == nullptr) return true;
+		pos = p_pos;
+		counters = p_counters;
+		return false;
+	};
+	const char* pos;//v_
+	BlockTokenizer::Counters counters;//擪v_܂ł̐
+private:
+	const vector<ChunkResult>& m_chunks;
+	std::size_t m_index;
+};
+
+/**
+`ŇʂȂāA擪珇Ԃp_sinkɓnB
+̓_`N̓_ƈv΁A̓`Ñg[NisEʒu␳ājgB
+vȂ΁Av܂őB
+*/
+template<class Sink>
+const bool stitchChunks(const char* p_data, const char* p_end, const vector<ChunkResult>& p_chunks, Sink& p_sink, const bool p_rawText){
+	//`N̐擪܂ł̉s̐iݐϘaj
+	vector<long> nlBefore(p_chunks.size(), 0);
+	for(std::size_t k = 1; k < p_chunks.size(); ++k) nlBefore[k] = nlBefore[k - 1] + p_chunks[k - 1].nlCnt;
+	const char* p = p_data;
+	BlockTokenizer::Counters g;//擪p܂ł̐
+	std::size_t k = 0;
+	for(;;){
+		k = chunkIndexOf(p_chunks, p, k);
+		const ChunkResult& chunk = p_chunks[k];
+		const ChunkSyncPoint* sync = chunk.findSync(p);
+		if(sync != nullptr){
+			//B`N̐擪̍sEʒu␳ēn
+			const long dLine = nlBefore[k] - g.skipNl + sync->counters.skipNl;
+			const long dPos = static_cast<long>(chunk.begin - p_data) - g.skip + sync->counters.skip;
+			const ChunkSyncPoint& last = chunk.syncs.back();
+			const std::size_t tokenEnd = chunk.reachedEnd ? chunk.tokens.size() : last.tokenCount;
+			for(std::size_t t = sync->tokenCount; t < tokenEnd; ++t){
+				const ChunkToken& token = chunk.tokens[t];
+				p_sink(token.kind, token.begin, token.end, token.line + dLine, token.pos + dPos);
+				//eLXgȊÕg[Ňi_jŒ~̗v𒲂ׂBeLXgvf̊Jn^Ǒ͓_ł͂Ȃ
+				if(token.kind != BlockTokenizer::TEXT && token.end != p_end && p_sink.stopRequested()
+					&& (!p_rawText || chunk.findSync(token.end) != nullptr)) return false;
+			}
+			if(chunk.reachedEnd) return true;
+			//`N̍Ō̓_ĩ`N̒j瑱
+			g.nlCnt = nlBefore[k] + last.counters.nlCnt;
+			g.skip += last.counters.skip - sync->counters.skip;
+			g.skipNl += last.counters.skipNl - sync->counters.skipNl;
+			p = last.pos;
+			continue;
+		}
+		//Oꂽi`N̐擪^ORg̓rj
+		BlockTokenizer tokenizer(p_data, p, p_end, g, p_rawText);
+		FixupSync fixup(p_chunks, k);
+		auto onSync = [&](const char* p_pos, const BlockTokenizer::Counters& p_counters)->bool{
+			return !p_sink.stopRequested() && fixup(p_pos, p_counters);
+		};
+		if(tokenizer.run(p_sink, onSync)) return true;
+		if(p_sink.stopRequested()) return false;
+		p = fixup.pos;
+		g = fixup.counters;
+	}
+}
+
+///1Xbh̃`NiԂ̕΂XbhԂŋςj
+const std::size_t CHUNKS_PER_THREAD = 4;
+
+///`NɕĕɑAʂԂp_sinkɓn
+template<class Sink>
+const bool parseChunks(const char* p_data, const std::size_t p_size, Sink& p_sink, WorkStealingPool& p_pool, const std::size_t p_minChunkSize,
+	const bool p_rawText){
+	std::size_t count = p_pool.threadCount() * CHUNKS_PER_THREAD;
+	count = std::min(count, p_size / std::max<std::size_t>(p_minChunkSize, 1));
+	if(p_pool.threadCount() <= 1 || count <= 1){
+		BlockTokenizer tokenizer(p_data, p_size, p_rawText);
+		auto onSync = [&](const char*, const BlockTokenizer::Counters&){ return !p_sink.stopRequested(); };
+		return tokenizer.run(p_sink, onSync);
+	}
+	vector<ChunkResult> chunks(count);
+	for(std::size_t k = 0; k < count; ++k){
+		chunks[k].begin = p_data + p_size * k / count;
+		chunks[k].end = p_data + p_size * (k + 1) / count;
+	}
+	p_pool.run(count, [&](const std::size_t p_index, const std::size_t){
+		scanChunk(chunks[p_index], p_data + p_size, p_rawText);
+	});
+	return stitchChunks(p_data, p_data + p_size, chunks, p_sink, p_rawText);
+}
+
+}//namespace{
+
+
+const bool HtmlSaxParser::parse(const char* p_data, const std::size_t p_size, HtmlSaxParserHandler& p_handler){
+	//Jn
+	p_handler.clearStop();
+	p_handler.start();
+	BlockTokenizer tokenizer(p_data, p_size, m_rawText);
+	HandlerSink sink(p_handler, m_tokenStr);
+	StopOnRequest<HandlerSink> onSync(sink, p_data, m_stoppedAt);
+	return tokenizer.run(sink, onSync);
+};
+
+
+const bool HtmlSaxParser::parse(const char* p_data, const std::size_t p_size, HtmlSaxParserViewHandler& p_handler){
+	//Jn
+	p_handler.clearStop();
+	p_handler.start();
+	BlockTokenizer tokenizer(p_data, p_size, m_rawText);
+	ViewHandlerSink sink(p_handler);
+	StopOnRequest<ViewHandlerSink> onSync(sink, p_data, m_stoppedAt);
+	return tokenizer.run(sink, onSync);
+};
+
+
+const bool HtmlSaxParser::parseParallel(const char* p_data, const std::size_t p_size, HtmlSaxParserHandler& p_handler,
+	WorkStealingPool& p_pool, const std::size_t p_minChunkSize){
+	p_handler.clearStop();
+	p_handler.start();
+	HandlerSink sink(p_handler, m_tokenStr);
+	return parseChunks(p_data, p_size, sink, p_pool, p_minChunkSize, m_rawText);
+};
+
+
+const bool HtmlSaxParser::parseParallel(const char* p_data, const std::size_t p_size, HtmlSaxParserViewHandler& p_handler,
+	WorkStealingPool& p_pool, const std::size_t p_minChunkSize){
+	p_handler.clearStop();
+	p_handler.start();
+	ViewHandlerSink sink(p_handler);
+	return parseChunks(p_data, p_size, sink, p_pool, p_minChunkSize, m_rawText);
+};
+
+
+const bool HtmlSaxParser::resume(const char* p_data, const std::size_t p_size, const std::size_t p_begin, const long p_line, const long p_pos,
+	HtmlSaxParserHandler& p_handler, const SyncCallback& p_onSync){
+	//sEʒu͉s̐ƐȂ̐̍Ō܂̂ŁAȂs0Ƃč蒼
+	BlockTokenizer::Counters counters;
+	counters.nlCnt = p_line - 1;
+	counters.skip = static_cast<long>(p_begin) - p_pos;
+	BlockTokenizer tokenizer(p_data, p_data + p_begin, p_data + p_size, counters, m_rawText);
+	HandlerSink sink(p_handler, m_tokenStr);
+	p_handler.clearStop();
+	auto onSync = [&](const char* p_cur, const BlockTokenizer::Counters& p_counters)->bool{
+		const SyncPoint sync = toSyncPoint(p_data, p_cur, p_counters);
+		if(p_handler.stopRequested()){
+			m_stoppedAt = sync;
+			return false;
+		}
+		return p_onSync(sync.offset, sync.line, sync.pos);
+	};
+	return tokenizer.run(sink, onSync);
+};
+
+
+const bool HtmlSaxParser::parseBuffered(std::istream& p_is, HtmlSaxParserHandler& p_handler){
+	std::size_t size = 0;
+	m_readBuf.clear();
+	while(p_is){
+		m_readBuf.resize(size + BLOCK_SIZE);
+		p_is.read(&m_readBuf[size], BLOCK_SIZE);
+		size += static_cast<std::size_t>(p_is.gcount());
+	}
+	m_readBuf.resize(size);
+	return parse(m_readBuf.data(), size, p_handler);
 };
 
 
 
 
+//HtmlPushParser-----------------------------------------------
+
+HtmlPushParser::HtmlPushParser(HtmlSaxParserHandler& p_handler)
+	: m_handler(p_handler), m_started(false), m_state(TEXT),
+	m_offset(0), m_nlCnt(0), m_skip(0), m_skipNl(0), m_line(1), m_pos(0), m_rawText(false), m_rawName(nullptr){
+}
+
+//BlockTokenizer::run() ƓA󂯎͈͂ƂɏԂێȂs
+const std::size_t HtmlPushParser::feed(const char* p_data, const std::size_t p_size){
+	if(!m_started){
+		m_handler.clearStop();
+		m_handler.start();
+		m_started = true;
+	}
+	const char* const end = p_data + p_size;
+	const char* i = p_data;
+	//ԂeLXgŗ߂񂪂Ȃi^OARg̒jɒ~̗v𒲂ׂ
+	while(i != end && !(m_state == TEXT && m_token.empty() && m_handler.stopRequested())){
+		switch(m_state){
+		case TEXT:{
+			const char* lt = scan::findChar(i, end, '<');
+			m_nlCnt += static_cast<long>(scan::countChar(i, lt, '\n'));
+			m_token.append(i, lt);
+			if(lt == end){
+				i = end;
+			} else{
+				i = lt + 1;
+				m_state = LT;
+			}
+			break;
+		}
+		case LT:{
+			//"<"̎1͍sEʒuɐȂ
+			const char c2 = *i++;
+			++m_skip;
+			if(c2 == '\n'){
+				++m_nlCnt;
+				++m_skipNl;
+			}
+			if(IsSpace(c2)){
+				//"< "̏ꍇA^Oł͂Ȃ̂ŃeLXg̑ɂ
+				m_token += '<';
+				m_token += c2;
+				m_state = TEXT;
+				break;
+			}
+			const long offset = m_offset + static_cast<long>(i - p_data);
+			//߂nhɓn
+			if(!m_token.empty()){
+				m_handler.text(m_token, m_line, m_pos);
+				counters(offset);
+				m_token.clear();
+			}
+			m_token += '<';
+			m_token += c2;
+			m_state = TAG;
+			break;
+		}
+		case TAG:
+		case COMMENT:{
+			const char* gt = scan::findChar(i, end, '>');
+			if(gt != end) ++gt;
+			m_nlCnt += static_cast<long>(scan::countChar(i, gt, '\n'));
+			m_token.append(i, gt);
+			i = gt;
+			if(m_token.back() != '>') break;
+			const long offset = m_offset + static_cast<long>(i - p_data);
+			if(m_state == TAG){
+				if(m_token.size() >= 6 && m_token.compare(0, 4, "<!--") == 0){
+					m_state = COMMENT;
+				} else{
+					endTag(false, offset);
+					break;
+				}
+			}
+			//Rg̏I肩
+			if(m_token.compare(m_token.size() - 3, 3, "-->") == 0) endTag(true, offset);
+			break;
+		}
+		case RAW:{
+			//I^Oi"</"AvfA^ȌI̕j̐擪Ɉvm_rawTailɗ߂
+			if(m_rawTail.empty()){
+				const char* lt = scan::findChar(i, end, '<');
+				m_nlCnt += static_cast<long>(scan::countChar(i, lt, '\n'));
+				m_token.append(i, lt);
+				i = lt;
+				if(lt != end) m_rawTail += *i++;
+				break;
+			}
+			const std::size_t len = strlen(m_rawName);
+			const char c = *i;
+			if(m_rawTail.size() < len + 2){
+				const bool match = m_rawTail.size() == 1 ? c == '/'
+					: ::tolower(static_cast<unsigned char>(c)) == m_rawName[m_rawTail.size() - 2];
+				if(match){
+					m_rawTail += c;
+					++i;
+				} else{
+					//I^Oł͂Ȃ̂œȇɂic͂xׂj
+					m_token += m_rawTail;
+					m_rawTail.clear();
+				}
+				break;
+			}
+			if(!isTagNameEnd(c)){
+				m_token += m_rawTail;
+				m_rawTail.clear();
+				break;
+			}
+			//I^OB"<"̎"/"͍sEʒuɐȂ
+			++m_skip;
+			if(!m_token.empty()){
+				m_handler.text(m_token, m_line, m_pos);
+				counters(m_offset + static_cast<long>(i - p_data) - static_cast<long>(len));
+			}
+			m_token.swap(m_rawTail);
+			m_rawTail.clear();
+			m_state = TAG;
+			break;
+		}
+		}
+	}
+	m_offset += static_cast<long>(i - p_data);
+	return static_cast<std::size_t>(i - p_data);
+}
+
+void HtmlPushParser::endTag(const bool p_isComment, const long p_offset){
+	m_rawName = nullptr;
+	if(p_isComment){
+		m_handler.comment(m_token, m_line, m_pos);
+	} else{
+		if(m_rawText) m_rawName = rawTextName(m_token.data(), m_token.data() + m_token.size());
+		m_handler.tag(m_token, m_line, m_pos);
+	}
+	counters(p_offset);
+	m_token.clear();
+	m_state = m_rawName != nullptr ? RAW : TEXT;
+}
+
+void HtmlPushParser::finish(){
+	if(!m_started) m_handler.start();
+	switch(m_state){
+	case LT:
+		//Ō"<"̓eLXgɂ
+		m_token += '<';
+		//fall through
+	case TEXT:
+		if(!m_token.empty()) m_handler.text(m_token, m_line, m_pos);
+		break;
+	case TAG:
+	case COMMENT:
+		m_handler.notEnd(m_token, m_line, m_pos);
+		break;
+	case RAW:
+		//ĂȂeLXgvf̓e̓eLXgɂ
+		m_token += m_rawTail;
+		if(!m_token.empty()) m_handler.text(m_token, m_line, m_pos);
+		break;
+	}
+	//HTML̂߂ɏ
+	m_started = false;
+	m_state = TEXT;
+	m_token.clear();
+	m_rawTail.clear();
+	m_rawName = nullptr;
+	m_offset = m_nlCnt = m_skip = m_skipNl = m_pos = 0;
+	m_line = 1;
+}
+
+
+
 } //namespace nana
 
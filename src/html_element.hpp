@@ -21,12 +21,19 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <memory>
+#include <functional>
 #include <ostream>
 #include <istream>
 #include <cstring>
 #include <cstdlib>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+
+#include "html_atom.hpp"
 
 
 
@@ -66,6 +73,173 @@ private:  // emphasize the following members are private
 
 
 
+/**
+@brief 傫ȃubN珇Ԃɐ؂oă蓖āAjɂ܂Ƃ߂ĉA[iB
+ʂ̉͂ȂB HtmlDocument ̏L@( HtmlDocument::ARENA )ŎgpB
+*/
+class MonotonicArena : noncopyable{
+public:
+	static const std::size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+	explicit MonotonicArena(const std::size_t p_blockSize = DEFAULT_BLOCK_SIZE)
+		: m_cur(nullptr), m_end(nullptr), m_blockSize(p_blockSize), m_allocatedBytes(0), m_synchronized(false){};
+	~MonotonicArena();
+	///p_alignɑp_sizeoCg蓖Ă
+	void* allocate(const std::size_t p_size, const std::size_t p_align){
+		if(m_synchronized) return allocateLocked(p_size, p_align);
+		return allocateUnlocked(p_size, p_align);
+	};
+	/**
+	Xbh allocate() ĂяoꍇtrueɂibNĊ蓖ĂjB
+	 HtmlDocument ͍쐬ɑx͂̂ŁAA[i󂯎_trueɂB
+	*/
+	void setSynchronized(const bool p_synchronized){ m_synchronized = p_synchronized; };
+	///蓖ĂoCg
+	const std::size_t allocatedBytes()const{ return m_allocatedBytes; };
+	///mۂubN̐
+	const std::size_t blockCount()const{ return m_blocks.size() + m_largeBlocks.size(); };
+	/**
+	蓖Ă̈SĖɂāAA[iėpł悤ɂBŏ̃ubNcÃubN͉B
+	蓖Ă̈ɂIuWFNǵAĂяoOɔjĂȂƂȂB
+	*/
+	void reset();
+private:
+	void* allocateUnlocked(const std::size_t p_size, const std::size_t p_align){
+		std::size_t pad = (p_align - reinterpret_cast<std::size_t>(m_cur) % p_align) % p_align;
+		if(m_cur == nullptr || static_cast<std::size_t>(m_end - m_cur) < p_size + pad){
+			return allocateSlow(p_size, p_align);
+		}
+		void* ret = m_cur + pad;
+		m_cur += pad + p_size;
+		m_allocatedBytes += p_size;
+		return ret;
+	};
+	void* allocateLocked(const std::size_t p_size, const std::size_t p_align);
+	void* allocateSlow(const std::size_t p_size, const std::size_t p_align);
+	vector<char*> m_blocks;//m_blockSizẽubN
+	vector<char*> m_largeBlocks;//傫Ȋ蓖Đp̃ubN
+	char* m_cur;
+	char* m_end;
+	const std::size_t m_blockSize;
+	std::size_t m_allocatedBytes;
+	bool m_synchronized;
+	std::mutex m_mutex;
+};
+
+
+/**
+@brief MonotonicArena 犄蓖ĂAP[^BA[inullptȑꍇ͒ʏnew/deletegpB
+*/
+template<class T>
+class ArenaAllocator{
+public:
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	template<class U> struct rebind{ typedef ArenaAllocator<U> other; };
+	ArenaAllocator(MonotonicArena* p_arena = nullptr): m_arena(p_arena){};
+	template<class U> ArenaAllocator(const ArenaAllocator<U>& p_other): m_arena(p_other.arena()){};
+	T* allocate(const std::size_t p_n){
+		if(m_arena != nullptr) return static_cast<T*>(m_arena->allocate(p_n * sizeof(T), alignof(T)));
+		return static_cast<T*>(::operator new(p_n * sizeof(T)));
+	};
+	void deallocate(T* p_ptr, const std::size_t){
+		//A[ȉꍇ͂܂Ƃ߂ĉ̂ŉȂ
+		if(m_arena == nullptr) ::operator delete(p_ptr);
+	};
+	template<class U, class... Args> void construct(U* p_ptr, Args&&... p_args){ ::new(static_cast<void*>(p_ptr)) U(std::forward<Args>(p_args)...); };
+	template<class U> void destroy(U* p_ptr){ p_ptr->~U(); };
+	const std::size_t max_size()const{ return static_cast<std::size_t>(-1) / sizeof(T); };
+	MonotonicArena* arena()const{ return m_arena; };
+private:
+	MonotonicArena* m_arena;
+};
+
+template<class T, class U>
+inline const bool operator==(const ArenaAllocator<T>& p_a, const ArenaAllocator<U>& p_b){ return p_a.arena() == p_b.arena(); }
+template<class T, class U>
+inline const bool operator!=(const ArenaAllocator<T>& p_a, const ArenaAllocator<U>& p_b){ return p_a.arena() != p_b.arena(); }
+
+
+/**
+@brief unique_ptr ̃f[^BA[iɔzuꂽIuWFNgi isInArena() truej̓fXgN^ĂсA
+ȊOdeleteB std::default_delete ϊł̂ŁAunique_ptr&lt;T&gt; ̂܂ܓnB
+*/
+template<class T>
+struct ArenaAwareDelete{
+	ArenaAwareDelete(){};
+	template<class U> ArenaAwareDelete(const std::default_delete<U>&){};
+	template<class U> ArenaAwareDelete(const ArenaAwareDelete<U>&){};
+	void operator()(T* p_ptr)const{
+		if(p_ptr->isInArena()) p_ptr->~T();
+		else delete p_ptr;
+	};
+};
+
+/**
+A[iɃIuWFNg쐬ip_arenanullptȑꍇnewjB
+쐬IuWFNg ArenaAwareDelete Ŕj邱ƁB
+*/
+template<class T, class... Args>
+T* NewInArena(MonotonicArena* p_arena, Args&&... p_args){
+	if(p_arena == nullptr) return new T(std::forward<Args>(p_args)...);
+	T* ptr = ::new(p_arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(p_args)...);
+	ptr->setInArena();
+	return ptr;
+}
+
+
+
+/**
+@brief LȂ̎QƁi|C^{jBQƐ̗͎̈gp鑤ŊǗB
+*/
+class StrView{
+public:
+	typedef const char* const_iterator;
+	StrView(): m_ptr(""), m_size(0){};
+	StrView(const char* p_ptr, const std::size_t p_size): m_ptr(p_ptr), m_size(p_size){};
+	StrView(const std::string& p_str): m_ptr(p_str.data()), m_size(p_str.size()){};
+	const char* data()const{ return m_ptr; };
+	const std::size_t size()const{ return m_size; };
+	const bool empty()const{ return m_size == 0; };
+	const_iterator begin()const{ return m_ptr; };
+	const_iterator end()const{ return m_ptr + m_size; };
+	const char operator[](const std::size_t p_index)const{ return m_ptr[p_index]; };
+	///Rs[
+	std::string str()const{ return std::string(m_ptr, m_size); };
+	const bool operator==(const StrView& p_other)const{
+		return m_size == p_other.m_size && memcmp(m_ptr, p_other.m_ptr, m_size) == 0;
+	};
+	const bool operator!=(const StrView& p_other)const{ return !(*this == p_other); };
+private:
+	const char* m_ptr;
+	std::size_t m_size;
+};
+
+//
+std::ostream& operator << (std::ostream& os, const StrView& p_view);
+
+
+
+/**
+@brief ^ȎiOƒljBO͏ɂ́Al̓NH[ǵB
+*/
+struct HtmlAttr{
+	HtmlAttr(const std::string& p_name, const std::string& p_value, const Atom p_nameAtom)
+		: name(p_name), value(p_value), nameAtom(p_nameAtom){};
+	std::string name;
+	std::string value;
+	///O Atom iWȊO̖O atom::UNKNOWN B name Ŕrj
+	Atom nameAtom;
+};
+
+///^Ȏ̈ꗗiLqBȎLqꂽ܂ށj
+typedef std::vector<HtmlAttr, ArenaAllocator<HtmlAttr> > HtmlAttrs;
+
+
 /**
 @breif <pre>
 HTML̍\̂P\B\Ƃ͈ȉ̂悤ɒ`iʓIł͂ȂƂɒӁjB
@@ -78,25 +252,48 @@ HTML
 class HtmlPart : noncopyable{
 public:
 	enum Type { TEXT, TAG, COMMENT, /**錾i!doctypeA?xmlȂǁj*/DECLARATION, /**^ỎÉȂ*/NOT_END };
+	///Rs[ĕێ
 	HtmlPart(const std::string& p_str, const long p_line, const long p_pos)
-		:m_contentStr(p_str), m_line(p_line), m_pos(p_pos) {};
+		:m_contentStr(p_str), m_view(m_contentStr), m_isView(false), m_inArena(false), m_line(p_line), m_pos(p_pos) {};
+	///Rs[QƂێiQƐ͂̃IuWFNg蒷݂ȂƂȂj
+	HtmlPart(const StrView& p_view, const long p_line, const long p_pos)
+		:m_view(p_view), m_isView(true), m_inArena(false), m_line(p_line), m_pos(p_pos) {};
 	///
 	virtual ~HtmlPart(){};
 	///vf̃^CvieLXgA^OȂǁj 
 	virtual const Type type() const = 0;
 	///vf̃^Cv̕\ 
-	virtual const std::string& typeStr() const;
+	virtual const std::string& typeStr() const{ return typeStr(type()); };
+	///^Cv̕\
+	static const std::string& typeStr(const Type p_type);
 	///^Oi^Cv^OłȂꍇ͋󕶎Ԃj 
 	virtual const string& tagName() const{
 		static const string emp("");
 		return emp;
 	};
+	///^O Atom BI^Ȍꍇ͐擪/O Atom i^Cv^OłȂꍇ atom::EMPTY AWȊO̖O atom::UNKNOWN j
+	virtual const Atom tagAtom() const{ return atom::EMPTY; };
+	///I^Oi^O/Ŏn܂j
+	virtual const bool isEndTag() const{ return false; };
 	///ʒuisj
 	virtual const long lineNum()const{ return m_line; };
 	///ʒui擪̃oCgj
 	virtual const long posNum()const{ return m_pos; };
-	///^OŜ̕ 
-	virtual const std::string& str() const{ return m_contentStr; };
+	///^OŜ̕iQƂێĂꍇ́AĂяoɃRs[쐬j
+	virtual const std::string& str() const;
+	///^OŜ̎̕QƁiRs[Ȃj
+	const StrView& view() const{ return m_view; };
+	///Rs[QƂێĂ邩
+	const bool isView() const{ return m_isView; };
+	///A[iɔzuĂ邩i ArenaAwareDelete Ŏgpj
+	const bool isInArena() const{ return m_inArena; };
+	///NewInArena() ȊO͎gp֎~B
+	void setInArena(){ m_inArena = true; };
+	///sEʒu炷B HtmlDocumentEditor ȊO͎gp֎~B
+	void shiftPos(const long p_line, const long p_pos){
+		m_line += p_line;
+		m_pos += p_pos;
+	};
 	///擾iȂꍇA^Cv^OłȂꍇ͋󕶎Ԃj 
 	virtual const std::string& attr(const std::string& p_key, const std::size_t p_index) const{
 		static const std::string strNull("");
@@ -106,13 +303,33 @@ public:
 	virtual const bool hasAttr(const string& p_key, const int& p_index) const{
 		return false;
 	};
-	///̈ꗗ
+	///̈ꗗiOŏdȂj
 	virtual std::unique_ptr<vector<const string*>> attrNames()const
 	{ return unique_ptr<vector<const string*>>(new vector<const string*>); };
+	///̈ꗗiLqŏdjB attrNames() ƈႢÄmۂȂB
+	virtual const HtmlAttrs& attrs()const{
+		static const HtmlAttrs emp;
+		return emp;
+	};
+	/**
+	eLXg̕QƁi entity::decode() jWJB̌ĂяoɓWJĕێiXbhĂяoĂ悢jB
+	"&"Ȃꍇ͓WJ view() ԂB^CveLXgłȂꍇ view() ԂB
+	*/
+	virtual const StrView decoded() const{ return m_view; };
+	///QƂWJ̒liȂꍇA^Cv^OłȂꍇ͋󕶎Ԃj
+	virtual const std::string& decodedAttr(const std::string& p_key, const std::size_t p_index) const{
+		return attr(p_key, p_index);
+	};
+	///QƂWJ̈ꗗiт attrs() Ɠj
+	virtual const HtmlAttrs& decodedAttrs()const{ return attrs(); };
 private:
-	const std::string m_contentStr;
-	const long m_line;
-	const long m_pos;
+	mutable std::string m_contentStr;//QƂ݂̂̏ꍇ str() Ăяoɍ쐬
+	mutable std::once_flag m_contentOnce;
+	const StrView m_view;
+	const bool m_isView;
+	bool m_inArena;
+	long m_line;
+	long m_pos;
 };
 
 //
@@ -128,26 +345,31 @@ HTML
 </pre>*/
 class HtmlNode : noncopyable{
 public:
-	typedef std::vector<std::unique_ptr<HtmlNode>> NodeUptrs;
+	typedef std::unique_ptr<HtmlNode, ArenaAwareDelete<HtmlNode> > NodeUptr;
+	typedef std::vector<NodeUptr, ArenaAllocator<NodeUptr> > NodeUptrs;
 	typedef NodeUptrs::const_iterator const_iteraotr;
 	HtmlNode()
-		: m_startTagPartsPtr(nullptr), m_endTagPartsPtr(nullptr), m_parentNodePtr(nullptr)
+		: m_startTagPartsPtr(nullptr), m_endTagPartsPtr(nullptr), m_parentNodePtr(nullptr), m_inArena(false), m_order(0), m_lastOrder(0)
 	{ };
-	//
-	HtmlNode(const HtmlPart* p_Start, const HtmlPart* p_End, const HtmlNode* p_Parent)
-	: m_startTagPartsPtr(p_Start), m_endTagPartsPtr(p_End), m_parentNodePtr(p_Parent){};
+	///p_arenaw肵ꍇAqm[h̔zA[i犄蓖Ă
+	HtmlNode(const HtmlPart* p_Start, const HtmlPart* p_End, const HtmlNode* p_Parent, MonotonicArena* p_arena = nullptr)
+	: m_startTagPartsPtr(p_Start), m_endTagPartsPtr(p_End), m_parentNodePtr(p_Parent), m_inArena(false), m_order(0), m_lastOrder(0),
+		m_childNodeUptrs(ArenaAllocator<NodeUptr>(p_arena)){};
 	///
-	virtual ~HtmlNode(){};
+	///[KwłX^bNg؂Ȃ悤ɁAq͍ċAɔj
+	virtual ~HtmlNode();
 	///Jn^Oi݂ȂꍇAnullptrjB
 	const HtmlPart* startTag()const{ return m_startTagPartsPtr; };
 	///I^Oi݂ȂꍇAnullptrj
 	const HtmlPart* endTag()const{ return m_endTagPartsPtr; };
 	///p[TnhȊO͎gp֎~B̓NXŔp̊ǗȂB
 	void setEndTag(const HtmlPart* p_endTag){ m_endTagPartsPtr = p_endTag; };
-	void appendChild(std::unique_ptr<HtmlNode>&& p_Child){
+	void appendChild(NodeUptr&& p_Child){
 		p_Child->m_parentNodePtr = this;
 		m_childNodeUptrs.push_back(move(p_Child));
 	};
+	///qm[hjAp_other̎qm[hɒuip_other̎qm[h͂ȂȂjBp_other͓A[igƁB HtmlDocumentEditor ȊO͎gp֎~B
+	void replaceChildren(HtmlNode& p_other);
 	///Jn^OƏI^OZbgő݂邩i^OĂ邩HjB
 	const bool isClosed()const{ return (m_startTagPartsPtr != nullptr && m_endTagPartsPtr != nullptr); };
 	///qm[hi childNodeList() j̊JnʒuCe[^
@@ -158,8 +380,34 @@ public:
 	const NodeUptrs& childNodeList() const{ return m_childNodeUptrs; };
 	///em[h̃|C^B݂ȂꍇAnullptrB
 	const HtmlNode* parent() const{ return m_parentNodePtr; };
+	///qm[h̊蓖ĂɎgpA[iiȂꍇnullptrj
+	MonotonicArena* arena() const{ return m_childNodeUptrs.get_allocator().arena(); };
+	///A[iɔzuĂ邩i ArenaAwareDelete Ŏgpj
+	const bool isInArena() const{ return m_inArena; };
+	///NewInArena() ȊO͎gp֎~B
+	void setInArena(){ m_inArena = true; };
+	/**
+	s̔ԍi[g0jB HtmlNodeBuilder m[h̍쐬ɕtB
+	gƎqm[h̔ԍ order()  lastOrder() ܂ł̘A͈͂ɂȂB
+	*/
+	const std::size_t order()const{ return m_order; };
+	///qm[ĥŌ̍s̔ԍiqm[hȂꍇ order() j
+	const std::size_t lastOrder()const{ return m_lastOrder; };
+	///p_nodegqm[hiKw̃m[hǂŔr邱Ɓj
+	const bool contains(const HtmlNode& p_node)const{ return m_order <= p_node.m_order && p_node.m_order <= m_lastOrder; };
+	///s̔ԍtB HtmlNodeBuilder A HtmlDocumentEditor ȊO͎gp֎~B
+	void setOrder(const std::size_t p_order){ m_order = m_lastOrder = p_order; };
+	///qm[h̍Ō̔ԍtB HtmlNodeBuilder A HtmlDocumentEditor ȊO͎gp֎~B
+	void setLastOrder(const std::size_t p_lastOrder){ m_lastOrder = p_lastOrder; };
 	///^O
 	const std::string& tagName()const;
+	///^O Atom BI^Õm[h̏ꍇ͐擪/O Atom iWȊO̖O atom::UNKNOWN j
+	const Atom tagAtom()const;
+	///^OI^Oi/Ŏn܂j
+	const bool isEndTag()const{
+		const HtmlPart* part = (m_startTagPartsPtr != nullptr) ? m_startTagPartsPtr : m_endTagPartsPtr;
+		return part != nullptr && part->isEndTag();
+	};
 	///pX
 	const std::string pathStr()const;
 	///ێĂJnƏI^O𕶎óifobOpj 
@@ -168,6 +416,9 @@ private:
 	const HtmlPart* m_startTagPartsPtr;
 	const HtmlPart* m_endTagPartsPtr;
 	const HtmlNode* m_parentNodePtr;
+	bool m_inArena;
+	std::size_t m_order;
+	std::size_t m_lastOrder;
 	///qm[hB
 	NodeUptrs m_childNodeUptrs;
 };
@@ -177,6 +428,40 @@ private:
 std::ostream& operator << (std::ostream& os, const HtmlNode& htmlNode);
 
 
+/**
+@brief m[h̍i^OAAidEclass̒lƂ̃m[h̔zjBz͕̏ԁisjɕԁB
+ HtmlDocument::index() ō쐬B쐬Ƀm[h̊KwύXꍇ͍蒼ƁB
+*/
+class HtmlNodeIndex : noncopyable{
+public:
+	typedef std::vector<const HtmlNode*> Nodes;
+	///p_root̎qm[hip_root͊܂܂Ȃj̍쐬BJn^Ȏ͂ŉ͂B
+	explicit HtmlNodeIndex(const HtmlNode& p_root);
+	///^OiI^Õm[h͐擪/Oj̃m[hBWȊO̖O͍ɂȂ
+	const Nodes& byTag(const Atom p_tagAtom)const{ return find(m_tagMap, p_tagAtom); };
+	///̑m[h
+	const Nodes& byAttrName(const Atom p_nameAtom)const{ return find(m_attrNameMap, p_nameAtom); };
+	///id̒lp_id̃m[h
+	const Nodes& byId(const std::string& p_id)const{ return find(m_idMap, p_id); };
+	///classɁi󔒂ŋ؂jp_class܂ރm[h
+	const Nodes& byClass(const std::string& p_class)const{ return find(m_classMap, p_class); };
+	///[g܂ރm[h̐
+	const std::size_t nodeCount()const{ return m_nodeCount; };
+private:
+	template<class Map>
+	static const Nodes& find(const Map& p_map, const typename Map::key_type& p_key){
+		static const Nodes empty;
+		auto ite = p_map.find(p_key);
+		return ite == p_map.end() ? empty : ite->second;
+	};
+	std::unordered_map<Atom, Nodes> m_tagMap;
+	std::unordered_map<Atom, Nodes> m_attrNameMap;
+	std::unordered_map<std::string, Nodes> m_idMap;
+	std::unordered_map<std::string, Nodes> m_classMap;
+	std::size_t m_nodeCount;
+};
+
+
 /**
 @breif <pre>
 ^Ỏ͂ʂۑNXB
@@ -189,13 +474,36 @@ std::ostream& operator << (std::ostream& os, const HtmlNode& htmlNode);
 */
 class HtmlDocument: noncopyable{
 public:
-	typedef std::vector<unique_ptr<HtmlPart> > HtmlPartUptrs;
+	/**
+	HtmlPart A HtmlNode ̃̊mە@B
+	HEAP FPnew/deleteB
+	ARENA FIuWFNg{́Aqm[hƑ̔zA[i( MonotonicArena )܂Ƃ߂Ċ蓖āA
+	HtmlDocument ̔jɂ܂Ƃ߂ĉBjɂ͊eIuWFNg̃fXgN^͌ĂԁB
+	eIuWFNg std::string i^OA̖OƒlARs[{AWJQƂȂǁj
+	A[iɒuʏǂq[v犄蓖ĂiZSSOŃq[vgȂjB
+	*/
+	enum Ownership { HEAP, ARENA };
+	/**
+	󔒁i isWhitespace() j̃eLXgi`HTML̃CfgȂǁj̈B
+	KEEP_WHITESPACE F̂܂ܕێB
+	COLLAPSE_WHITESPACE F1̋󔒁i" "jɂB^O̐ƍsEʒu͕ς炸Ä̗gȂB
+	DROP_WHITESPACE F쐬ȂB htmlPartList() ƃm[h̊KwɊ܂܂Ȃic̃^O̍sEʒu͕ςȂjB
+	*/
+	enum Whitespace { KEEP_WHITESPACE, COLLAPSE_WHITESPACE, DROP_WHITESPACE };
+	typedef std::unique_ptr<HtmlPart, ArenaAwareDelete<HtmlPart> > HtmlPartUptr;
+	typedef std::vector<HtmlPartUptr> HtmlPartUptrs;
 	typedef HtmlPartUptrs::const_iterator const_iterator;
 	typedef vector<const HtmlPart*> SearchResults;
 	typedef unique_ptr<SearchResults> SearchResultsUptr;
 	//
-	HtmlDocument(unique_ptr<HtmlPartUptrs>&& p_partUptr, unique_ptr<HtmlNode>&& p_rootNode)
+	HtmlDocument(unique_ptr<HtmlPartUptrs>&& p_partUptr, HtmlNode::NodeUptr&& p_rootNode)
 	: m_stockedPartUptrsUptr(move(p_partUptr)), m_rootNodeUptr(move(p_rootNode)) {};
+	///p_arena犄蓖Ă^Oƃm[h󂯎BA[i͂̃IuWFNg̔jɉB
+	HtmlDocument(unique_ptr<HtmlPartUptrs>&& p_partUptr, HtmlNode::NodeUptr&& p_rootNode, unique_ptr<MonotonicArena>&& p_arena)
+	: m_arenaUptr(move(p_arena)), m_stockedPartUptrsUptr(move(p_partUptr)), m_rootNodeUptr(move(p_rootNode)) {
+		//̒x͕͂Xbhs\
+		if(m_arenaUptr) m_arenaUptr->setSynchronized(true);
+	};
 	///htmlPartList() ̃Ce[^( unique_ptr<HtmlPart> )
 	const_iterator begin() const{ return m_stockedPartUptrsUptr->begin(); };
 	const_iterator end() const{ return m_stockedPartUptrsUptr->end(); };
@@ -219,29 +527,83 @@ public:
 	*/
 	SearchResultsUptr range(
 		const HtmlPart* p_start, const HtmlPart* p_end)const;
+	/**
+	HtmlPart QƂĂ̓obt@ȂǂÃIuWFNgj܂ŕێB
+	@param p_source [in]ێIuWFNgi shared_ptr&lt;std::string&gt; Ȃǁj
+	*/
+	void holdSource(const std::shared_ptr<const void>& p_source){ m_sourceHolders.push_back(p_source); };
+	///̊mە@
+	const Ownership ownership()const{ return m_arenaUptr ? ARENA : HEAP; };
+	///^Oƃm[h蓖ĂA[ii HEAP ̏ꍇnullptrj
+	const MonotonicArena* arena()const{ return m_arenaUptr.get(); };
+	/**
+	p_docjA ARENA ̏ꍇ͎gĂA[i MonotonicArena::reset() ĕԂi HEAP ̏ꍇnullptrjB
+	ԂA[i SimpleHtmlSaxParserHandler::reuseArena() ȂǂŎ̃p[XɎgB
+	*/
+	static unique_ptr<MonotonicArena> recycleArena(unique_ptr<HtmlDocument>&& p_doc);
+	///m[h̍BŏɌĂяoɍ쐬iXbhĂяoĂ悢jB
+	const HtmlNodeIndex& index()const;
 private:
+	friend class HtmlDocumentEditor;
+	vector<std::shared_ptr<const void>> m_sourceHolders;
+	unique_ptr<MonotonicArena> m_arenaUptr;//^Oƃm[hɔj
 	unique_ptr<HtmlPartUptrs> m_stockedPartUptrsUptr;
-	unique_ptr<HtmlNode> m_rootNodeUptr;
+	HtmlNode::NodeUptr m_rootNodeUptr;
+	mutable std::mutex m_indexMutex;
+	mutable unique_ptr<HtmlNodeIndex> m_indexUptr;//m[hύXꍇ͔j
 };
 
 
 class TagHtmlPart : public HtmlPart {
 public:
-	typedef std::map<std::string, vector<string> > AttrMap;
-	TagHtmlPart(const string& p_str, const long p_line, const long p_pos)
-		:HtmlPart(p_str, p_line, p_pos){ parseTag(); };
+	/**
+	^O͂B attr() A hasAttr() A attrNames() ̏Ăяoɉ͂iXbhĂяoĂ悢jB
+	p_arenaw肵ꍇA̕ۑ̈A[i犄蓖ĂB
+	*/
+	TagHtmlPart(const string& p_str, const long p_line, const long p_pos, MonotonicArena* p_arena = nullptr)
+		:HtmlPart(p_str, p_line, p_pos), m_tagAtom(atom::EMPTY), m_isEndTag(false), m_attrPos(0), m_attrs(HtmlAttrs::allocator_type(p_arena)){ parseTagName(); };
+	TagHtmlPart(const StrView& p_view, const long p_line, const long p_pos, MonotonicArena* p_arena = nullptr)
+		:HtmlPart(p_view, p_line, p_pos), m_tagAtom(atom::EMPTY), m_isEndTag(false), m_attrPos(0), m_attrs(HtmlAttrs::allocator_type(p_arena)){ parseTagName(); };
 	virtual ~TagHtmlPart(){};
 	virtual const HtmlPart::Type type() const{ return TAG; };
 	virtual const string& tagName()const{ return m_tagName; };
+	virtual const Atom tagAtom()const{ return m_tagAtom; };
+	virtual const bool isEndTag()const{ return m_isEndTag; };
 	virtual const std::string& attr(const std::string& p_key, const std::size_t p_index)const;
 	virtual const bool hasAttr(const std::string& p_key, const std::size_t p_index)const;
-	///̈ꗗ
+	///̈ꗗiOŏdȂj
 	virtual std::unique_ptr<vector<const std::string*>> attrNames()const;
+	///̈ꗗiLqŏdj
+	virtual const HtmlAttrs& attrs()const{
+		ensureAttr();
+		return m_attrs;
+	};
+	///QƂWJ̒lB̒l͏̌Ăяoɂ܂Ƃ߂ēWJi"&"܂ޒlȂ΃Rs[ȂjB
+	virtual const std::string& decodedAttr(const std::string& p_key, const std::size_t p_index)const;
+	///QƂWJ̈ꗗiт attrs() ƓB"&"܂ޒlȂ attrs() Ɠ̂Ԃj
+	virtual const HtmlAttrs& decodedAttrs()const{
+		ensureDecoded();
+		return m_decodedAttrsUptr ? *m_decodedAttrsUptr : m_attrs;
+	};
 protected:
-	void parseTag();
+	void parseTagName();
+	void parseAttr()const;
+	void addAttr(const std::string& p_key, const std::string& p_val)const;
+	///͂ĂȂΉ͂
+	void ensureAttr()const{ std::call_once(m_attrOnce, [this]{ parseAttr(); }); };
+	///̒l̕QƂWJĂȂΓWJ
+	void ensureDecoded()const;
+	///p_attrŝOp_key̑p_indexԖځiȂꍇnullptrj
+	static const HtmlAttr* findAttr(const HtmlAttrs& p_attrs, const std::string& p_key, const std::size_t p_index);
 private:
 	std::string m_tagName;
-	AttrMap m_attrMap;
+	Atom m_tagAtom;
+	bool m_isEndTag;
+	std::size_t m_attrPos;//^Ǒ̈ʒuỉ͊Jnʒuj
+	mutable std::once_flag m_attrOnce;
+	mutable std::once_flag m_decodeOnce;
+	mutable HtmlAttrs m_attrs;//Ȃ̂Ő`T
+	mutable unique_ptr<HtmlAttrs> m_decodedAttrsUptr;//"&"܂ޒlꍇ̂ݍ쐬
 };
 
 
@@ -250,13 +612,21 @@ class TextHtmlPart : public HtmlPart {
 public:
 	TextHtmlPart(const string& p_str, const long p_line, const long p_pos)
 		:HtmlPart(p_str, p_line, p_pos){};
+	TextHtmlPart(const StrView& p_view, const long p_line, const long p_pos)
+		:HtmlPart(p_view, p_line, p_pos){};
 	virtual const HtmlPart::Type type() const{ return TEXT; };
+	virtual const StrView decoded() const;
+private:
+	mutable std::once_flag m_decodeOnce;
+	mutable unique_ptr<std::string> m_decodedStrUptr;//"&"ꍇ̂ݍ쐬
 };
 
 class CommentHtmlPart : public HtmlPart {
 public:
 	CommentHtmlPart(const std::string& p_str, const long p_line, const long p_pos)
 		:HtmlPart(p_str, p_line, p_pos){};
+	CommentHtmlPart(const StrView& p_view, const long p_line, const long p_pos)
+		:HtmlPart(p_view, p_line, p_pos){};
 	virtual const HtmlPart::Type type() const{ return COMMENT; };
 };
 
@@ -265,6 +635,8 @@ class DeclarationHtmlPart : public HtmlPart {
 public:
 	DeclarationHtmlPart(const std::string& p_str, const long p_line, const long p_pos)
 		:HtmlPart(p_str, p_line, p_pos){};
+	DeclarationHtmlPart(const StrView& p_view, const long p_line, const long p_pos)
+		:HtmlPart(p_view, p_line, p_pos){};
 	virtual const HtmlPart::Type type() const{ return DECLARATION; };
 };
 
@@ -273,16 +645,157 @@ class NotEndHtmlPart : public HtmlPart {
 public:
 	NotEndHtmlPart(const std::string& p_str, const long p_line, const long p_pos)
 		:HtmlPart(p_str, p_line, p_pos){};
+	NotEndHtmlPart(const StrView& p_view, const long p_line, const long p_pos)
+		:HtmlPart(p_view, p_line, p_pos){};
 	virtual const HtmlPart::Type type() const{ return NOT_END; };
 };
 
+///^Oiłꂽ́j錾idoctypeA?xmlȂǁB DeclarationHtmlPart ɂȂ́j
+const bool isDeclaration(const StrView& p_str);
+
+///񂪋󔒁i IsSpace() ̕CRAFFj
+const bool isWhitespace(const StrView& p_str);
+
+
+class HtmlPartTable;
+
+/**
+@brief HtmlPartTable 1̃^OQƂnhi\ƓY̑gjBRs[ĎgB
+ HtmlPart ƓÕANZTAz֐ł͂Ȃ\̔z𒼐ړǂށB
+*/
+class HtmlPartRef{
+public:
+	HtmlPartRef(const HtmlPartTable& p_table, const std::size_t p_index): m_table(&p_table), m_index(p_index){};
+	///\̒̈ʒu
+	const std::size_t index()const{ return m_index; };
+	///HtmlPart::type() Ɠ
+	const HtmlPart::Type type()const;
+	///HtmlPart::typeStr() Ɠ
+	const std::string& typeStr()const{ return HtmlPart::typeStr(type()); };
+	///HtmlPart::tagName() ƓiI^O͐擪/܂ށjB Atom ̖O쐬iWȊO̖O͉͂ĵŁArɂ tagAtom() gƁB
+	const std::string tagName()const;
+	///HtmlPart::tagAtom() Ɠ
+	const Atom tagAtom()const;
+	///HtmlPart::isEndTag() Ɠ
+	const bool isEndTag()const;
+	///HtmlPart::lineNum() Ɠ
+	const long lineNum()const;
+	///HtmlPart::posNum() Ɠ
+	const long posNum()const;
+	///^OŜ̎̕QƁi̓obt@QƂj
+	const StrView view()const;
+	///^OŜ̕iRs[쐬j
+	std::string str()const{ return view().str(); };
+	/**
+	̓obt@QƂ HtmlPart 쐬ỉ͂ȂǁA\ɂȂ񂪕KvȏꍇɎgjB
+	쐬 HtmlPart ͓̓obt@蒷݂Ă͂ȂB
+	*/
+	HtmlDocument::HtmlPartUptr part()const;
+	const bool operator==(const HtmlPartRef& p_other)const{ return m_table == p_other.m_table && m_index == p_other.m_index; };
+	const bool operator!=(const HtmlPartRef& p_other)const{ return !(*this == p_other); };
+private:
+	const HtmlPartTable* m_table;
+	std::size_t m_index;
+};
+
+
+/**
+@brief ^ÖꗗAށE̓obt@̈ʒuƒEsEʒuE^O Atom ̗񂲂Ƃ̔zistruct-of-arraysjŕێ\B
+ HtmlDocument ƈႢ^OƂ̃IuWFNgi HtmlPart j炸Az֐gȂ̂ŁASẴ^Ȏz̏Ԃ̓ǂݍ݂ɂȂB
+^O HtmlPartRef ŎQƂB͎Ȃ̂ŁAKvȏꍇ HtmlPartRef::part() gB
+͓̓obt@i source() j̎QƂێ̂ŁA̓obt@͂̃IuWFNg蒷݂ȂƂȂB
+ HtmlPartTableViewHandler ō쐬B
+<pre>
+	for(std::size_t i = 0; i < table.size(); ++i){
+		if(table.type(i) == HtmlPart::TAG && table.tagAtom(i) == divAtom) ...
+	}
+</pre>
+*/
+class HtmlPartTable : noncopyable{
+public:
+	/**
+	@brief HtmlPartRef ԂCe[^
+	*/
+	class const_iterator{
+	public:
+		const_iterator(const HtmlPartTable& p_table, const std::size_t p_index): m_table(&p_table), m_index(p_index){};
+		HtmlPartRef operator*()const{ return HtmlPartRef(*m_table, m_index); };
+		const_iterator& operator++(){
+			++m_index;
+			return *this;
+		};
+		const bool operator==(const const_iterator& p_other)const{ return m_index == p_other.m_index && m_table == p_other.m_table; };
+		const bool operator!=(const const_iterator& p_other)const{ return !(*this == p_other); };
+	private:
+		const HtmlPartTable* m_table;
+		std::size_t m_index;
+	};
+	///@param p_source [in]^OQƂ̓obt@
+	explicit HtmlPartTable(const StrView& p_source): m_source(p_source){};
+	///̓obt@
+	const StrView& source()const{ return m_source; };
+	///^O̐
+	const std::size_t size()const{ return m_types.size(); };
+	const bool empty()const{ return m_types.empty(); };
+	const_iterator begin()const{ return const_iterator(*this, 0); };
+	const_iterator end()const{ return const_iterator(*this, size()); };
+	///p_indexԖڂ̃^Õnh
+	HtmlPartRef operator[](const std::size_t p_index)const{ return HtmlPartRef(*this, p_index); };
+	///p_indexԖڂ̃^O̎
+	const HtmlPart::Type type(const std::size_t p_index)const{ return static_cast<HtmlPart::Type>(m_types[p_index] & TYPE_MASK); };
+	///p_indexԖڂ̃^OI^O
+	const bool isEndTag(const std::size_t p_index)const{ return (m_types[p_index] & END_TAG) != 0; };
+	///p_indexԖڂ̃^O Atom i^OłȂꍇ atom::EMPTY j
+	const Atom tagAtom(const std::size_t p_index)const{ return m_tagAtoms[p_index]; };
+	///p_indexԖڂ̍s
+	const long lineNum(const std::size_t p_index)const{ return m_lines[p_index]; };
+	///p_indexԖڂ̈ʒu
+	const long posNum(const std::size_t p_index)const{ return m_poss[p_index]; };
+	///p_indexԖڂ̓̓obt@̐擪̃oCg
+	const std::size_t offset(const std::size_t p_index)const{ return m_offsets[p_index]; };
+	///p_indexԖڂ̎̕Q
+	const StrView view(const std::size_t p_index)const{ return StrView(m_source.data() + m_offsets[p_index], m_sizes[p_index]); };
+	///^O Atom ̗iSẴ^O𑖍ꍇɎgj
+	const std::vector<Atom>& tagAtoms()const{ return m_tagAtoms; };
+	///\mۂĂoCg
+	const std::size_t memoryBytes()const;
+	///p_count̃^Oǉł悤ɗ̈mۂ
+	void reserve(const std::size_t p_count);
+	///SẴ^O폜āA̓obt@p_sourceɂï͉Ȃj
+	void clear(const StrView& p_source);
+	/**
+	^OǉB HtmlPartTableViewHandler ȊO͎gp֎~B
+	@param p_view [in]̓obt@̕
+	@throw std::out_of_range p_view̓obt@̊OQƂĂꍇ
+	*/
+	void push(const HtmlPart::Type p_type, const bool p_isEndTag, const Atom p_tagAtom, const StrView& p_view, const long p_line, const long p_pos);
+private:
+	static const std::uint8_t TYPE_MASK = 0x7f;
+	static const std::uint8_t END_TAG = 0x80;//I^O\rbg
+	StrView m_source;
+	std::vector<std::uint8_t> m_types;//HtmlPart::Type  END_TAG
+	std::vector<std::size_t> m_offsets;
+	std::vector<std::size_t> m_sizes;
+	std::vector<long> m_lines;
+	std::vector<long> m_poss;
+	std::vector<Atom> m_tagAtoms;
+};
+
+
+inline const HtmlPart::Type HtmlPartRef::type()const{ return m_table->type(m_index); }
+inline const Atom HtmlPartRef::tagAtom()const{ return m_table->tagAtom(m_index); }
+inline const bool HtmlPartRef::isEndTag()const{ return m_table->isEndTag(m_index); }
+inline const long HtmlPartRef::lineNum()const{ return m_table->lineNum(m_index); }
+inline const long HtmlPartRef::posNum()const{ return m_table->posNum(m_index); }
+inline const StrView HtmlPartRef::view()const{ return m_table->view(m_index); }
+
 //HtmlParser̃nh----------------------------
 /**
 @brief HTMLp[X邽߂̃nhBgphNXŉ͂̎dςB
 */
 class HtmlSaxParserHandler :noncopyable{
 public:
-	HtmlSaxParserHandler(){};
+	HtmlSaxParserHandler(): m_stopRequested(false){};
 	virtual ~HtmlSaxParserHandler(){};
 	///Jnm点Bnh̏pB 
 	virtual void start() = 0;
@@ -294,6 +807,17 @@ public:
 	virtual void comment(const std::string& p_str, const long p_line, const long p_pos) = 0;
 	///^ȌIijȂꍇSaxĂяoB
 	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos) = 0;
+	/**
+	p[TɁA̓_i^OARg̒jő~߂悤vB
+	nȟĂяo̒łÃXbhi̊ĎȂǁjłĂяoĂ悢B
+	*/
+	void requestStop(){ m_stopRequested = true; };
+	///̒~vĂ邩
+	const bool stopRequested()const{ return m_stopRequested; };
+	///~̗vip[T̊JnɌĂяoj
+	void clearStop(){ m_stopRequested = false; };
+private:
+	std::atomic<bool> m_stopRequested;
 };
 
 
@@ -302,49 +826,363 @@ public:
 */
 class SimpleHtmlSaxParserHandler :public HtmlSaxParserHandler {
 public:
-	SimpleHtmlSaxParserHandler(){};
+	explicit SimpleHtmlSaxParserHandler(const HtmlDocument::Ownership p_ownership = HtmlDocument::HEAP)
+		: m_ownership(p_ownership), m_whitespace(HtmlDocument::KEEP_WHITESPACE){};
 	virtual ~SimpleHtmlSaxParserHandler(){};
 	virtual void start(){
+		m_resultPartsUptrsUptr.reset();
+		m_arenaUptr.reset();
+		if(m_ownership == HtmlDocument::ARENA){
+			m_arenaUptr = m_spareArenaUptr ? move(m_spareArenaUptr) : unique_ptr<MonotonicArena>(new MonotonicArena);
+		}
 		m_resultPartsUptrsUptr = unique_ptr<HtmlDocument::HtmlPartUptrs>(new HtmlDocument::HtmlPartUptrs);
 	};
 	virtual void text(const std::string& p_str, const long p_line, const long p_pos){
-		unique_ptr<HtmlPart> ptr(new TextHtmlPart(p_str, p_line, p_pos));
-		m_resultPartsUptrsUptr->push_back(move(ptr));
+		if(m_whitespace != HtmlDocument::KEEP_WHITESPACE && isWhitespace(p_str)){
+			if(m_whitespace == HtmlDocument::DROP_WHITESPACE) return;
+			//񃊃eQƂ̂ŁÄmۂȂ
+			m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<TextHtmlPart>(arena(), StrView(" ", 1), p_line, p_pos)));
+			return;
+		}
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<TextHtmlPart>(arena(), p_str, p_line, p_pos)));
 	};
 	virtual void tag(const std::string& p_str, const long line, const long pos);
 	virtual void comment(const std::string& p_str, const long p_line, const long p_pos){
-		unique_ptr<HtmlPart> ptr(new CommentHtmlPart(p_str, p_line, p_pos));
-		m_resultPartsUptrsUptr->push_back(move(ptr));
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<CommentHtmlPart>(arena(), p_str, p_line, p_pos)));
 	};
 	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos){
-		unique_ptr<HtmlPart> ptr(new NotEndHtmlPart(p_str, p_line, p_pos));
-		m_resultPartsUptrsUptr->push_back(move(ptr));
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<NotEndHtmlPart>(arena(), p_str, p_line, p_pos)));
 	}
 	//p[Xʂ擾BsOʎ擾nullptrԂB
 	unique_ptr<HtmlDocument::HtmlPartUptrs> result(){
 		return move(m_resultPartsUptrsUptr);
 	};
+	/**
+	 HtmlDocument::ARENA ̏ꍇɁAʂ̃^O蓖ĂA[i擾i HEAP ̏ꍇA擾nullptrjB
+	A[i result() Ŏ擾^OɔjȂƂȂB
+	*/
+	unique_ptr<MonotonicArena> releaseArena(){ return move(m_arenaUptr); };
+	/**
+	 HtmlDocument::ARENA ̏ꍇɁÃp[XŐVA[i쐬p_arenagB
+	 HtmlDocument::recycleArena() ŎoA[ināAubNg܂킷߂ɎgpB
+	*/
+	void reuseArena(unique_ptr<MonotonicArena>&& p_arena){ m_spareArenaUptr = move(p_arena); };
+	///̊mە@
+	const HtmlDocument::Ownership ownership()const{ return m_ownership; };
+	///󔒂̃eLXg̈ݒ肷il HtmlDocument::KEEP_WHITESPACE jB̃p[XLɂȂB
+	void setWhitespace(const HtmlDocument::Whitespace p_mode){ m_whitespace = p_mode; };
+	///󔒂̃eLXg̈
+	const HtmlDocument::Whitespace whitespace()const{ return m_whitespace; };
+protected:
+	///^O蓖ĂA[ii HEAP ̏ꍇnullptrj
+	MonotonicArena* arena()const{ return m_arenaUptr.get(); };
+	///p[X̃^Ozi start()  result() ܂ł̊Ԃ̂ݗLj
+	const HtmlDocument::HtmlPartUptrs& resultParts()const{ return *m_resultPartsUptrsUptr; };
+private:
+	const HtmlDocument::Ownership m_ownership;
+	HtmlDocument::Whitespace m_whitespace;
+	unique_ptr<MonotonicArena> m_spareArenaUptr;//̃p[XŎgA[i
+	unique_ptr<MonotonicArena> m_arenaUptr;//ʂ̃^Oɔj
+	unique_ptr<HtmlDocument::HtmlPartUptrs> m_resultPartsUptrsUptr;
+};
 
+
+/**
+@brief Rs[HTMLp[X邽߂̃nhB
+ HtmlSaxParserHandler Ɠ^C~OŌĂяo邪A͌ĂяoǗ̓obt@̎Q( StrView )œnB
+@see HtmlSaxParser::parse(const char*, const std::size_t, HtmlSaxParserViewHandler&)
+*/
+class HtmlSaxParserViewHandler :noncopyable{
+public:
+	HtmlSaxParserViewHandler(): m_stopRequested(false){};
+	virtual ~HtmlSaxParserViewHandler(){};
+	///Jnm点Bnh̏pB 
+	virtual void start() = 0;
+	///eLXg̏ꍇSaxĂяoB 
+	virtual void text(const StrView& p_view, const long p_line, const long p_pos) = 0;
+	///^OiRgȊÓ łꂽ́j̏ꍇSaxĂяoB 
+	virtual void tag(const StrView& p_view, const long p_line, const long p_pos) = 0;
+	///RgiI||||j̏ꍇSaxĂяoB
+	virtual void comment(const StrView& p_view, const long p_line, const long p_pos) = 0;
+	///^ȌIijȂꍇSaxĂяoB
+	virtual void notEnd(const StrView& p_view, const long p_line, const long p_pos) = 0;
+	///p[Tɑ~߂悤vB HtmlSaxParserHandler::requestStop() QƁB
+	void requestStop(){ m_stopRequested = true; };
+	///̒~vĂ邩
+	const bool stopRequested()const{ return m_stopRequested; };
+	///~̗vip[T̊JnɌĂяoj
+	void clearStop(){ m_stopRequested = false; };
 private:
+	std::atomic<bool> m_stopRequested;
+};
+
+
+/**
+@brief HTML͂A̓obt@QƂ^Oz( HtmlPart ̔z)ԂHTMLp[TnhB
+ HtmlPart ͕Rs[Ȃ̂ŁA̓obt@͌ʂ蒷݂ȂƂȂB
+@see HtmlDocument::holdSource()
+*/
+class SimpleHtmlSaxParserViewHandler :public HtmlSaxParserViewHandler {
+public:
+	explicit SimpleHtmlSaxParserViewHandler(const HtmlDocument::Ownership p_ownership = HtmlDocument::HEAP)
+		: m_ownership(p_ownership), m_whitespace(HtmlDocument::KEEP_WHITESPACE){};
+	virtual ~SimpleHtmlSaxParserViewHandler(){};
+	virtual void start(){
+		m_resultPartsUptrsUptr.reset();
+		m_arenaUptr.reset();
+		if(m_ownership == HtmlDocument::ARENA){
+			m_arenaUptr = m_spareArenaUptr ? move(m_spareArenaUptr) : unique_ptr<MonotonicArena>(new MonotonicArena);
+		}
+		m_resultPartsUptrsUptr = unique_ptr<HtmlDocument::HtmlPartUptrs>(new HtmlDocument::HtmlPartUptrs);
+	};
+	virtual void text(const StrView& p_view, const long p_line, const long p_pos){
+		if(m_whitespace != HtmlDocument::KEEP_WHITESPACE && isWhitespace(p_view)){
+			if(m_whitespace == HtmlDocument::DROP_WHITESPACE) return;
+			//񃊃eQƂ̂ŁÄmۂȂ
+			m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<TextHtmlPart>(arena(), StrView(" ", 1), p_line, p_pos)));
+			return;
+		}
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<TextHtmlPart>(arena(), p_view, p_line, p_pos)));
+	};
+	virtual void tag(const StrView& p_view, const long p_line, const long p_pos);
+	virtual void comment(const StrView& p_view, const long p_line, const long p_pos){
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<CommentHtmlPart>(arena(), p_view, p_line, p_pos)));
+	};
+	virtual void notEnd(const StrView& p_view, const long p_line, const long p_pos){
+		m_resultPartsUptrsUptr->push_back(HtmlDocument::HtmlPartUptr(NewInArena<NotEndHtmlPart>(arena(), p_view, p_line, p_pos)));
+	}
+	//p[Xʂ擾BsOʎ擾nullptrԂB
+	unique_ptr<HtmlDocument::HtmlPartUptrs> result(){
+		return move(m_resultPartsUptrsUptr);
+	};
+	/**
+	 HtmlDocument::ARENA ̏ꍇɁAʂ̃^O蓖ĂA[i擾i HEAP ̏ꍇA擾nullptrjB
+	A[i result() Ŏ擾^OɔjȂƂȂB
+	*/
+	unique_ptr<MonotonicArena> releaseArena(){ return move(m_arenaUptr); };
+	/**
+	 HtmlDocument::ARENA ̏ꍇɁÃp[XŐVA[i쐬p_arenagB
+	 HtmlDocument::recycleArena() ŎoA[ināAubNg܂킷߂ɎgpB
+	*/
+	void reuseArena(unique_ptr<MonotonicArena>&& p_arena){ m_spareArenaUptr = move(p_arena); };
+	///̊mە@
+	const HtmlDocument::Ownership ownership()const{ return m_ownership; };
+	///󔒂̃eLXg̈ݒ肷il HtmlDocument::KEEP_WHITESPACE jB̃p[XLɂȂB
+	void setWhitespace(const HtmlDocument::Whitespace p_mode){ m_whitespace = p_mode; };
+	///󔒂̃eLXg̈
+	const HtmlDocument::Whitespace whitespace()const{ return m_whitespace; };
+protected:
+	///^O蓖ĂA[ii HEAP ̏ꍇnullptrj
+	MonotonicArena* arena()const{ return m_arenaUptr.get(); };
+	///p[X̃^Ozi start()  result() ܂ł̊Ԃ̂ݗLj
+	const HtmlDocument::HtmlPartUptrs& resultParts()const{ return *m_resultPartsUptrsUptr; };
+private:
+	const HtmlDocument::Ownership m_ownership;
+	HtmlDocument::Whitespace m_whitespace;
+	unique_ptr<MonotonicArena> m_spareArenaUptr;//̃p[XŎgA[i
+	unique_ptr<MonotonicArena> m_arenaUptr;//ʂ̃^Oɔj
 	unique_ptr<HtmlDocument::HtmlPartUptrs> m_resultPartsUptrsUptr;
 };
 
 
 
+/**
+@brief HTML͂A^Öꗗ HtmlPartTable ɂHTMLp[TnhB HtmlPart 쐬ȂB
+ HtmlSaxParser::parse(const char*, const std::size_t, HtmlSaxParserViewHandler&) ɃRXgN^i setSource() jŎw肵̓obt@nĎgB
+<pre>
+	HtmlPartTableViewHandler handler(StrView(data, size));
+	parser.parse(data, size, handler);
+	unique_ptr<HtmlPartTable> table = handler.result();
+</pre>
+*/
+class HtmlPartTableViewHandler :public HtmlSaxParserViewHandler {
+public:
+	///@param p_source [in]p[X̓obt@
+	explicit HtmlPartTableViewHandler(const StrView& p_source): m_source(p_source){};
+	virtual ~HtmlPartTableViewHandler(){};
+	virtual void start();
+	virtual void text(const StrView& p_view, const long p_line, const long p_pos){
+		m_tableUptr->push(HtmlPart::TEXT, false, atom::EMPTY, p_view, p_line, p_pos);
+	};
+	virtual void tag(const StrView& p_view, const long p_line, const long p_pos);
+	virtual void comment(const StrView& p_view, const long p_line, const long p_pos){
+		m_tableUptr->push(HtmlPart::COMMENT, false, atom::EMPTY, p_view, p_line, p_pos);
+	};
+	virtual void notEnd(const StrView& p_view, const long p_line, const long p_pos){
+		m_tableUptr->push(HtmlPart::NOT_END, false, atom::EMPTY, p_view, p_line, p_pos);
+	};
+	//p[Xʂ擾BsOʎ擾nullptrԂB
+	unique_ptr<HtmlPartTable> result(){ return move(m_tableUptr); };
+	///̃p[X̓̓obt@ݒ肷
+	void setSource(const StrView& p_source){ m_source = p_source; };
+	/**
+	̃p[XŐV\쐬p_tablegiz̗̈g܂킷߂ɎgpjB
+	*/
+	void reuseTable(unique_ptr<HtmlPartTable>&& p_table){ m_spareTableUptr = move(p_table); };
+private:
+	StrView m_source;
+	string m_tagName;//^Ỏ͂Ɏgïg܂킷j
+	unique_ptr<HtmlPartTable> m_tableUptr;
+	unique_ptr<HtmlPartTable> m_spareTableUptr;//̃p[XŎg߂̕\i reuseTable() Őݒj
+};
+
+
+
 //HtmlSaxParser-----------------------------------------------
+class WorkStealingPool;
+
 /**
 @brief HTMLp[TBhNX݂͑ȂBgpnhς邱Ƃŉ͕@ςB
+nh HtmlSaxParserHandler::requestStop() ĂԂƁA̓_i^OARg̒jő~߁Aparse̊֐falseԂB
+HTML̏ꍇ͎~߂_ stoppedAt() Ŏ擾łA resume() ő瑖łB
 */
 class HtmlSaxParser :noncopyable{
 public:
-	void parse(std::istream& is, HtmlSaxParserHandler& handler);
+	HtmlSaxParser(): m_line(1), m_pos(0), m_rawText(false){};
+	/**
+	scriptAstyleAtextareåJn^ǑAΉI^Oi"</script"Ȃǂ̌ɋ󔒁A"/"A">"B啶͋ʂȂj
+	̒O܂1̃eLXgƂēnilfalsejB
+	trueɂƁAe̒"<"^OƂĉ͂ȂBP^Oi"<script />"j HtmlNodeBuilder ƓeȂ̂ƂB
+	eLXg̓e̓r͓_ɂȂȂB
+	*/
+	void setRawTextElements(const bool p_enable){ m_rawText = p_enable; };
+	///setRawTextElements() Őݒ肵l
+	const bool rawTextElements()const{ return m_rawText; };
+	///ĊJłʒui resume() ̈j
+	struct SyncPoint{
+		SyncPoint(): offset(0), line(1), pos(0){};
+		std::size_t offset;//擪̃oCg
+		long line, pos;//n܂g[N̍sAʒu
+	};
+	///Xg[ǂݍލۂ̃ubNTCYi parseBuffered() Ŏgpj
+	static const std::size_t BLOCK_SIZE = 64 * 1024;
+	/**
+	1ǂݍŃp[XB
+	@return Ō܂őꍇtrueAnh̗vŎ~߂ꍇfalse
+	*/
+	const bool parse(std::istream& is, HtmlSaxParserHandler& handler);
+	/**
+	HTMLubNPʂőăp[XB
+	nȟĂяoAsEʒu parse(std::istream&, HtmlSaxParserHandler&) ƓɂȂB
+	@param p_data [in]HTML̐擪
+	@param p_size [in]HTML̃oCg
+	@return Ō܂őꍇtrueAnh̗vŎ~߂ꍇfalsei~߂ʒu stoppedAt() j
+	*/
+	const bool parse(const char* p_data, const std::size_t p_size, HtmlSaxParserHandler& p_handler);
+	///Xg[ BLOCK_SIZE Pʂł܂Ƃ߂ēǂݍ݁A parse(const char*, const std::size_t, HtmlSaxParserHandler&) Ńp[XB
+	const bool parseBuffered(std::istream& p_is, HtmlSaxParserHandler& p_handler);
+	/**
+	HTML𕶎Rs[Ƀp[XBnhɂ p_data QƂ StrView nB
+	nȟĂяoAsEʒuA߂l parse(const char*, const std::size_t, HtmlSaxParserHandler&) ƓB
+	*/
+	const bool parse(const char* p_data, const std::size_t p_size, HtmlSaxParserViewHandler& p_handler);
+	///parseParallel() Ń`Nɕŏ̃oCg
+	static const std::size_t PARALLEL_MIN_CHUNK_SIZE = 1024 * 1024;
+	/**
+	HTML`Nɕ p_pool ̃XbhŕɑB
+	e`N͐擪^ORg̊OłƐđAȂ鎞ɐOꂽ͈͂B
+	nȟĂяoAsEʒu parse(const char*, const std::size_t, HtmlSaxParserHandler&) ƓɂȂB
+	nh͌ĂяõXbh珇ԂɌĂяoBp_pool WorkStealingPool::run() s̃^XNĂяoĂ͂ȂB
+	nh̗vŎ~߂ꍇ́Aȍ~̃nȟĂяo߂邾ŁA stoppedAt() ͋L^ȂB
+	@param p_minChunkSize [in]`N̍ŏ̃oCgi͂ꍇAXbh1̏ꍇ͕ɑj
+	@return Ō܂ŃnhĂяoꍇtrueAnh̗vŎ~߂ꍇfalse
+	*/
+	const bool parseParallel(const char* p_data, const std::size_t p_size, HtmlSaxParserHandler& p_handler,
+		WorkStealingPool& p_pool, const std::size_t p_minChunkSize = PARALLEL_MIN_CHUNK_SIZE);
+	///Rs[Ƀ`NɕĕɑB parseParallel(const char*, const std::size_t, HtmlSaxParserHandler&, WorkStealingPool&, const std::size_t) QƁB
+	const bool parseParallel(const char* p_data, const std::size_t p_size, HtmlSaxParserViewHandler& p_handler,
+		WorkStealingPool& p_pool, const std::size_t p_minChunkSize = PARALLEL_MIN_CHUNK_SIZE);
+	/**
+	_ƂɌĂяo֐B(擪̃oCg, n܂g[N̍s, ʒu)BfalseԂƑ~߂B
+	_̓^OARg̒̈ʒuŁA瑖ĊJĂ擪瑖ꍇƓʂɂȂB
+	*/
+	typedef std::function<bool(const std::size_t p_offset, const long p_line, const long p_pos)> SyncCallback;
+	/**
+	HTML̑A_p_beginĊJinh start() ͌Ă΂A~̗v͎jB
+	@param p_line [in]p_beginn܂g[N̍si HtmlPart::lineNum() j
+	@param p_pos [in]p_beginn܂g[N̈ʒui HtmlPart::posNum() j
+	@param p_onSync [in]p_begin̓_ƂɌĂяo
+	@return Ō܂őꍇtrueAp_onSyncnh̗vŎ~߂ꍇfalse
+	*/
+	const bool resume(const char* p_data, const std::size_t p_size, const std::size_t p_begin, const long p_line, const long p_pos,
+		HtmlSaxParserHandler& p_handler, const SyncCallback& p_onSync);
+	///_p_sync瑖ĊJB stoppedAt() nƁA~߂瑱B
+	const bool resume(const char* p_data, const std::size_t p_size, const SyncPoint& p_sync, HtmlSaxParserHandler& p_handler){
+		return resume(p_data, p_size, p_sync.offset, p_sync.line, p_sync.pos, p_handler, [](const std::size_t, const long, const long){ return true; });
+	};
+	///HTML̑ŌɎ~߂_
+	const SyncPoint& stoppedAt()const{ return m_stoppedAt; };
 protected:
 	const bool copyUntilFind(string& p_str, istream& p_is, const char p_targetC);
 	const bool copyUntilFindCommentClosed(string& p_str, istream& p_is);
 	//NA֐(ۊǕϐstr̃NAƁÄ݂ʒuƍsۊǂ)
 	inline void clearStr(string& str, long& line, long& pos){ str.clear(); line = m_line; pos = m_pos; };
+	///eLXgvfp_name̓eƏI^OǂݍŃnhɓn
+	void parseRawText(istream& p_is, HtmlSaxParserHandler& p_handler, string& p_str, long& p_line, long& p_pos, const char* p_name);
 private:
 	long m_line, m_pos;//s, ʒui擪̃oCgj
+	bool m_rawText;//scriptAstyleAtextarea̓e𐶃eLXgƂĈ
+	string m_tokenStr;//ubNŃnhɓnïg܂킷j
+	string m_readBuf;//parseBuffered()̓ǂݍ݃obt@ïg܂킷j
+	SyncPoint m_stoppedAt;
+};
+
+
+/**
+@brief ē͂HTMLA͂珇ԂɃp[XvbV^̃p[TB
+ feed() Ŏ󂯎͈͂Ŋg[NnhĂяoB^OARg̓r"<"̒ŕĂĂA
+Ŝ HtmlSaxParser::parse(const char*, const std::size_t, HtmlSaxParserHandler&) Ńp[XꍇƓĂяoAsEʒuɂȂB
+<pre>
+	HtmlPushParser parser(handler);
+	while(M) parser.feed(buf, size);
+	parser.finish();
+</pre>
+*/
+class HtmlPushParser :noncopyable{
+public:
+	///@param p_handler [in]ĂяonhB̃IuWFNg蒷݂ȂƂȂB
+	explicit HtmlPushParser(HtmlSaxParserHandler& p_handler);
+	/**
+	HTML̑nBǑĂяo瑱ăp[Xiŏ̌ĂяoŃnh̒~̗vA start() ĂԁjB
+	p_data͌ĂяoɔjĂ悢ĩg[N̓Rs[ĕێjB
+	nh HtmlSaxParserHandler::requestStop() ĂԂƁÃ^OiRgj̒Ŏ~߂B
+	c HtmlSaxParserHandler::clearStop() ̌ feed() œnƁAp[XłB
+	@return oCgi~߂ꍇ͎~߂ʒu܂ł̃oCgj
+	*/
+	const std::size_t feed(const char* p_data, const std::size_t p_size);
+	/**
+	HTML̏Im点Ãg[Nni^O̓rȂ HtmlSaxParserHandler::notEnd() jB
+	Ăяo͎HTML feed() łB
+	*/
+	void finish();
+	///HtmlSaxParser::setRawTextElements() ƓBŏ feed() ̑Oɐݒ肷B
+	void setRawTextElements(const bool p_enable){ m_rawText = p_enable; };
+private:
+	///̏
+	enum State {
+		/**eLXgi"<"Tj*/TEXT,
+		/**"<"̒i1Ń^O肷j*/LT,
+		/**^Oi">"Tj*/TAG,
+		/**Rgi"-->"Tj*/COMMENT,
+		/**eLXgvf̓eiI^OTj*/RAW };
+	///p_offseẗʒuł̍sEʒuvZ
+	void counters(const long p_offset){
+		m_line = 1 + m_nlCnt - m_skipNl;
+		m_pos = p_offset - m_skip;
+	};
+	///^OiRgj̏IBnhɓnăeLXg̏Ԃɖ߂B
+	void endTag(const bool p_isComment, const long p_offset);
+	HtmlSaxParserHandler& m_handler;
+	bool m_started;
+	State m_state;
+	string m_token;//̃g[N
+	long m_offset;//܂łɎ󂯎oCg
+	long m_nlCnt;//󂯎s̐
+	long m_skip, m_skipNl;//Ȃ̐Ẩs̐
+	long m_line, m_pos;//ɓng[N̍sEʒu
+	bool m_rawText;//scriptAstyleAtextarea̓e𐶃eLXgƂĈ
+	const char* m_rawName;//e𑖍̐eLXgvf̖O
+	string m_rawTail;//I^O̐擪Ɉvi"</scr"Ȃǁj
 };
 
 
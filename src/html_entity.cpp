@@ -0,0 +1,686 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <cctype>
+#include <algorithm>
+
+#include "html_entity.hpp"
+#include "html_atom.hpp"
+#include "html_scan.hpp"
+#include "html_charset.hpp"
+
+
+namespace nana{
+namespace entity{
+
+namespace{
+
+/**
+HTML5̖OtQƂ̖Oi"&"jBPython html.entities.html5 琶B
+";"̂Ȃ̂́AHTML5";"ȗłÂ`iő6jB
+*/
+const char* const NAMES[] = {
+	"AElig", "AElig;", "AMP", "AMP;", "Aacute", "Aacute;", "Abreve;", "Acirc", "Acirc;", "Acy;", "Afr;", "Agrave",
+	"Agrave;", "Alpha;", "Amacr;", "And;", "Aogon;", "Aopf;", "ApplyFunction;", "Aring", "Aring;", "Ascr;", "Assign;",
+	"Atilde", "Atilde;", "Auml", "Auml;", "Backslash;", "Barv;", "Barwed;", "Bcy;", "Because;", "Bernoullis;", "Beta;",
+	"Bfr;", "Bopf;", "Breve;", "Bscr;", "Bumpeq;", "CHcy;", "COPY", "COPY;", "Cacute;", "Cap;", "CapitalDifferentialD;",
+	"Cayleys;", "Ccaron;", "Ccedil", "Ccedil;", "Ccirc;", "Cconint;", "Cdot;", "Cedilla;", "CenterDot;", "Cfr;", "Chi;",
+	"CircleDot;", "CircleMinus;", "CirclePlus;", "CircleTimes;", "ClockwiseContourIntegral;", "CloseCurlyDoubleQuote;",
+	"CloseCurlyQuote;", "Colon;", "Colone;", "Congruent;", "Conint;", "ContourIntegral;", "Copf;", "Coproduct;",
+	"CounterClockwiseContourIntegral;", "Cross;", "Cscr;", "Cup;", "CupCap;", "DD;", "DDotrahd;", "DJcy;", "DScy;",
+	"DZcy;", "Dagger;", "Darr;", "Dashv;", "Dcaron;", "Dcy;", "Del;", "Delta;", "Dfr;", "DiacriticalAcute;",
+	"DiacriticalDot;", "DiacriticalDoubleAcute;", "DiacriticalGrave;", "DiacriticalTilde;", "Diamond;", "DifferentialD;",
+	"Dopf;", "Dot;", "DotDot;", "DotEqual;", "DoubleContourIntegral;", "DoubleDot;", "DoubleDownArrow;",
+	"DoubleLeftArrow;", "DoubleLeftRightArrow;", "DoubleLeftTee;", "DoubleLongLeftArrow;", "DoubleLongLeftRightArrow;",
+	"DoubleLongRightArrow;", "DoubleRightArrow;", "DoubleRightTee;", "DoubleUpArrow;", "DoubleUpDownArrow;",
+	"DoubleVerticalBar;", "DownArrow;", "DownArrowBar;", "DownArrowUpArrow;", "DownBreve;", "DownLeftRightVector;",
+	"DownLeftTeeVector;", "DownLeftVector;", "DownLeftVectorBar;", "DownRightTeeVector;", "DownRightVector;",
+	"DownRightVectorBar;", "DownTee;", "DownTeeArrow;", "Downarrow;", "Dscr;", "Dstrok;", "ENG;", "ETH", "ETH;", "Eacute",
+	"Eacute;", "Ecaron;", "Ecirc", "Ecirc;", "Ecy;", "Edot;", "Efr;", "Egrave", "Egrave;", "Element;", "Emacr;",
+	"EmptySmallSquare;", "EmptyVerySmallSquare;", "Eogon;", "Eopf;", "Epsilon;", "Equal;", "EqualTilde;", "Equilibrium;",
+	"Escr;", "Esim;", "Eta;", "Euml", "Euml;", "Exists;", "ExponentialE;", "Fcy;", "Ffr;", "FilledSmallSquare;",
+	"FilledVerySmallSquare;", "Fopf;", "ForAll;", "Fouriertrf;", "Fscr;", "GJcy;", "GT", "GT;", "Gamma;", "Gammad;",
+	"Gbreve;", "Gcedil;", "Gcirc;", "Gcy;", "Gdot;", "Gfr;", "Gg;", "Gopf;", "GreaterEqual;", "GreaterEqualLess;",
+	"GreaterFullEqual;", "GreaterGreater;", "GreaterLess;", "GreaterSlantEqual;", "GreaterTilde;", "Gscr;", "Gt;",
+	"HARDcy;", "Hacek;", "Hat;", "Hcirc;", "Hfr;", "HilbertSpace;", "Hopf;", "HorizontalLine;", "Hscr;", "Hstrok;",
+	"HumpDownHump;", "HumpEqual;", "IEcy;", "IJlig;", "IOcy;", "Iacute", "Iacute;", "Icirc", "Icirc;", "Icy;", "Idot;",
+	"Ifr;", "Igrave", "Igrave;", "Im;", "Imacr;", "ImaginaryI;", "Implies;", "Int;", "Integral;", "Intersection;",
+	"InvisibleComma;", "InvisibleTimes;", "Iogon;", "Iopf;", "Iota;", "Iscr;", "Itilde;", "Iukcy;", "Iuml", "Iuml;",
+	"Jcirc;", "Jcy;", "Jfr;", "Jopf;", "Jscr;", "Jsercy;", "Jukcy;", "KHcy;", "KJcy;", "Kappa;", "Kcedil;", "Kcy;",
+	"Kfr;", "Kopf;", "Kscr;", "LJcy;", "LT", "LT;", "Lacute;", "Lambda;", "Lang;", "Laplacetrf;", "Larr;", "Lcaron;",
+	"Lcedil;", "Lcy;", "LeftAngleBracket;", "LeftArrow;", "LeftArrowBar;", "LeftArrowRightArrow;", "LeftCeiling;",
+	"LeftDoubleBracket;", "LeftDownTeeVector;", "LeftDownVector;", "LeftDownVectorBar;", "LeftFloor;", "LeftRightArrow;",
+	"LeftRightVector;", "LeftTee;", "LeftTeeArrow;", "LeftTeeVector;", "LeftTriangle;", "LeftTriangleBar;",
+	"LeftTriangleEqual;", "LeftUpDownVector;", "LeftUpTeeVector;", "LeftUpVector;", "LeftUpVectorBar;", "LeftVector;",
+	"LeftVectorBar;", "Leftarrow;", "Leftrightarrow;", "LessEqualGreater;", "LessFullEqual;", "LessGreater;", "LessLess;",
+	"LessSlantEqual;", "LessTilde;", "Lfr;", "Ll;", "Lleftarrow;", "Lmidot;", "LongLeftArrow;", "LongLeftRightArrow;",
+	"LongRightArrow;", "Longleftarrow;", "Longleftrightarrow;", "Longrightarrow;", "Lopf;", "LowerLeftArrow;",
+	"LowerRightArrow;", "Lscr;", "Lsh;", "Lstrok;", "Lt;", "Map;", "Mcy;", "MediumSpace;", "Mellintrf;", "Mfr;",
+	"MinusPlus;", "Mopf;", "Mscr;", "Mu;", "NJcy;", "Nacute;", "Ncaron;", "Ncedil;", "Ncy;", "NegativeMediumSpace;",
+	"NegativeThickSpace;", "NegativeThinSpace;", "NegativeVeryThinSpace;", "NestedGreaterGreater;", "NestedLessLess;",
+	"NewLine;", "Nfr;", "NoBreak;", "NonBreakingSpace;", "Nopf;", "Not;", "NotCongruent;", "NotCupCap;",
+	"NotDoubleVerticalBar;", "NotElement;", "NotEqual;", "NotEqualTilde;", "NotExists;", "NotGreater;",
+	"NotGreaterEqual;", "NotGreaterFullEqual;", "NotGreaterGreater;", "NotGreaterLess;", "NotGreaterSlantEqual;",
+	"NotGreaterTilde;", "NotHumpDownHump;", "NotHumpEqual;", "NotLeftTriangle;", "NotLeftTriangleBar;",
+	"NotLeftTriangleEqual;", "NotLess;", "NotLessEqual;", "NotLessGreater;", "NotLessLess;", "NotLessSlantEqual;",
+	"NotLessTilde;", "NotNestedGreaterGreater;", "NotNestedLessLess;", "NotPrecedes;", "NotPrecedesEqual;",
+	"NotPrecedesSlantEqual;", "NotReverseElement;", "NotRightTriangle;", "NotRightTriangleBar;", "NotRightTriangleEqual;",
+	"NotSquareSubset;", "NotSquareSubsetEqual;", "NotSquareSuperset;", "NotSquareSupersetEqual;", "NotSubset;",
+	"NotSubsetEqual;", "NotSucceeds;", "NotSucceedsEqual;", "NotSucceedsSlantEqual;", "NotSucceedsTilde;", "NotSuperset;",
+	"NotSupersetEqual;", "NotTilde;", "NotTildeEqual;", "NotTildeFullEqual;", "NotTildeTilde;", "NotVerticalBar;",
+	"Nscr;", "Ntilde", "Ntilde;", "Nu;", "OElig;", "Oacute", "Oacute;", "Ocirc", "Ocirc;", "Ocy;", "Odblac;", "Ofr;",
+	"Ograve", "Ograve;", "Omacr;", "Omega;", "Omicron;", "Oopf;", "OpenCurlyDoubleQuote;", "OpenCurlyQuote;", "Or;",
+	"Oscr;", "Oslash", "Oslash;", "Otilde", "Otilde;", "Otimes;", "Ouml", "Ouml;", "OverBar;", "OverBrace;",
+	"OverBracket;", "OverParenthesis;", "PartialD;", "Pcy;", "Pfr;", "Phi;", "Pi;", "PlusMinus;", "Poincareplane;",
+	"Popf;", "Pr;", "Precedes;", "PrecedesEqual;", "PrecedesSlantEqual;", "PrecedesTilde;", "Prime;", "Product;",
+	"Proportion;", "Proportional;", "Pscr;", "Psi;", "QUOT", "QUOT;", "Qfr;", "Qopf;", "Qscr;", "RBarr;", "REG", "REG;",
+	"Racute;", "Rang;", "Rarr;", "Rarrtl;", "Rcaron;", "Rcedil;", "Rcy;", "Re;", "ReverseElement;", "ReverseEquilibrium;",
+	"ReverseUpEquilibrium;", "Rfr;", "Rho;", "RightAngleBracket;", "RightArrow;", "RightArrowBar;",
+	"RightArrowLeftArrow;", "RightCeiling;", "RightDoubleBracket;", "RightDownTeeVector;", "RightDownVector;",
+	"RightDownVectorBar;", "RightFloor;", "RightTee;", "RightTeeArrow;", "RightTeeVector;", "RightTriangle;",
+	"RightTriangleBar;", "RightTriangleEqual;", "RightUpDownVector;", "RightUpTeeVector;", "RightUpVector;",
+	"RightUpVectorBar;", "RightVector;", "RightVectorBar;", "Rightarrow;", "Ropf;", "RoundImplies;", "Rrightarrow;",
+	"Rscr;", "Rsh;", "RuleDelayed;", "SHCHcy;", "SHcy;", "SOFTcy;", "Sacute;", "Sc;", "Scaron;", "Scedil;", "Scirc;",
+	"Scy;", "Sfr;", "ShortDownArrow;", "ShortLeftArrow;", "ShortRightArrow;", "ShortUpArrow;", "Sigma;", "SmallCircle;",
+	"Sopf;", "Sqrt;", "Square;", "SquareIntersection;", "SquareSubset;", "SquareSubsetEqual;", "SquareSuperset;",
+	"SquareSupersetEqual;", "SquareUnion;", "Sscr;", "Star;", "Sub;", "Subset;", "SubsetEqual;", "Succeeds;",
+	"SucceedsEqual;", "SucceedsSlantEqual;", "SucceedsTilde;", "SuchThat;", "Sum;", "Sup;", "Superset;", "SupersetEqual;",
+	"Supset;", "THORN", "THORN;", "TRADE;", "TSHcy;", "TScy;", "Tab;", "Tau;", "Tcaron;", "Tcedil;", "Tcy;", "Tfr;",
+	"Therefore;", "Theta;", "ThickSpace;", "ThinSpace;", "Tilde;", "TildeEqual;", "TildeFullEqual;", "TildeTilde;",
+	"Topf;", "TripleDot;", "Tscr;", "Tstrok;", "Uacute", "Uacute;", "Uarr;", "Uarrocir;", "Ubrcy;", "Ubreve;", "Ucirc",
+	"Ucirc;", "Ucy;", "Udblac;", "Ufr;", "Ugrave", "Ugrave;", "Umacr;", "UnderBar;", "UnderBrace;", "UnderBracket;",
+	"UnderParenthesis;", "Union;", "UnionPlus;", "Uogon;", "Uopf;", "UpArrow;", "UpArrowBar;", "UpArrowDownArrow;",
+	"UpDownArrow;", "UpEquilibrium;", "UpTee;", "UpTeeArrow;", "Uparrow;", "Updownarrow;", "UpperLeftArrow;",
+	"UpperRightArrow;", "Upsi;", "Upsilon;", "Uring;", "Uscr;", "Utilde;", "Uuml", "Uuml;", "VDash;", "Vbar;", "Vcy;",
+	"Vdash;", "Vdashl;", "Vee;", "Verbar;", "Vert;", "VerticalBar;", "VerticalLine;", "VerticalSeparator;",
+	"VerticalTilde;", "VeryThinSpace;", "Vfr;", "Vopf;", "Vscr;", "Vvdash;", "Wcirc;", "Wedge;", "Wfr;", "Wopf;", "Wscr;",
+	"Xfr;", "Xi;", "Xopf;", "Xscr;", "YAcy;", "YIcy;", "YUcy;", "Yacute", "Yacute;", "Ycirc;", "Ycy;", "Yfr;", "Yopf;",
+	"Yscr;", "Yuml;", "ZHcy;", "Zacute;", "Zcaron;", "Zcy;", "Zdot;", "ZeroWidthSpace;", "Zeta;", "Zfr;", "Zopf;",
+	"Zscr;", "aacute", "aacute;", "abreve;", "ac;", "acE;", "acd;", "acirc", "acirc;", "acute", "acute;", "acy;", "aelig",
+	"aelig;", "af;", "afr;", "agrave", "agrave;", "alefsym;", "aleph;", "alpha;", "amacr;", "amalg;", "amp", "amp;",
+	"and;", "andand;", "andd;", "andslope;", "andv;", "ang;", "ange;", "angle;", "angmsd;", "angmsdaa;", "angmsdab;",
+	"angmsdac;", "angmsdad;", "angmsdae;", "angmsdaf;", "angmsdag;", "angmsdah;", "angrt;", "angrtvb;", "angrtvbd;",
+	"angsph;", "angst;", "angzarr;", "aogon;", "aopf;", "ap;", "apE;", "apacir;", "ape;", "apid;", "apos;", "approx;",
+	"approxeq;", "aring", "aring;", "ascr;", "ast;", "asymp;", "asympeq;", "atilde", "atilde;", "auml", "auml;",
+	"awconint;", "awint;", "bNot;", "backcong;", "backepsilon;", "backprime;", "backsim;", "backsimeq;", "barvee;",
+	"barwed;", "barwedge;", "bbrk;", "bbrktbrk;", "bcong;", "bcy;", "bdquo;", "becaus;", "because;", "bemptyv;", "bepsi;",
+	"bernou;", "beta;", "beth;", "between;", "bfr;", "bigcap;", "bigcirc;", "bigcup;", "bigodot;", "bigoplus;",
+	"bigotimes;", "bigsqcup;", "bigstar;", "bigtriangledown;", "bigtriangleup;", "biguplus;", "bigvee;", "bigwedge;",
+	"bkarow;", "blacklozenge;", "blacksquare;", "blacktriangle;", "blacktriangledown;", "blacktriangleleft;",
+	"blacktriangleright;", "blank;", "blk12;", "blk14;", "blk34;", "block;", "bne;", "bnequiv;", "bnot;", "bopf;", "bot;",
+	"bottom;", "bowtie;", "boxDL;", "boxDR;", "boxDl;", "boxDr;", "boxH;", "boxHD;", "boxHU;", "boxHd;", "boxHu;",
+	"boxUL;", "boxUR;", "boxUl;", "boxUr;", "boxV;", "boxVH;", "boxVL;", "boxVR;", "boxVh;", "boxVl;", "boxVr;",
+	"boxbox;", "boxdL;", "boxdR;", "boxdl;", "boxdr;", "boxh;", "boxhD;", "boxhU;", "boxhd;", "boxhu;", "boxminus;",
+	"boxplus;", "boxtimes;", "boxuL;", "boxuR;", "boxul;", "boxur;", "boxv;", "boxvH;", "boxvL;", "boxvR;", "boxvh;",
+	"boxvl;", "boxvr;", "bprime;", "breve;", "brvbar", "brvbar;", "bscr;", "bsemi;", "bsim;", "bsime;", "bsol;", "bsolb;",
+	"bsolhsub;", "bull;", "bullet;", "bump;", "bumpE;", "bumpe;", "bumpeq;", "cacute;", "cap;", "capand;", "capbrcup;",
+	"capcap;", "capcup;", "capdot;", "caps;", "caret;", "caron;", "ccaps;", "ccaron;", "ccedil", "ccedil;", "ccirc;",
+	"ccups;", "ccupssm;", "cdot;", "cedil", "cedil;", "cemptyv;", "cent", "cent;", "centerdot;", "cfr;", "chcy;",
+	"check;", "checkmark;", "chi;", "cir;", "cirE;", "circ;", "circeq;", "circlearrowleft;", "circlearrowright;",
+	"circledR;", "circledS;", "circledast;", "circledcirc;", "circleddash;", "cire;", "cirfnint;", "cirmid;", "cirscir;",
+	"clubs;", "clubsuit;", "colon;", "colone;", "coloneq;", "comma;", "commat;", "comp;", "compfn;", "complement;",
+	"complexes;", "cong;", "congdot;", "conint;", "copf;", "coprod;", "copy", "copy;", "copysr;", "crarr;", "cross;",
+	"cscr;", "csub;", "csube;", "csup;", "csupe;", "ctdot;", "cudarrl;", "cudarrr;", "cuepr;", "cuesc;", "cularr;",
+	"cularrp;", "cup;", "cupbrcap;", "cupcap;", "cupcup;", "cupdot;", "cupor;", "cups;", "curarr;", "curarrm;",
+	"curlyeqprec;", "curlyeqsucc;", "curlyvee;", "curlywedge;", "curren", "curren;", "curvearrowleft;",
+	"curvearrowright;", "cuvee;", "cuwed;", "cwconint;", "cwint;", "cylcty;", "dArr;", "dHar;", "dagger;", "daleth;",
+	"darr;", "dash;", "dashv;", "dbkarow;", "dblac;", "dcaron;", "dcy;", "dd;", "ddagger;", "ddarr;", "ddotseq;", "deg",
+	"deg;", "delta;", "demptyv;", "dfisht;", "dfr;", "dharl;", "dharr;", "diam;", "diamond;", "diamondsuit;", "diams;",
+	"die;", "digamma;", "disin;", "div;", "divide", "divide;", "divideontimes;", "divonx;", "djcy;", "dlcorn;", "dlcrop;",
+	"dollar;", "dopf;", "dot;", "doteq;", "doteqdot;", "dotminus;", "dotplus;", "dotsquare;", "doublebarwedge;",
+	"downarrow;", "downdownarrows;", "downharpoonleft;", "downharpoonright;", "drbkarow;", "drcorn;", "drcrop;", "dscr;",
+	"dscy;", "dsol;", "dstrok;", "dtdot;", "dtri;", "dtrif;", "duarr;", "duhar;", "dwangle;", "dzcy;", "dzigrarr;",
+	"eDDot;", "eDot;", "eacute", "eacute;", "easter;", "ecaron;", "ecir;", "ecirc", "ecirc;", "ecolon;", "ecy;", "edot;",
+	"ee;", "efDot;", "efr;", "eg;", "egrave", "egrave;", "egs;", "egsdot;", "el;", "elinters;", "ell;", "els;", "elsdot;",
+	"emacr;", "empty;", "emptyset;", "emptyv;", "emsp13;", "emsp14;", "emsp;", "eng;", "ensp;", "eogon;", "eopf;",
+	"epar;", "eparsl;", "eplus;", "epsi;", "epsilon;", "epsiv;", "eqcirc;", "eqcolon;", "eqsim;", "eqslantgtr;",
+	"eqslantless;", "equals;", "equest;", "equiv;", "equivDD;", "eqvparsl;", "erDot;", "erarr;", "escr;", "esdot;",
+	"esim;", "eta;", "eth", "eth;", "euml", "euml;", "euro;", "excl;", "exist;", "expectation;", "exponentiale;",
+	"fallingdotseq;", "fcy;", "female;", "ffilig;", "fflig;", "ffllig;", "ffr;", "filig;", "fjlig;", "flat;", "fllig;",
+	"fltns;", "fnof;", "fopf;", "forall;", "fork;", "forkv;", "fpartint;", "frac12", "frac12;", "frac13;", "frac14",
+	"frac14;", "frac15;", "frac16;", "frac18;", "frac23;", "frac25;", "frac34", "frac34;", "frac35;", "frac38;",
+	"frac45;", "frac56;", "frac58;", "frac78;", "frasl;", "frown;", "fscr;", "gE;", "gEl;", "gacute;", "gamma;",
+	"gammad;", "gap;", "gbreve;", "gcirc;", "gcy;", "gdot;", "ge;", "gel;", "geq;", "geqq;", "geqslant;", "ges;",
+	"gescc;", "gesdot;", "gesdoto;", "gesdotol;", "gesl;", "gesles;", "gfr;", "gg;", "ggg;", "gimel;", "gjcy;", "gl;",
+	"glE;", "gla;", "glj;", "gnE;", "gnap;", "gnapprox;", "gne;", "gneq;", "gneqq;", "gnsim;", "gopf;", "grave;", "gscr;",
+	"gsim;", "gsime;", "gsiml;", "gt", "gt;", "gtcc;", "gtcir;", "gtdot;", "gtlPar;", "gtquest;", "gtrapprox;", "gtrarr;",
+	"gtrdot;", "gtreqless;", "gtreqqless;", "gtrless;", "gtrsim;", "gvertneqq;", "gvnE;", "hArr;", "hairsp;", "half;",
+	"hamilt;", "hardcy;", "harr;", "harrcir;", "harrw;", "hbar;", "hcirc;", "hearts;", "heartsuit;", "hellip;", "hercon;",
+	"hfr;", "hksearow;", "hkswarow;", "hoarr;", "homtht;", "hookleftarrow;", "hookrightarrow;", "hopf;", "horbar;",
+	"hscr;", "hslash;", "hstrok;", "hybull;", "hyphen;", "iacute", "iacute;", "ic;", "icirc", "icirc;", "icy;", "iecy;",
+	"iexcl", "iexcl;", "iff;", "ifr;", "igrave", "igrave;", "ii;", "iiiint;", "iiint;", "iinfin;", "iiota;", "ijlig;",
+	"imacr;", "image;", "imagline;", "imagpart;", "imath;", "imof;", "imped;", "in;", "incare;", "infin;", "infintie;",
+	"inodot;", "int;", "intcal;", "integers;", "intercal;", "intlarhk;", "intprod;", "iocy;", "iogon;", "iopf;", "iota;",
+	"iprod;", "iquest", "iquest;", "iscr;", "isin;", "isinE;", "isindot;", "isins;", "isinsv;", "isinv;", "it;",
+	"itilde;", "iukcy;", "iuml", "iuml;", "jcirc;", "jcy;", "jfr;", "jmath;", "jopf;", "jscr;", "jsercy;", "jukcy;",
+	"kappa;", "kappav;", "kcedil;", "kcy;", "kfr;", "kgreen;", "khcy;", "kjcy;", "kopf;", "kscr;", "lAarr;", "lArr;",
+	"lAtail;", "lBarr;", "lE;", "lEg;", "lHar;", "lacute;", "laemptyv;", "lagran;", "lambda;", "lang;", "langd;",
+	"langle;", "lap;", "laquo", "laquo;", "larr;", "larrb;", "larrbfs;", "larrfs;", "larrhk;", "larrlp;", "larrpl;",
+	"larrsim;", "larrtl;", "lat;", "latail;", "late;", "lates;", "lbarr;", "lbbrk;", "lbrace;", "lbrack;", "lbrke;",
+	"lbrksld;", "lbrkslu;", "lcaron;", "lcedil;", "lceil;", "lcub;", "lcy;", "ldca;", "ldquo;", "ldquor;", "ldrdhar;",
+	"ldrushar;", "ldsh;", "le;", "leftarrow;", "leftarrowtail;", "leftharpoondown;", "leftharpoonup;", "leftleftarrows;",
+	"leftrightarrow;", "leftrightarrows;", "leftrightharpoons;", "leftrightsquigarrow;", "leftthreetimes;", "leg;",
+	"leq;", "leqq;", "leqslant;", "les;", "lescc;", "lesdot;", "lesdoto;", "lesdotor;", "lesg;", "lesges;", "lessapprox;",
+	"lessdot;", "lesseqgtr;", "lesseqqgtr;", "lessgtr;", "lesssim;", "lfisht;", "lfloor;", "lfr;", "lg;", "lgE;",
+	"lhard;", "lharu;", "lharul;", "lhblk;", "ljcy;", "ll;", "llarr;", "llcorner;", "llhard;", "lltri;", "lmidot;",
+	"lmoust;", "lmoustache;", "lnE;", "lnap;", "lnapprox;", "lne;", "lneq;", "lneqq;", "lnsim;", "loang;", "loarr;",
+	"lobrk;", "longleftarrow;", "longleftrightarrow;", "longmapsto;", "longrightarrow;", "looparrowleft;",
+	"looparrowright;", "lopar;", "lopf;", "loplus;", "lotimes;", "lowast;", "lowbar;", "loz;", "lozenge;", "lozf;",
+	"lpar;", "lparlt;", "lrarr;", "lrcorner;", "lrhar;", "lrhard;", "lrm;", "lrtri;", "lsaquo;", "lscr;", "lsh;", "lsim;",
+	"lsime;", "lsimg;", "lsqb;", "lsquo;", "lsquor;", "lstrok;", "lt", "lt;", "ltcc;", "ltcir;", "ltdot;", "lthree;",
+	"ltimes;", "ltlarr;", "ltquest;", "ltrPar;", "ltri;", "ltrie;", "ltrif;", "lurdshar;", "luruhar;", "lvertneqq;",
+	"lvnE;", "mDDot;", "macr", "macr;", "male;", "malt;", "maltese;", "map;", "mapsto;", "mapstodown;", "mapstoleft;",
+	"mapstoup;", "marker;", "mcomma;", "mcy;", "mdash;", "measuredangle;", "mfr;", "mho;", "micro", "micro;", "mid;",
+	"midast;", "midcir;", "middot", "middot;", "minus;", "minusb;", "minusd;", "minusdu;", "mlcp;", "mldr;", "mnplus;",
+	"models;", "mopf;", "mp;", "mscr;", "mstpos;", "mu;", "multimap;", "mumap;", "nGg;", "nGt;", "nGtv;", "nLeftarrow;",
+	"nLeftrightarrow;", "nLl;", "nLt;", "nLtv;", "nRightarrow;", "nVDash;", "nVdash;", "nabla;", "nacute;", "nang;",
+	"nap;", "napE;", "napid;", "napos;", "napprox;", "natur;", "natural;", "naturals;", "nbsp", "nbsp;", "nbump;",
+	"nbumpe;", "ncap;", "ncaron;", "ncedil;", "ncong;", "ncongdot;", "ncup;", "ncy;", "ndash;", "ne;", "neArr;",
+	"nearhk;", "nearr;", "nearrow;", "nedot;", "nequiv;", "nesear;", "nesim;", "nexist;", "nexists;", "nfr;", "ngE;",
+	"nge;", "ngeq;", "ngeqq;", "ngeqslant;", "nges;", "ngsim;", "ngt;", "ngtr;", "nhArr;", "nharr;", "nhpar;", "ni;",
+	"nis;", "nisd;", "niv;", "njcy;", "nlArr;", "nlE;", "nlarr;", "nldr;", "nle;", "nleftarrow;", "nleftrightarrow;",
+	"nleq;", "nleqq;", "nleqslant;", "nles;", "nless;", "nlsim;", "nlt;", "nltri;", "nltrie;", "nmid;", "nopf;", "not",
+	"not;", "notin;", "notinE;", "notindot;", "notinva;", "notinvb;", "notinvc;", "notni;", "notniva;", "notnivb;",
+	"notnivc;", "npar;", "nparallel;", "nparsl;", "npart;", "npolint;", "npr;", "nprcue;", "npre;", "nprec;", "npreceq;",
+	"nrArr;", "nrarr;", "nrarrc;", "nrarrw;", "nrightarrow;", "nrtri;", "nrtrie;", "nsc;", "nsccue;", "nsce;", "nscr;",
+	"nshortmid;", "nshortparallel;", "nsim;", "nsime;", "nsimeq;", "nsmid;", "nspar;", "nsqsube;", "nsqsupe;", "nsub;",
+	"nsubE;", "nsube;", "nsubset;", "nsubseteq;", "nsubseteqq;", "nsucc;", "nsucceq;", "nsup;", "nsupE;", "nsupe;",
+	"nsupset;", "nsupseteq;", "nsupseteqq;", "ntgl;", "ntilde", "ntilde;", "ntlg;", "ntriangleleft;", "ntrianglelefteq;",
+	"ntriangleright;", "ntrianglerighteq;", "nu;", "num;", "numero;", "numsp;", "nvDash;", "nvHarr;", "nvap;", "nvdash;",
+	"nvge;", "nvgt;", "nvinfin;", "nvlArr;", "nvle;", "nvlt;", "nvltrie;", "nvrArr;", "nvrtrie;", "nvsim;", "nwArr;",
+	"nwarhk;", "nwarr;", "nwarrow;", "nwnear;", "oS;", "oacute", "oacute;", "oast;", "ocir;", "ocirc", "ocirc;", "ocy;",
+	"odash;", "odblac;", "odiv;", "odot;", "odsold;", "oelig;", "ofcir;", "ofr;", "ogon;", "ograve", "ograve;", "ogt;",
+	"ohbar;", "ohm;", "oint;", "olarr;", "olcir;", "olcross;", "oline;", "olt;", "omacr;", "omega;", "omicron;", "omid;",
+	"ominus;", "oopf;", "opar;", "operp;", "oplus;", "or;", "orarr;", "ord;", "order;", "orderof;", "ordf", "ordf;",
+	"ordm", "ordm;", "origof;", "oror;", "orslope;", "orv;", "oscr;", "oslash", "oslash;", "osol;", "otilde", "otilde;",
+	"otimes;", "otimesas;", "ouml", "ouml;", "ovbar;", "par;", "para", "para;", "parallel;", "parsim;", "parsl;", "part;",
+	"pcy;", "percnt;", "period;", "permil;", "perp;", "pertenk;", "pfr;", "phi;", "phiv;", "phmmat;", "phone;", "pi;",
+	"pitchfork;", "piv;", "planck;", "planckh;", "plankv;", "plus;", "plusacir;", "plusb;", "pluscir;", "plusdo;",
+	"plusdu;", "pluse;", "plusmn", "plusmn;", "plussim;", "plustwo;", "pm;", "pointint;", "popf;", "pound", "pound;",
+	"pr;", "prE;", "prap;", "prcue;", "pre;", "prec;", "precapprox;", "preccurlyeq;", "preceq;", "precnapprox;",
+	"precneqq;", "precnsim;", "precsim;", "prime;", "primes;", "prnE;", "prnap;", "prnsim;", "prod;", "profalar;",
+	"profline;", "profsurf;", "prop;", "propto;", "prsim;", "prurel;", "pscr;", "psi;", "puncsp;", "qfr;", "qint;",
+	"qopf;", "qprime;", "qscr;", "quaternions;", "quatint;", "quest;", "questeq;", "quot", "quot;", "rAarr;", "rArr;",
+	"rAtail;", "rBarr;", "rHar;", "race;", "racute;", "radic;", "raemptyv;", "rang;", "rangd;", "range;", "rangle;",
+	"raquo", "raquo;", "rarr;", "rarrap;", "rarrb;", "rarrbfs;", "rarrc;", "rarrfs;", "rarrhk;", "rarrlp;", "rarrpl;",
+	"rarrsim;", "rarrtl;", "rarrw;", "ratail;", "ratio;", "rationals;", "rbarr;", "rbbrk;", "rbrace;", "rbrack;",
+	"rbrke;", "rbrksld;", "rbrkslu;", "rcaron;", "rcedil;", "rceil;", "rcub;", "rcy;", "rdca;", "rdldhar;", "rdquo;",
+	"rdquor;", "rdsh;", "real;", "realine;", "realpart;", "reals;", "rect;", "reg", "reg;", "rfisht;", "rfloor;", "rfr;",
+	"rhard;", "rharu;", "rharul;", "rho;", "rhov;", "rightarrow;", "rightarrowtail;", "rightharpoondown;",
+	"rightharpoonup;", "rightleftarrows;", "rightleftharpoons;", "rightrightarrows;", "rightsquigarrow;",
+	"rightthreetimes;", "ring;", "risingdotseq;", "rlarr;", "rlhar;", "rlm;", "rmoust;", "rmoustache;", "rnmid;",
+	"roang;", "roarr;", "robrk;", "ropar;", "ropf;", "roplus;", "rotimes;", "rpar;", "rpargt;", "rppolint;", "rrarr;",
+	"rsaquo;", "rscr;", "rsh;", "rsqb;", "rsquo;", "rsquor;", "rthree;", "rtimes;", "rtri;", "rtrie;", "rtrif;",
+	"rtriltri;", "ruluhar;", "rx;", "sacute;", "sbquo;", "sc;", "scE;", "scap;", "scaron;", "sccue;", "sce;", "scedil;",
+	"scirc;", "scnE;", "scnap;", "scnsim;", "scpolint;", "scsim;", "scy;", "sdot;", "sdotb;", "sdote;", "seArr;",
+	"searhk;", "searr;", "searrow;", "sect", "sect;", "semi;", "seswar;", "setminus;", "setmn;", "sext;", "sfr;",
+	"sfrown;", "sharp;", "shchcy;", "shcy;", "shortmid;", "shortparallel;", "shy", "shy;", "sigma;", "sigmaf;", "sigmav;",
+	"sim;", "simdot;", "sime;", "simeq;", "simg;", "simgE;", "siml;", "simlE;", "simne;", "simplus;", "simrarr;",
+	"slarr;", "smallsetminus;", "smashp;", "smeparsl;", "smid;", "smile;", "smt;", "smte;", "smtes;", "softcy;", "sol;",
+	"solb;", "solbar;", "sopf;", "spades;", "spadesuit;", "spar;", "sqcap;", "sqcaps;", "sqcup;", "sqcups;", "sqsub;",
+	"sqsube;", "sqsubset;", "sqsubseteq;", "sqsup;", "sqsupe;", "sqsupset;", "sqsupseteq;", "squ;", "square;", "squarf;",
+	"squf;", "srarr;", "sscr;", "ssetmn;", "ssmile;", "sstarf;", "star;", "starf;", "straightepsilon;", "straightphi;",
+	"strns;", "sub;", "subE;", "subdot;", "sube;", "subedot;", "submult;", "subnE;", "subne;", "subplus;", "subrarr;",
+	"subset;", "subseteq;", "subseteqq;", "subsetneq;", "subsetneqq;", "subsim;", "subsub;", "subsup;", "succ;",
+	"succapprox;", "succcurlyeq;", "succeq;", "succnapprox;", "succneqq;", "succnsim;", "succsim;", "sum;", "sung;",
+	"sup1", "sup1;", "sup2", "sup2;", "sup3", "sup3;", "sup;", "supE;", "supdot;", "supdsub;", "supe;", "supedot;",
+	"suphsol;", "suphsub;", "suplarr;", "supmult;", "supnE;", "supne;", "supplus;", "supset;", "supseteq;", "supseteqq;",
+	"supsetneq;", "supsetneqq;", "supsim;", "supsub;", "supsup;", "swArr;", "swarhk;", "swarr;", "swarrow;", "swnwar;",
+	"szlig", "szlig;", "target;", "tau;", "tbrk;", "tcaron;", "tcedil;", "tcy;", "tdot;", "telrec;", "tfr;", "there4;",
+	"therefore;", "theta;", "thetasym;", "thetav;", "thickapprox;", "thicksim;", "thinsp;", "thkap;", "thksim;", "thorn",
+	"thorn;", "tilde;", "times", "times;", "timesb;", "timesbar;", "timesd;", "tint;", "toea;", "top;", "topbot;",
+	"topcir;", "topf;", "topfork;", "tosa;", "tprime;", "trade;", "triangle;", "triangledown;", "triangleleft;",
+	"trianglelefteq;", "triangleq;", "triangleright;", "trianglerighteq;", "tridot;", "trie;", "triminus;", "triplus;",
+	"trisb;", "tritime;", "trpezium;", "tscr;", "tscy;", "tshcy;", "tstrok;", "twixt;", "twoheadleftarrow;",
+	"twoheadrightarrow;", "uArr;", "uHar;", "uacute", "uacute;", "uarr;", "ubrcy;", "ubreve;", "ucirc", "ucirc;", "ucy;",
+	"udarr;", "udblac;", "udhar;", "ufisht;", "ufr;", "ugrave", "ugrave;", "uharl;", "uharr;", "uhblk;", "ulcorn;",
+	"ulcorner;", "ulcrop;", "ultri;", "umacr;", "uml", "uml;", "uogon;", "uopf;", "uparrow;", "updownarrow;",
+	"upharpoonleft;", "upharpoonright;", "uplus;", "upsi;", "upsih;", "upsilon;", "upuparrows;", "urcorn;", "urcorner;",
+	"urcrop;", "uring;", "urtri;", "uscr;", "utdot;", "utilde;", "utri;", "utrif;", "uuarr;", "uuml", "uuml;", "uwangle;",
+	"vArr;", "vBar;", "vBarv;", "vDash;", "vangrt;", "varepsilon;", "varkappa;", "varnothing;", "varphi;", "varpi;",
+	"varpropto;", "varr;", "varrho;", "varsigma;", "varsubsetneq;", "varsubsetneqq;", "varsupsetneq;", "varsupsetneqq;",
+	"vartheta;", "vartriangleleft;", "vartriangleright;", "vcy;", "vdash;", "vee;", "veebar;", "veeeq;", "vellip;",
+	"verbar;", "vert;", "vfr;", "vltri;", "vnsub;", "vnsup;", "vopf;", "vprop;", "vrtri;", "vscr;", "vsubnE;", "vsubne;",
+	"vsupnE;", "vsupne;", "vzigzag;", "wcirc;", "wedbar;", "wedge;", "wedgeq;", "weierp;", "wfr;", "wopf;", "wp;", "wr;",
+	"wreath;", "wscr;", "xcap;", "xcirc;", "xcup;", "xdtri;", "xfr;", "xhArr;", "xharr;", "xi;", "xlArr;", "xlarr;",
+	"xmap;", "xnis;", "xodot;", "xopf;", "xoplus;", "xotime;", "xrArr;", "xrarr;", "xscr;", "xsqcup;", "xuplus;",
+	"xutri;", "xvee;", "xwedge;", "yacute", "yacute;", "yacy;", "ycirc;", "ycy;", "yen", "yen;", "yfr;", "yicy;", "yopf;",
+	"yscr;", "yucy;", "yuml", "yuml;", "zacute;", "zcaron;", "zcy;", "zdot;", "zeetrf;", "zeta;", "zfr;", "zhcy;",
+	"zigrarr;", "zopf;", "zscr;", "zwj;", "zwnj;"
+};
+const std::size_t COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
+
+///NAMES ƓԂ̃̕R[h|Cgi1̏ꍇA2ڂ0j
+const std::uint32_t CODE_POINTS[][2] = {
+	{0xC6, 0}, {0xC6, 0}, {0x26, 0}, {0x26, 0}, {0xC1, 0}, {0xC1, 0}, {0x102, 0}, {0xC2, 0}, {0xC2, 0},
+	{0x410, 0}, {0x1D504, 0}, {0xC0, 0}, {0xC0, 0}, {0x391, 0}, {0x100, 0}, {0x2A53, 0}, {0x104, 0},
+	{0x1D538, 0}, {0x2061, 0}, {0xC5, 0}, {0xC5, 0}, {0x1D49C, 0}, {0x2254, 0}, {0xC3, 0}, {0xC3, 0},
+	{0xC4, 0}, {0xC4, 0}, {0x2216, 0}, {0x2AE7, 0}, {0x2306, 0}, {0x411, 0}, {0x2235, 0}, {0x212C, 0},
+	{0x392, 0}, {0x1D505, 0}, {0x1D539, 0}, {0x2D8, 0}, {0x212C, 0}, {0x224E, 0}, {0x427, 0}, {0xA9, 0},
+	{0xA9, 0}, {0x106, 0}, {0x22D2, 0}, {0x2145, 0}, {0x212D, 0}, {0x10C, 0}, {0xC7, 0}, {0xC7, 0},
+	{0x108, 0}, {0x2230, 0}, {0x10A, 0}, {0xB8, 0}, {0xB7, 0}, {0x212D, 0}, {0x3A7, 0}, {0x2299, 0},
+	{0x2296, 0}, {0x2295, 0}, {0x2297, 0}, {0x2232, 0}, {0x201D, 0}, {0x2019, 0}, {0x2237, 0},
+	{0x2A74, 0}, {0x2261, 0}, {0x222F, 0}, {0x222E, 0}, {0x2102, 0}, {0x2210, 0}, {0x2233, 0},
+	{0x2A2F, 0}, {0x1D49E, 0}, {0x22D3, 0}, {0x224D, 0}, {0x2145, 0}, {0x2911, 0}, {0x402, 0}, {0x405, 0},
+	{0x40F, 0}, {0x2021, 0}, {0x21A1, 0}, {0x2AE4, 0}, {0x10E, 0}, {0x414, 0}, {0x2207, 0}, {0x394, 0},
+	{0x1D507, 0}, {0xB4, 0}, {0x2D9, 0}, {0x2DD, 0}, {0x60, 0}, {0x2DC, 0}, {0x22C4, 0}, {0x2146, 0},
+	{0x1D53B, 0}, {0xA8, 0}, {0x20DC, 0}, {0x2250, 0}, {0x222F, 0}, {0xA8, 0}, {0x21D3, 0}, {0x21D0, 0},
+	{0x21D4, 0}, {0x2AE4, 0}, {0x27F8, 0}, {0x27FA, 0}, {0x27F9, 0}, {0x21D2, 0}, {0x22A8, 0},
+	{0x21D1, 0}, {0x21D5, 0}, {0x2225, 0}, {0x2193, 0}, {0x2913, 0}, {0x21F5, 0}, {0x311, 0}, {0x2950, 0},
+	{0x295E, 0}, {0x21BD, 0}, {0x2956, 0}, {0x295F, 0}, {0x21C1, 0}, {0x2957, 0}, {0x22A4, 0},
+	{0x21A7, 0}, {0x21D3, 0}, {0x1D49F, 0}, {0x110, 0}, {0x14A, 0}, {0xD0, 0}, {0xD0, 0}, {0xC9, 0},
+	{0xC9, 0}, {0x11A, 0}, {0xCA, 0}, {0xCA, 0}, {0x42D, 0}, {0x116, 0}, {0x1D508, 0}, {0xC8, 0},
+	{0xC8, 0}, {0x2208, 0}, {0x112, 0}, {0x25FB, 0}, {0x25AB, 0}, {0x118, 0}, {0x1D53C, 0}, {0x395, 0},
+	{0x2A75, 0}, {0x2242, 0}, {0x21CC, 0}, {0x2130, 0}, {0x2A73, 0}, {0x397, 0}, {0xCB, 0}, {0xCB, 0},
+	{0x2203, 0}, {0x2147, 0}, {0x424, 0}, {0x1D509, 0}, {0x25FC, 0}, {0x25AA, 0}, {0x1D53D, 0},
+	{0x2200, 0}, {0x2131, 0}, {0x2131, 0}, {0x403, 0}, {0x3E, 0}, {0x3E, 0}, {0x393, 0}, {0x3DC, 0},
+	{0x11E, 0}, {0x122, 0}, {0x11C, 0}, {0x413, 0}, {0x120, 0}, {0x1D50A, 0}, {0x22D9, 0}, {0x1D53E, 0},
+	{0x2265, 0}, {0x22DB, 0}, {0x2267, 0}, {0x2AA2, 0}, {0x2277, 0}, {0x2A7E, 0}, {0x2273, 0},
+	{0x1D4A2, 0}, {0x226B, 0}, {0x42A, 0}, {0x2C7, 0}, {0x5E, 0}, {0x124, 0}, {0x210C, 0}, {0x210B, 0},
+	{0x210D, 0}, {0x2500, 0}, {0x210B, 0}, {0x126, 0}, {0x224E, 0}, {0x224F, 0}, {0x415, 0}, {0x132, 0},
+	{0x401, 0}, {0xCD, 0}, {0xCD, 0}, {0xCE, 0}, {0xCE, 0}, {0x418, 0}, {0x130, 0}, {0x2111, 0},
+	{0xCC, 0}, {0xCC, 0}, {0x2111, 0}, {0x12A, 0}, {0x2148, 0}, {0x21D2, 0}, {0x222C, 0}, {0x222B, 0},
+	{0x22C2, 0}, {0x2063, 0}, {0x2062, 0}, {0x12E, 0}, {0x1D540, 0}, {0x399, 0}, {0x2110, 0}, {0x128, 0},
+	{0x406, 0}, {0xCF, 0}, {0xCF, 0}, {0x134, 0}, {0x419, 0}, {0x1D50D, 0}, {0x1D541, 0}, {0x1D4A5, 0},
+	{0x408, 0}, {0x404, 0}, {0x425, 0}, {0x40C, 0}, {0x39A, 0}, {0x136, 0}, {0x41A, 0}, {0x1D50E, 0},
+	{0x1D542, 0}, {0x1D4A6, 0}, {0x409, 0}, {0x3C, 0}, {0x3C, 0}, {0x139, 0}, {0x39B, 0}, {0x27EA, 0},
+	{0x2112, 0}, {0x219E, 0}, {0x13D, 0}, {0x13B, 0}, {0x41B, 0}, {0x27E8, 0}, {0x2190, 0}, {0x21E4, 0},
+	{0x21C6, 0}, {0x2308, 0}, {0x27E6, 0}, {0x2961, 0}, {0x21C3, 0}, {0x2959, 0}, {0x230A, 0},
+	{0x2194, 0}, {0x294E, 0}, {0x22A3, 0}, {0x21A4, 0}, {0x295A, 0}, {0x22B2, 0}, {0x29CF, 0},
+	{0x22B4, 0}, {0x2951, 0}, {0x2960, 0}, {0x21BF, 0}, {0x2958, 0}, {0x21BC, 0}, {0x2952, 0},
+	{0x21D0, 0}, {0x21D4, 0}, {0x22DA, 0}, {0x2266, 0}, {0x2276, 0}, {0x2AA1, 0}, {0x2A7D, 0},
+	{0x2272, 0}, {0x1D50F, 0}, {0x22D8, 0}, {0x21DA, 0}, {0x13F, 0}, {0x27F5, 0}, {0x27F7, 0},
+	{0x27F6, 0}, {0x27F8, 0}, {0x27FA, 0}, {0x27F9, 0}, {0x1D543, 0}, {0x2199, 0}, {0x2198, 0},
+	{0x2112, 0}, {0x21B0, 0}, {0x141, 0}, {0x226A, 0}, {0x2905, 0}, {0x41C, 0}, {0x205F, 0}, {0x2133, 0},
+	{0x1D510, 0}, {0x2213, 0}, {0x1D544, 0}, {0x2133, 0}, {0x39C, 0}, {0x40A, 0}, {0x143, 0}, {0x147, 0},
+	{0x145, 0}, {0x41D, 0}, {0x200B, 0}, {0x200B, 0}, {0x200B, 0}, {0x200B, 0}, {0x226B, 0}, {0x226A, 0},
+	{0xA, 0}, {0x1D511, 0}, {0x2060, 0}, {0xA0, 0}, {0x2115, 0}, {0x2AEC, 0}, {0x2262, 0}, {0x226D, 0},
+	{0x2226, 0}, {0x2209, 0}, {0x2260, 0}, {0x2242, 0x338}, {0x2204, 0}, {0x226F, 0}, {0x2271, 0},
+	{0x2267, 0x338}, {0x226B, 0x338}, {0x2279, 0}, {0x2A7E, 0x338}, {0x2275, 0}, {0x224E, 0x338}, {0x224F, 0x338},
+	{0x22EA, 0}, {0x29CF, 0x338}, {0x22EC, 0}, {0x226E, 0}, {0x2270, 0}, {0x2278, 0}, {0x226A, 0x338},
+	{0x2A7D, 0x338}, {0x2274, 0}, {0x2AA2, 0x338}, {0x2AA1, 0x338}, {0x2280, 0}, {0x2AAF, 0x338}, {0x22E0, 0},
+	{0x220C, 0}, {0x22EB, 0}, {0x29D0, 0x338}, {0x22ED, 0}, {0x228F, 0x338}, {0x22E2, 0}, {0x2290, 0x338},
+	{0x22E3, 0}, {0x2282, 0x20D2}, {0x2288, 0}, {0x2281, 0}, {0x2AB0, 0x338}, {0x22E1, 0}, {0x227F, 0x338},
+	{0x2283, 0x20D2}, {0x2289, 0}, {0x2241, 0}, {0x2244, 0}, {0x2247, 0}, {0x2249, 0}, {0x2224, 0},
+	{0x1D4A9, 0}, {0xD1, 0}, {0xD1, 0}, {0x39D, 0}, {0x152, 0}, {0xD3, 0}, {0xD3, 0}, {0xD4, 0},
+	{0xD4, 0}, {0x41E, 0}, {0x150, 0}, {0x1D512, 0}, {0xD2, 0}, {0xD2, 0}, {0x14C, 0}, {0x3A9, 0},
+	{0x39F, 0}, {0x1D546, 0}, {0x201C, 0}, {0x2018, 0}, {0x2A54, 0}, {0x1D4AA, 0}, {0xD8, 0}, {0xD8, 0},
+	{0xD5, 0}, {0xD5, 0}, {0x2A37, 0}, {0xD6, 0}, {0xD6, 0}, {0x203E, 0}, {0x23DE, 0}, {0x23B4, 0},
+	{0x23DC, 0}, {0x2202, 0}, {0x41F, 0}, {0x1D513, 0}, {0x3A6, 0}, {0x3A0, 0}, {0xB1, 0}, {0x210C, 0},
+	{0x2119, 0}, {0x2ABB, 0}, {0x227A, 0}, {0x2AAF, 0}, {0x227C, 0}, {0x227E, 0}, {0x2033, 0},
+	{0x220F, 0}, {0x2237, 0}, {0x221D, 0}, {0x1D4AB, 0}, {0x3A8, 0}, {0x22, 0}, {0x22, 0}, {0x1D514, 0},
+	{0x211A, 0}, {0x1D4AC, 0}, {0x2910, 0}, {0xAE, 0}, {0xAE, 0}, {0x154, 0}, {0x27EB, 0}, {0x21A0, 0},
+	{0x2916, 0}, {0x158, 0}, {0x156, 0}, {0x420, 0}, {0x211C, 0}, {0x220B, 0}, {0x21CB, 0}, {0x296F, 0},
+	{0x211C, 0}, {0x3A1, 0}, {0x27E9, 0}, {0x2192, 0}, {0x21E5, 0}, {0x21C4, 0}, {0x2309, 0}, {0x27E7, 0},
+	{0x295D, 0}, {0x21C2, 0}, {0x2955, 0}, {0x230B, 0}, {0x22A2, 0}, {0x21A6, 0}, {0x295B, 0},
+	{0x22B3, 0}, {0x29D0, 0}, {0x22B5, 0}, {0x294F, 0}, {0x295C, 0}, {0x21BE, 0}, {0x2954, 0},
+	{0x21C0, 0}, {0x2953, 0}, {0x21D2, 0}, {0x211D, 0}, {0x2970, 0}, {0x21DB, 0}, {0x211B, 0},
+	{0x21B1, 0}, {0x29F4, 0}, {0x429, 0}, {0x428, 0}, {0x42C, 0}, {0x15A, 0}, {0x2ABC, 0}, {0x160, 0},
+	{0x15E, 0}, {0x15C, 0}, {0x421, 0}, {0x1D516, 0}, {0x2193, 0}, {0x2190, 0}, {0x2192, 0}, {0x2191, 0},
+	{0x3A3, 0}, {0x2218, 0}, {0x1D54A, 0}, {0x221A, 0}, {0x25A1, 0}, {0x2293, 0}, {0x228F, 0},
+	{0x2291, 0}, {0x2290, 0}, {0x2292, 0}, {0x2294, 0}, {0x1D4AE, 0}, {0x22C6, 0}, {0x22D0, 0},
+	{0x22D0, 0}, {0x2286, 0}, {0x227B, 0}, {0x2AB0, 0}, {0x227D, 0}, {0x227F, 0}, {0x220B, 0},
+	{0x2211, 0}, {0x22D1, 0}, {0x2283, 0}, {0x2287, 0}, {0x22D1, 0}, {0xDE, 0}, {0xDE, 0}, {0x2122, 0},
+	{0x40B, 0}, {0x426, 0}, {0x9, 0}, {0x3A4, 0}, {0x164, 0}, {0x162, 0}, {0x422, 0}, {0x1D517, 0},
+	{0x2234, 0}, {0x398, 0}, {0x205F, 0x200A}, {0x2009, 0}, {0x223C, 0}, {0x2243, 0}, {0x2245, 0},
+	{0x2248, 0}, {0x1D54B, 0}, {0x20DB, 0}, {0x1D4AF, 0}, {0x166, 0}, {0xDA, 0}, {0xDA, 0}, {0x219F, 0},
+	{0x2949, 0}, {0x40E, 0}, {0x16C, 0}, {0xDB, 0}, {0xDB, 0}, {0x423, 0}, {0x170, 0}, {0x1D518, 0},
+	{0xD9, 0}, {0xD9, 0}, {0x16A, 0}, {0x5F, 0}, {0x23DF, 0}, {0x23B5, 0}, {0x23DD, 0}, {0x22C3, 0},
+	{0x228E, 0}, {0x172, 0}, {0x1D54C, 0}, {0x2191, 0}, {0x2912, 0}, {0x21C5, 0}, {0x2195, 0},
+	{0x296E, 0}, {0x22A5, 0}, {0x21A5, 0}, {0x21D1, 0}, {0x21D5, 0}, {0x2196, 0}, {0x2197, 0}, {0x3D2, 0},
+	{0x3A5, 0}, {0x16E, 0}, {0x1D4B0, 0}, {0x168, 0}, {0xDC, 0}, {0xDC, 0}, {0x22AB, 0}, {0x2AEB, 0},
+	{0x412, 0}, {0x22A9, 0}, {0x2AE6, 0}, {0x22C1, 0}, {0x2016, 0}, {0x2016, 0}, {0x2223, 0}, {0x7C, 0},
+	{0x2758, 0}, {0x2240, 0}, {0x200A, 0}, {0x1D519, 0}, {0x1D54D, 0}, {0x1D4B1, 0}, {0x22AA, 0},
+	{0x174, 0}, {0x22C0, 0}, {0x1D51A, 0}, {0x1D54E, 0}, {0x1D4B2, 0}, {0x1D51B, 0}, {0x39E, 0},
+	{0x1D54F, 0}, {0x1D4B3, 0}, {0x42F, 0}, {0x407, 0}, {0x42E, 0}, {0xDD, 0}, {0xDD, 0}, {0x176, 0},
+	{0x42B, 0}, {0x1D51C, 0}, {0x1D550, 0}, {0x1D4B4, 0}, {0x178, 0}, {0x416, 0}, {0x179, 0}, {0x17D, 0},
+	{0x417, 0}, {0x17B, 0}, {0x200B, 0}, {0x396, 0}, {0x2128, 0}, {0x2124, 0}, {0x1D4B5, 0}, {0xE1, 0},
+	{0xE1, 0}, {0x103, 0}, {0x223E, 0}, {0x223E, 0x333}, {0x223F, 0}, {0xE2, 0}, {0xE2, 0}, {0xB4, 0},
+	{0xB4, 0}, {0x430, 0}, {0xE6, 0}, {0xE6, 0}, {0x2061, 0}, {0x1D51E, 0}, {0xE0, 0}, {0xE0, 0},
+	{0x2135, 0}, {0x2135, 0}, {0x3B1, 0}, {0x101, 0}, {0x2A3F, 0}, {0x26, 0}, {0x26, 0}, {0x2227, 0},
+	{0x2A55, 0}, {0x2A5C, 0}, {0x2A58, 0}, {0x2A5A, 0}, {0x2220, 0}, {0x29A4, 0}, {0x2220, 0},
+	{0x2221, 0}, {0x29A8, 0}, {0x29A9, 0}, {0x29AA, 0}, {0x29AB, 0}, {0x29AC, 0}, {0x29AD, 0},
+	{0x29AE, 0}, {0x29AF, 0}, {0x221F, 0}, {0x22BE, 0}, {0x299D, 0}, {0x2222, 0}, {0xC5, 0}, {0x237C, 0},
+	{0x105, 0}, {0x1D552, 0}, {0x2248, 0}, {0x2A70, 0}, {0x2A6F, 0}, {0x224A, 0}, {0x224B, 0}, {0x27, 0},
+	{0x2248, 0}, {0x224A, 0}, {0xE5, 0}, {0xE5, 0}, {0x1D4B6, 0}, {0x2A, 0}, {0x2248, 0}, {0x224D, 0},
+	{0xE3, 0}, {0xE3, 0}, {0xE4, 0}, {0xE4, 0}, {0x2233, 0}, {0x2A11, 0}, {0x2AED, 0}, {0x224C, 0},
+	{0x3F6, 0}, {0x2035, 0}, {0x223D, 0}, {0x22CD, 0}, {0x22BD, 0}, {0x2305, 0}, {0x2305, 0}, {0x23B5, 0},
+	{0x23B6, 0}, {0x224C, 0}, {0x431, 0}, {0x201E, 0}, {0x2235, 0}, {0x2235, 0}, {0x29B0, 0}, {0x3F6, 0},
+	{0x212C, 0}, {0x3B2, 0}, {0x2136, 0}, {0x226C, 0}, {0x1D51F, 0}, {0x22C2, 0}, {0x25EF, 0},
+	{0x22C3, 0}, {0x2A00, 0}, {0x2A01, 0}, {0x2A02, 0}, {0x2A06, 0}, {0x2605, 0}, {0x25BD, 0},
+	{0x25B3, 0}, {0x2A04, 0}, {0x22C1, 0}, {0x22C0, 0}, {0x290D, 0}, {0x29EB, 0}, {0x25AA, 0},
+	{0x25B4, 0}, {0x25BE, 0}, {0x25C2, 0}, {0x25B8, 0}, {0x2423, 0}, {0x2592, 0}, {0x2591, 0},
+	{0x2593, 0}, {0x2588, 0}, {0x3D, 0x20E5}, {0x2261, 0x20E5}, {0x2310, 0}, {0x1D553, 0}, {0x22A5, 0},
+	{0x22A5, 0}, {0x22C8, 0}, {0x2557, 0}, {0x2554, 0}, {0x2556, 0}, {0x2553, 0}, {0x2550, 0},
+	{0x2566, 0}, {0x2569, 0}, {0x2564, 0}, {0x2567, 0}, {0x255D, 0}, {0x255A, 0}, {0x255C, 0},
+	{0x2559, 0}, {0x2551, 0}, {0x256C, 0}, {0x2563, 0}, {0x2560, 0}, {0x256B, 0}, {0x2562, 0},
+	{0x255F, 0}, {0x29C9, 0}, {0x2555, 0}, {0x2552, 0}, {0x2510, 0}, {0x250C, 0}, {0x2500, 0},
+	{0x2565, 0}, {0x2568, 0}, {0x252C, 0}, {0x2534, 0}, {0x229F, 0}, {0x229E, 0}, {0x22A0, 0},
+	{0x255B, 0}, {0x2558, 0}, {0x2518, 0}, {0x2514, 0}, {0x2502, 0}, {0x256A, 0}, {0x2561, 0},
+	{0x255E, 0}, {0x253C, 0}, {0x2524, 0}, {0x251C, 0}, {0x2035, 0}, {0x2D8, 0}, {0xA6, 0}, {0xA6, 0},
+	{0x1D4B7, 0}, {0x204F, 0}, {0x223D, 0}, {0x22CD, 0}, {0x5C, 0}, {0x29C5, 0}, {0x27C8, 0}, {0x2022, 0},
+	{0x2022, 0}, {0x224E, 0}, {0x2AAE, 0}, {0x224F, 0}, {0x224F, 0}, {0x107, 0}, {0x2229, 0}, {0x2A44, 0},
+	{0x2A49, 0}, {0x2A4B, 0}, {0x2A47, 0}, {0x2A40, 0}, {0x2229, 0xFE00}, {0x2041, 0}, {0x2C7, 0},
+	{0x2A4D, 0}, {0x10D, 0}, {0xE7, 0}, {0xE7, 0}, {0x109, 0}, {0x2A4C, 0}, {0x2A50, 0}, {0x10B, 0},
+	{0xB8, 0}, {0xB8, 0}, {0x29B2, 0}, {0xA2, 0}, {0xA2, 0}, {0xB7, 0}, {0x1D520, 0}, {0x447, 0},
+	{0x2713, 0}, {0x2713, 0}, {0x3C7, 0}, {0x25CB, 0}, {0x29C3, 0}, {0x2C6, 0}, {0x2257, 0}, {0x21BA, 0},
+	{0x21BB, 0}, {0xAE, 0}, {0x24C8, 0}, {0x229B, 0}, {0x229A, 0}, {0x229D, 0}, {0x2257, 0}, {0x2A10, 0},
+	{0x2AEF, 0}, {0x29C2, 0}, {0x2663, 0}, {0x2663, 0}, {0x3A, 0}, {0x2254, 0}, {0x2254, 0}, {0x2C, 0},
+	{0x40, 0}, {0x2201, 0}, {0x2218, 0}, {0x2201, 0}, {0x2102, 0}, {0x2245, 0}, {0x2A6D, 0}, {0x222E, 0},
+	{0x1D554, 0}, {0x2210, 0}, {0xA9, 0}, {0xA9, 0}, {0x2117, 0}, {0x21B5, 0}, {0x2717, 0}, {0x1D4B8, 0},
+	{0x2ACF, 0}, {0x2AD1, 0}, {0x2AD0, 0}, {0x2AD2, 0}, {0x22EF, 0}, {0x2938, 0}, {0x2935, 0},
+	{0x22DE, 0}, {0x22DF, 0}, {0x21B6, 0}, {0x293D, 0}, {0x222A, 0}, {0x2A48, 0}, {0x2A46, 0},
+	{0x2A4A, 0}, {0x228D, 0}, {0x2A45, 0}, {0x222A, 0xFE00}, {0x21B7, 0}, {0x293C, 0}, {0x22DE, 0},
+	{0x22DF, 0}, {0x22CE, 0}, {0x22CF, 0}, {0xA4, 0}, {0xA4, 0}, {0x21B6, 0}, {0x21B7, 0}, {0x22CE, 0},
+	{0x22CF, 0}, {0x2232, 0}, {0x2231, 0}, {0x232D, 0}, {0x21D3, 0}, {0x2965, 0}, {0x2020, 0},
+	{0x2138, 0}, {0x2193, 0}, {0x2010, 0}, {0x22A3, 0}, {0x290F, 0}, {0x2DD, 0}, {0x10F, 0}, {0x434, 0},
+	{0x2146, 0}, {0x2021, 0}, {0x21CA, 0}, {0x2A77, 0}, {0xB0, 0}, {0xB0, 0}, {0x3B4, 0}, {0x29B1, 0},
+	{0x297F, 0}, {0x1D521, 0}, {0x21C3, 0}, {0x21C2, 0}, {0x22C4, 0}, {0x22C4, 0}, {0x2666, 0},
+	{0x2666, 0}, {0xA8, 0}, {0x3DD, 0}, {0x22F2, 0}, {0xF7, 0}, {0xF7, 0}, {0xF7, 0}, {0x22C7, 0},
+	{0x22C7, 0}, {0x452, 0}, {0x231E, 0}, {0x230D, 0}, {0x24, 0}, {0x1D555, 0}, {0x2D9, 0}, {0x2250, 0},
+	{0x2251, 0}, {0x2238, 0}, {0x2214, 0}, {0x22A1, 0}, {0x2306, 0}, {0x2193, 0}, {0x21CA, 0},
+	{0x21C3, 0}, {0x21C2, 0}, {0x2910, 0}, {0x231F, 0}, {0x230C, 0}, {0x1D4B9, 0}, {0x455, 0},
+	{0x29F6, 0}, {0x111, 0}, {0x22F1, 0}, {0x25BF, 0}, {0x25BE, 0}, {0x21F5, 0}, {0x296F, 0}, {0x29A6, 0},
+	{0x45F, 0}, {0x27FF, 0}, {0x2A77, 0}, {0x2251, 0}, {0xE9, 0}, {0xE9, 0}, {0x2A6E, 0}, {0x11B, 0},
+	{0x2256, 0}, {0xEA, 0}, {0xEA, 0}, {0x2255, 0}, {0x44D, 0}, {0x117, 0}, {0x2147, 0}, {0x2252, 0},
+	{0x1D522, 0}, {0x2A9A, 0}, {0xE8, 0}, {0xE8, 0}, {0x2A96, 0}, {0x2A98, 0}, {0x2A99, 0}, {0x23E7, 0},
+	{0x2113, 0}, {0x2A95, 0}, {0x2A97, 0}, {0x113, 0}, {0x2205, 0}, {0x2205, 0}, {0x2205, 0}, {0x2004, 0},
+	{0x2005, 0}, {0x2003, 0}, {0x14B, 0}, {0x2002, 0}, {0x119, 0}, {0x1D556, 0}, {0x22D5, 0}, {0x29E3, 0},
+	{0x2A71, 0}, {0x3B5, 0}, {0x3B5, 0}, {0x3F5, 0}, {0x2256, 0}, {0x2255, 0}, {0x2242, 0}, {0x2A96, 0},
+	{0x2A95, 0}, {0x3D, 0}, {0x225F, 0}, {0x2261, 0}, {0x2A78, 0}, {0x29E5, 0}, {0x2253, 0}, {0x2971, 0},
+	{0x212F, 0}, {0x2250, 0}, {0x2242, 0}, {0x3B7, 0}, {0xF0, 0}, {0xF0, 0}, {0xEB, 0}, {0xEB, 0},
+	{0x20AC, 0}, {0x21, 0}, {0x2203, 0}, {0x2130, 0}, {0x2147, 0}, {0x2252, 0}, {0x444, 0}, {0x2640, 0},
+	{0xFB03, 0}, {0xFB00, 0}, {0xFB04, 0}, {0x1D523, 0}, {0xFB01, 0}, {0x66, 0x6A}, {0x266D, 0},
+	{0xFB02, 0}, {0x25B1, 0}, {0x192, 0}, {0x1D557, 0}, {0x2200, 0}, {0x22D4, 0}, {0x2AD9, 0},
+	{0x2A0D, 0}, {0xBD, 0}, {0xBD, 0}, {0x2153, 0}, {0xBC, 0}, {0xBC, 0}, {0x2155, 0}, {0x2159, 0},
+	{0x215B, 0}, {0x2154, 0}, {0x2156, 0}, {0xBE, 0}, {0xBE, 0}, {0x2157, 0}, {0x215C, 0}, {0x2158, 0},
+	{0x215A, 0}, {0x215D, 0}, {0x215E, 0}, {0x2044, 0}, {0x2322, 0}, {0x1D4BB, 0}, {0x2267, 0},
+	{0x2A8C, 0}, {0x1F5, 0}, {0x3B3, 0}, {0x3DD, 0}, {0x2A86, 0}, {0x11F, 0}, {0x11D, 0}, {0x433, 0},
+	{0x121, 0}, {0x2265, 0}, {0x22DB, 0}, {0x2265, 0}, {0x2267, 0}, {0x2A7E, 0}, {0x2A7E, 0}, {0x2AA9, 0},
+	{0x2A80, 0}, {0x2A82, 0}, {0x2A84, 0}, {0x22DB, 0xFE00}, {0x2A94, 0}, {0x1D524, 0}, {0x226B, 0},
+	{0x22D9, 0}, {0x2137, 0}, {0x453, 0}, {0x2277, 0}, {0x2A92, 0}, {0x2AA5, 0}, {0x2AA4, 0}, {0x2269, 0},
+	{0x2A8A, 0}, {0x2A8A, 0}, {0x2A88, 0}, {0x2A88, 0}, {0x2269, 0}, {0x22E7, 0}, {0x1D558, 0}, {0x60, 0},
+	{0x210A, 0}, {0x2273, 0}, {0x2A8E, 0}, {0x2A90, 0}, {0x3E, 0}, {0x3E, 0}, {0x2AA7, 0}, {0x2A7A, 0},
+	{0x22D7, 0}, {0x2995, 0}, {0x2A7C, 0}, {0x2A86, 0}, {0x2978, 0}, {0x22D7, 0}, {0x22DB, 0},
+	{0x2A8C, 0}, {0x2277, 0}, {0x2273, 0}, {0x2269, 0xFE00}, {0x2269, 0xFE00}, {0x21D4, 0}, {0x200A, 0},
+	{0xBD, 0}, {0x210B, 0}, {0x44A, 0}, {0x2194, 0}, {0x2948, 0}, {0x21AD, 0}, {0x210F, 0}, {0x125, 0},
+	{0x2665, 0}, {0x2665, 0}, {0x2026, 0}, {0x22B9, 0}, {0x1D525, 0}, {0x2925, 0}, {0x2926, 0},
+	{0x21FF, 0}, {0x223B, 0}, {0x21A9, 0}, {0x21AA, 0}, {0x1D559, 0}, {0x2015, 0}, {0x1D4BD, 0},
+	{0x210F, 0}, {0x127, 0}, {0x2043, 0}, {0x2010, 0}, {0xED, 0}, {0xED, 0}, {0x2063, 0}, {0xEE, 0},
+	{0xEE, 0}, {0x438, 0}, {0x435, 0}, {0xA1, 0}, {0xA1, 0}, {0x21D4, 0}, {0x1D526, 0}, {0xEC, 0},
+	{0xEC, 0}, {0x2148, 0}, {0x2A0C, 0}, {0x222D, 0}, {0x29DC, 0}, {0x2129, 0}, {0x133, 0}, {0x12B, 0},
+	{0x2111, 0}, {0x2110, 0}, {0x2111, 0}, {0x131, 0}, {0x22B7, 0}, {0x1B5, 0}, {0x2208, 0}, {0x2105, 0},
+	{0x221E, 0}, {0x29DD, 0}, {0x131, 0}, {0x222B, 0}, {0x22BA, 0}, {0x2124, 0}, {0x22BA, 0}, {0x2A17, 0},
+	{0x2A3C, 0}, {0x451, 0}, {0x12F, 0}, {0x1D55A, 0}, {0x3B9, 0}, {0x2A3C, 0}, {0xBF, 0}, {0xBF, 0},
+	{0x1D4BE, 0}, {0x2208, 0}, {0x22F9, 0}, {0x22F5, 0}, {0x22F4, 0}, {0x22F3, 0}, {0x2208, 0},
+	{0x2062, 0}, {0x129, 0}, {0x456, 0}, {0xEF, 0}, {0xEF, 0}, {0x135, 0}, {0x439, 0}, {0x1D527, 0},
+	{0x237, 0}, {0x1D55B, 0}, {0x1D4BF, 0}, {0x458, 0}, {0x454, 0}, {0x3BA, 0}, {0x3F0, 0}, {0x137, 0},
+	{0x43A, 0}, {0x1D528, 0}, {0x138, 0}, {0x445, 0}, {0x45C, 0}, {0x1D55C, 0}, {0x1D4C0, 0}, {0x21DA, 0},
+	{0x21D0, 0}, {0x291B, 0}, {0x290E, 0}, {0x2266, 0}, {0x2A8B, 0}, {0x2962, 0}, {0x13A, 0}, {0x29B4, 0},
+	{0x2112, 0}, {0x3BB, 0}, {0x27E8, 0}, {0x2991, 0}, {0x27E8, 0}, {0x2A85, 0}, {0xAB, 0}, {0xAB, 0},
+	{0x2190, 0}, {0x21E4, 0}, {0x291F, 0}, {0x291D, 0}, {0x21A9, 0}, {0x21AB, 0}, {0x2939, 0},
+	{0x2973, 0}, {0x21A2, 0}, {0x2AAB, 0}, {0x2919, 0}, {0x2AAD, 0}, {0x2AAD, 0xFE00}, {0x290C, 0},
+	{0x2772, 0}, {0x7B, 0}, {0x5B, 0}, {0x298B, 0}, {0x298F, 0}, {0x298D, 0}, {0x13E, 0}, {0x13C, 0},
+	{0x2308, 0}, {0x7B, 0}, {0x43B, 0}, {0x2936, 0}, {0x201C, 0}, {0x201E, 0}, {0x2967, 0}, {0x294B, 0},
+	{0x21B2, 0}, {0x2264, 0}, {0x2190, 0}, {0x21A2, 0}, {0x21BD, 0}, {0x21BC, 0}, {0x21C7, 0},
+	{0x2194, 0}, {0x21C6, 0}, {0x21CB, 0}, {0x21AD, 0}, {0x22CB, 0}, {0x22DA, 0}, {0x2264, 0},
+	{0x2266, 0}, {0x2A7D, 0}, {0x2A7D, 0}, {0x2AA8, 0}, {0x2A7F, 0}, {0x2A81, 0}, {0x2A83, 0},
+	{0x22DA, 0xFE00}, {0x2A93, 0}, {0x2A85, 0}, {0x22D6, 0}, {0x22DA, 0}, {0x2A8B, 0}, {0x2276, 0},
+	{0x2272, 0}, {0x297C, 0}, {0x230A, 0}, {0x1D529, 0}, {0x2276, 0}, {0x2A91, 0}, {0x21BD, 0},
+	{0x21BC, 0}, {0x296A, 0}, {0x2584, 0}, {0x459, 0}, {0x226A, 0}, {0x21C7, 0}, {0x231E, 0}, {0x296B, 0},
+	{0x25FA, 0}, {0x140, 0}, {0x23B0, 0}, {0x23B0, 0}, {0x2268, 0}, {0x2A89, 0}, {0x2A89, 0}, {0x2A87, 0},
+	{0x2A87, 0}, {0x2268, 0}, {0x22E6, 0}, {0x27EC, 0}, {0x21FD, 0}, {0x27E6, 0}, {0x27F5, 0},
+	{0x27F7, 0}, {0x27FC, 0}, {0x27F6, 0}, {0x21AB, 0}, {0x21AC, 0}, {0x2985, 0}, {0x1D55D, 0},
+	{0x2A2D, 0}, {0x2A34, 0}, {0x2217, 0}, {0x5F, 0}, {0x25CA, 0}, {0x25CA, 0}, {0x29EB, 0}, {0x28, 0},
+	{0x2993, 0}, {0x21C6, 0}, {0x231F, 0}, {0x21CB, 0}, {0x296D, 0}, {0x200E, 0}, {0x22BF, 0},
+	{0x2039, 0}, {0x1D4C1, 0}, {0x21B0, 0}, {0x2272, 0}, {0x2A8D, 0}, {0x2A8F, 0}, {0x5B, 0}, {0x2018, 0},
+	{0x201A, 0}, {0x142, 0}, {0x3C, 0}, {0x3C, 0}, {0x2AA6, 0}, {0x2A79, 0}, {0x22D6, 0}, {0x22CB, 0},
+	{0x22C9, 0}, {0x2976, 0}, {0x2A7B, 0}, {0x2996, 0}, {0x25C3, 0}, {0x22B4, 0}, {0x25C2, 0},
+	{0x294A, 0}, {0x2966, 0}, {0x2268, 0xFE00}, {0x2268, 0xFE00}, {0x223A, 0}, {0xAF, 0}, {0xAF, 0},
+	{0x2642, 0}, {0x2720, 0}, {0x2720, 0}, {0x21A6, 0}, {0x21A6, 0}, {0x21A7, 0}, {0x21A4, 0},
+	{0x21A5, 0}, {0x25AE, 0}, {0x2A29, 0}, {0x43C, 0}, {0x2014, 0}, {0x2221, 0}, {0x1D52A, 0},
+	{0x2127, 0}, {0xB5, 0}, {0xB5, 0}, {0x2223, 0}, {0x2A, 0}, {0x2AF0, 0}, {0xB7, 0}, {0xB7, 0},
+	{0x2212, 0}, {0x229F, 0}, {0x2238, 0}, {0x2A2A, 0}, {0x2ADB, 0}, {0x2026, 0}, {0x2213, 0},
+	{0x22A7, 0}, {0x1D55E, 0}, {0x2213, 0}, {0x1D4C2, 0}, {0x223E, 0}, {0x3BC, 0}, {0x22B8, 0},
+	{0x22B8, 0}, {0x22D9, 0x338}, {0x226B, 0x20D2}, {0x226B, 0x338}, {0x21CD, 0}, {0x21CE, 0}, {0x22D8, 0x338},
+	{0x226A, 0x20D2}, {0x226A, 0x338}, {0x21CF, 0}, {0x22AF, 0}, {0x22AE, 0}, {0x2207, 0}, {0x144, 0},
+	{0x2220, 0x20D2}, {0x2249, 0}, {0x2A70, 0x338}, {0x224B, 0x338}, {0x149, 0}, {0x2249, 0}, {0x266E, 0},
+	{0x266E, 0}, {0x2115, 0}, {0xA0, 0}, {0xA0, 0}, {0x224E, 0x338}, {0x224F, 0x338}, {0x2A43, 0}, {0x148, 0},
+	{0x146, 0}, {0x2247, 0}, {0x2A6D, 0x338}, {0x2A42, 0}, {0x43D, 0}, {0x2013, 0}, {0x2260, 0},
+	{0x21D7, 0}, {0x2924, 0}, {0x2197, 0}, {0x2197, 0}, {0x2250, 0x338}, {0x2262, 0}, {0x2928, 0},
+	{0x2242, 0x338}, {0x2204, 0}, {0x2204, 0}, {0x1D52B, 0}, {0x2267, 0x338}, {0x2271, 0}, {0x2271, 0},
+	{0x2267, 0x338}, {0x2A7E, 0x338}, {0x2A7E, 0x338}, {0x2275, 0}, {0x226F, 0}, {0x226F, 0}, {0x21CE, 0},
+	{0x21AE, 0}, {0x2AF2, 0}, {0x220B, 0}, {0x22FC, 0}, {0x22FA, 0}, {0x220B, 0}, {0x45A, 0}, {0x21CD, 0},
+	{0x2266, 0x338}, {0x219A, 0}, {0x2025, 0}, {0x2270, 0}, {0x219A, 0}, {0x21AE, 0}, {0x2270, 0},
+	{0x2266, 0x338}, {0x2A7D, 0x338}, {0x2A7D, 0x338}, {0x226E, 0}, {0x2274, 0}, {0x226E, 0}, {0x22EA, 0},
+	{0x22EC, 0}, {0x2224, 0}, {0x1D55F, 0}, {0xAC, 0}, {0xAC, 0}, {0x2209, 0}, {0x22F9, 0x338},
+	{0x22F5, 0x338}, {0x2209, 0}, {0x22F7, 0}, {0x22F6, 0}, {0x220C, 0}, {0x220C, 0}, {0x22FE, 0},
+	{0x22FD, 0}, {0x2226, 0}, {0x2226, 0}, {0x2AFD, 0x20E5}, {0x2202, 0x338}, {0x2A14, 0}, {0x2280, 0},
+	{0x22E0, 0}, {0x2AAF, 0x338}, {0x2280, 0}, {0x2AAF, 0x338}, {0x21CF, 0}, {0x219B, 0}, {0x2933, 0x338},
+	{0x219D, 0x338}, {0x219B, 0}, {0x22EB, 0}, {0x22ED, 0}, {0x2281, 0}, {0x22E1, 0}, {0x2AB0, 0x338},
+	{0x1D4C3, 0}, {0x2224, 0}, {0x2226, 0}, {0x2241, 0}, {0x2244, 0}, {0x2244, 0}, {0x2224, 0},
+	{0x2226, 0}, {0x22E2, 0}, {0x22E3, 0}, {0x2284, 0}, {0x2AC5, 0x338}, {0x2288, 0}, {0x2282, 0x20D2},
+	{0x2288, 0}, {0x2AC5, 0x338}, {0x2281, 0}, {0x2AB0, 0x338}, {0x2285, 0}, {0x2AC6, 0x338}, {0x2289, 0},
+	{0x2283, 0x20D2}, {0x2289, 0}, {0x2AC6, 0x338}, {0x2279, 0}, {0xF1, 0}, {0xF1, 0}, {0x2278, 0},
+	{0x22EA, 0}, {0x22EC, 0}, {0x22EB, 0}, {0x22ED, 0}, {0x3BD, 0}, {0x23, 0}, {0x2116, 0}, {0x2007, 0},
+	{0x22AD, 0}, {0x2904, 0}, {0x224D, 0x20D2}, {0x22AC, 0}, {0x2265, 0x20D2}, {0x3E, 0x20D2}, {0x29DE, 0},
+	{0x2902, 0}, {0x2264, 0x20D2}, {0x3C, 0x20D2}, {0x22B4, 0x20D2}, {0x2903, 0}, {0x22B5, 0x20D2}, {0x223C, 0x20D2},
+	{0x21D6, 0}, {0x2923, 0}, {0x2196, 0}, {0x2196, 0}, {0x2927, 0}, {0x24C8, 0}, {0xF3, 0}, {0xF3, 0},
+	{0x229B, 0}, {0x229A, 0}, {0xF4, 0}, {0xF4, 0}, {0x43E, 0}, {0x229D, 0}, {0x151, 0}, {0x2A38, 0},
+	{0x2299, 0}, {0x29BC, 0}, {0x153, 0}, {0x29BF, 0}, {0x1D52C, 0}, {0x2DB, 0}, {0xF2, 0}, {0xF2, 0},
+	{0x29C1, 0}, {0x29B5, 0}, {0x3A9, 0}, {0x222E, 0}, {0x21BA, 0}, {0x29BE, 0}, {0x29BB, 0}, {0x203E, 0},
+	{0x29C0, 0}, {0x14D, 0}, {0x3C9, 0}, {0x3BF, 0}, {0x29B6, 0}, {0x2296, 0}, {0x1D560, 0}, {0x29B7, 0},
+	{0x29B9, 0}, {0x2295, 0}, {0x2228, 0}, {0x21BB, 0}, {0x2A5D, 0}, {0x2134, 0}, {0x2134, 0}, {0xAA, 0},
+	{0xAA, 0}, {0xBA, 0}, {0xBA, 0}, {0x22B6, 0}, {0x2A56, 0}, {0x2A57, 0}, {0x2A5B, 0}, {0x2134, 0},
+	{0xF8, 0}, {0xF8, 0}, {0x2298, 0}, {0xF5, 0}, {0xF5, 0}, {0x2297, 0}, {0x2A36, 0}, {0xF6, 0},
+	{0xF6, 0}, {0x233D, 0}, {0x2225, 0}, {0xB6, 0}, {0xB6, 0}, {0x2225, 0}, {0x2AF3, 0}, {0x2AFD, 0},
+	{0x2202, 0}, {0x43F, 0}, {0x25, 0}, {0x2E, 0}, {0x2030, 0}, {0x22A5, 0}, {0x2031, 0}, {0x1D52D, 0},
+	{0x3C6, 0}, {0x3D5, 0}, {0x2133, 0}, {0x260E, 0}, {0x3C0, 0}, {0x22D4, 0}, {0x3D6, 0}, {0x210F, 0},
+	{0x210E, 0}, {0x210F, 0}, {0x2B, 0}, {0x2A23, 0}, {0x229E, 0}, {0x2A22, 0}, {0x2214, 0}, {0x2A25, 0},
+	{0x2A72, 0}, {0xB1, 0}, {0xB1, 0}, {0x2A26, 0}, {0x2A27, 0}, {0xB1, 0}, {0x2A15, 0}, {0x1D561, 0},
+	{0xA3, 0}, {0xA3, 0}, {0x227A, 0}, {0x2AB3, 0}, {0x2AB7, 0}, {0x227C, 0}, {0x2AAF, 0}, {0x227A, 0},
+	{0x2AB7, 0}, {0x227C, 0}, {0x2AAF, 0}, {0x2AB9, 0}, {0x2AB5, 0}, {0x22E8, 0}, {0x227E, 0},
+	{0x2032, 0}, {0x2119, 0}, {0x2AB5, 0}, {0x2AB9, 0}, {0x22E8, 0}, {0x220F, 0}, {0x232E, 0},
+	{0x2312, 0}, {0x2313, 0}, {0x221D, 0}, {0x221D, 0}, {0x227E, 0}, {0x22B0, 0}, {0x1D4C5, 0},
+	{0x3C8, 0}, {0x2008, 0}, {0x1D52E, 0}, {0x2A0C, 0}, {0x1D562, 0}, {0x2057, 0}, {0x1D4C6, 0},
+	{0x210D, 0}, {0x2A16, 0}, {0x3F, 0}, {0x225F, 0}, {0x22, 0}, {0x22, 0}, {0x21DB, 0}, {0x21D2, 0},
+	{0x291C, 0}, {0x290F, 0}, {0x2964, 0}, {0x223D, 0x331}, {0x155, 0}, {0x221A, 0}, {0x29B3, 0},
+	{0x27E9, 0}, {0x2992, 0}, {0x29A5, 0}, {0x27E9, 0}, {0xBB, 0}, {0xBB, 0}, {0x2192, 0}, {0x2975, 0},
+	{0x21E5, 0}, {0x2920, 0}, {0x2933, 0}, {0x291E, 0}, {0x21AA, 0}, {0x21AC, 0}, {0x2945, 0},
+	{0x2974, 0}, {0x21A3, 0}, {0x219D, 0}, {0x291A, 0}, {0x2236, 0}, {0x211A, 0}, {0x290D, 0},
+	{0x2773, 0}, {0x7D, 0}, {0x5D, 0}, {0x298C, 0}, {0x298E, 0}, {0x2990, 0}, {0x159, 0}, {0x157, 0},
+	{0x2309, 0}, {0x7D, 0}, {0x440, 0}, {0x2937, 0}, {0x2969, 0}, {0x201D, 0}, {0x201D, 0}, {0x21B3, 0},
+	{0x211C, 0}, {0x211B, 0}, {0x211C, 0}, {0x211D, 0}, {0x25AD, 0}, {0xAE, 0}, {0xAE, 0}, {0x297D, 0},
+	{0x230B, 0}, {0x1D52F, 0}, {0x21C1, 0}, {0x21C0, 0}, {0x296C, 0}, {0x3C1, 0}, {0x3F1, 0}, {0x2192, 0},
+	{0x21A3, 0}, {0x21C1, 0}, {0x21C0, 0}, {0x21C4, 0}, {0x21CC, 0}, {0x21C9, 0}, {0x219D, 0},
+	{0x22CC, 0}, {0x2DA, 0}, {0x2253, 0}, {0x21C4, 0}, {0x21CC, 0}, {0x200F, 0}, {0x23B1, 0}, {0x23B1, 0},
+	{0x2AEE, 0}, {0x27ED, 0}, {0x21FE, 0}, {0x27E7, 0}, {0x2986, 0}, {0x1D563, 0}, {0x2A2E, 0},
+	{0x2A35, 0}, {0x29, 0}, {0x2994, 0}, {0x2A12, 0}, {0x21C9, 0}, {0x203A, 0}, {0x1D4C7, 0}, {0x21B1, 0},
+	{0x5D, 0}, {0x2019, 0}, {0x2019, 0}, {0x22CC, 0}, {0x22CA, 0}, {0x25B9, 0}, {0x22B5, 0}, {0x25B8, 0},
+	{0x29CE, 0}, {0x2968, 0}, {0x211E, 0}, {0x15B, 0}, {0x201A, 0}, {0x227B, 0}, {0x2AB4, 0}, {0x2AB8, 0},
+	{0x161, 0}, {0x227D, 0}, {0x2AB0, 0}, {0x15F, 0}, {0x15D, 0}, {0x2AB6, 0}, {0x2ABA, 0}, {0x22E9, 0},
+	{0x2A13, 0}, {0x227F, 0}, {0x441, 0}, {0x22C5, 0}, {0x22A1, 0}, {0x2A66, 0}, {0x21D8, 0}, {0x2925, 0},
+	{0x2198, 0}, {0x2198, 0}, {0xA7, 0}, {0xA7, 0}, {0x3B, 0}, {0x2929, 0}, {0x2216, 0}, {0x2216, 0},
+	{0x2736, 0}, {0x1D530, 0}, {0x2322, 0}, {0x266F, 0}, {0x449, 0}, {0x448, 0}, {0x2223, 0}, {0x2225, 0},
+	{0xAD, 0}, {0xAD, 0}, {0x3C3, 0}, {0x3C2, 0}, {0x3C2, 0}, {0x223C, 0}, {0x2A6A, 0}, {0x2243, 0},
+	{0x2243, 0}, {0x2A9E, 0}, {0x2AA0, 0}, {0x2A9D, 0}, {0x2A9F, 0}, {0x2246, 0}, {0x2A24, 0},
+	{0x2972, 0}, {0x2190, 0}, {0x2216, 0}, {0x2A33, 0}, {0x29E4, 0}, {0x2223, 0}, {0x2323, 0},
+	{0x2AAA, 0}, {0x2AAC, 0}, {0x2AAC, 0xFE00}, {0x44C, 0}, {0x2F, 0}, {0x29C4, 0}, {0x233F, 0},
+	{0x1D564, 0}, {0x2660, 0}, {0x2660, 0}, {0x2225, 0}, {0x2293, 0}, {0x2293, 0xFE00}, {0x2294, 0},
+	{0x2294, 0xFE00}, {0x228F, 0}, {0x2291, 0}, {0x228F, 0}, {0x2291, 0}, {0x2290, 0}, {0x2292, 0},
+	{0x2290, 0}, {0x2292, 0}, {0x25A1, 0}, {0x25A1, 0}, {0x25AA, 0}, {0x25AA, 0}, {0x2192, 0},
+	{0x1D4C8, 0}, {0x2216, 0}, {0x2323, 0}, {0x22C6, 0}, {0x2606, 0}, {0x2605, 0}, {0x3F5, 0}, {0x3D5, 0},
+	{0xAF, 0}, {0x2282, 0}, {0x2AC5, 0}, {0x2ABD, 0}, {0x2286, 0}, {0x2AC3, 0}, {0x2AC1, 0}, {0x2ACB, 0},
+	{0x228A, 0}, {0x2ABF, 0}, {0x2979, 0}, {0x2282, 0}, {0x2286, 0}, {0x2AC5, 0}, {0x228A, 0},
+	{0x2ACB, 0}, {0x2AC7, 0}, {0x2AD5, 0}, {0x2AD3, 0}, {0x227B, 0}, {0x2AB8, 0}, {0x227D, 0},
+	{0x2AB0, 0}, {0x2ABA, 0}, {0x2AB6, 0}, {0x22E9, 0}, {0x227F, 0}, {0x2211, 0}, {0x266A, 0}, {0xB9, 0},
+	{0xB9, 0}, {0xB2, 0}, {0xB2, 0}, {0xB3, 0}, {0xB3, 0}, {0x2283, 0}, {0x2AC6, 0}, {0x2ABE, 0},
+	{0x2AD8, 0}, {0x2287, 0}, {0x2AC4, 0}, {0x27C9, 0}, {0x2AD7, 0}, {0x297B, 0}, {0x2AC2, 0},
+	{0x2ACC, 0}, {0x228B, 0}, {0x2AC0, 0}, {0x2283, 0}, {0x2287, 0}, {0x2AC6, 0}, {0x228B, 0},
+	{0x2ACC, 0}, {0x2AC8, 0}, {0x2AD4, 0}, {0x2AD6, 0}, {0x21D9, 0}, {0x2926, 0}, {0x2199, 0},
+	{0x2199, 0}, {0x292A, 0}, {0xDF, 0}, {0xDF, 0}, {0x2316, 0}, {0x3C4, 0}, {0x23B4, 0}, {0x165, 0},
+	{0x163, 0}, {0x442, 0}, {0x20DB, 0}, {0x2315, 0}, {0x1D531, 0}, {0x2234, 0}, {0x2234, 0}, {0x3B8, 0},
+	{0x3D1, 0}, {0x3D1, 0}, {0x2248, 0}, {0x223C, 0}, {0x2009, 0}, {0x2248, 0}, {0x223C, 0}, {0xFE, 0},
+	{0xFE, 0}, {0x2DC, 0}, {0xD7, 0}, {0xD7, 0}, {0x22A0, 0}, {0x2A31, 0}, {0x2A30, 0}, {0x222D, 0},
+	{0x2928, 0}, {0x22A4, 0}, {0x2336, 0}, {0x2AF1, 0}, {0x1D565, 0}, {0x2ADA, 0}, {0x2929, 0},
+	{0x2034, 0}, {0x2122, 0}, {0x25B5, 0}, {0x25BF, 0}, {0x25C3, 0}, {0x22B4, 0}, {0x225C, 0},
+	{0x25B9, 0}, {0x22B5, 0}, {0x25EC, 0}, {0x225C, 0}, {0x2A3A, 0}, {0x2A39, 0}, {0x29CD, 0},
+	{0x2A3B, 0}, {0x23E2, 0}, {0x1D4C9, 0}, {0x446, 0}, {0x45B, 0}, {0x167, 0}, {0x226C, 0}, {0x219E, 0},
+	{0x21A0, 0}, {0x21D1, 0}, {0x2963, 0}, {0xFA, 0}, {0xFA, 0}, {0x2191, 0}, {0x45E, 0}, {0x16D, 0},
+	{0xFB, 0}, {0xFB, 0}, {0x443, 0}, {0x21C5, 0}, {0x171, 0}, {0x296E, 0}, {0x297E, 0}, {0x1D532, 0},
+	{0xF9, 0}, {0xF9, 0}, {0x21BF, 0}, {0x21BE, 0}, {0x2580, 0}, {0x231C, 0}, {0x231C, 0}, {0x230F, 0},
+	{0x25F8, 0}, {0x16B, 0}, {0xA8, 0}, {0xA8, 0}, {0x173, 0}, {0x1D566, 0}, {0x2191, 0}, {0x2195, 0},
+	{0x21BF, 0}, {0x21BE, 0}, {0x228E, 0}, {0x3C5, 0}, {0x3D2, 0}, {0x3C5, 0}, {0x21C8, 0}, {0x231D, 0},
+	{0x231D, 0}, {0x230E, 0}, {0x16F, 0}, {0x25F9, 0}, {0x1D4CA, 0}, {0x22F0, 0}, {0x169, 0}, {0x25B5, 0},
+	{0x25B4, 0}, {0x21C8, 0}, {0xFC, 0}, {0xFC, 0}, {0x29A7, 0}, {0x21D5, 0}, {0x2AE8, 0}, {0x2AE9, 0},
+	{0x22A8, 0}, {0x299C, 0}, {0x3F5, 0}, {0x3F0, 0}, {0x2205, 0}, {0x3D5, 0}, {0x3D6, 0}, {0x221D, 0},
+	{0x2195, 0}, {0x3F1, 0}, {0x3C2, 0}, {0x228A, 0xFE00}, {0x2ACB, 0xFE00}, {0x228B, 0xFE00}, {0x2ACC, 0xFE00},
+	{0x3D1, 0}, {0x22B2, 0}, {0x22B3, 0}, {0x432, 0}, {0x22A2, 0}, {0x2228, 0}, {0x22BB, 0}, {0x225A, 0},
+	{0x22EE, 0}, {0x7C, 0}, {0x7C, 0}, {0x1D533, 0}, {0x22B2, 0}, {0x2282, 0x20D2}, {0x2283, 0x20D2},
+	{0x1D567, 0}, {0x221D, 0}, {0x22B3, 0}, {0x1D4CB, 0}, {0x2ACB, 0xFE00}, {0x228A, 0xFE00}, {0x2ACC, 0xFE00},
+	{0x228B, 0xFE00}, {0x299A, 0}, {0x175, 0}, {0x2A5F, 0}, {0x2227, 0}, {0x2259, 0}, {0x2118, 0},
+	{0x1D534, 0}, {0x1D568, 0}, {0x2118, 0}, {0x2240, 0}, {0x2240, 0}, {0x1D4CC, 0}, {0x22C2, 0},
+	{0x25EF, 0}, {0x22C3, 0}, {0x25BD, 0}, {0x1D535, 0}, {0x27FA, 0}, {0x27F7, 0}, {0x3BE, 0},
+	{0x27F8, 0}, {0x27F5, 0}, {0x27FC, 0}, {0x22FB, 0}, {0x2A00, 0}, {0x1D569, 0}, {0x2A01, 0},
+	{0x2A02, 0}, {0x27F9, 0}, {0x27F6, 0}, {0x1D4CD, 0}, {0x2A06, 0}, {0x2A04, 0}, {0x25B3, 0},
+	{0x22C1, 0}, {0x22C0, 0}, {0xFD, 0}, {0xFD, 0}, {0x44F, 0}, {0x177, 0}, {0x44B, 0}, {0xA5, 0},
+	{0xA5, 0}, {0x1D536, 0}, {0x457, 0}, {0x1D56A, 0}, {0x1D4CE, 0}, {0x44E, 0}, {0xFF, 0}, {0xFF, 0},
+	{0x17A, 0}, {0x17E, 0}, {0x437, 0}, {0x17C, 0}, {0x2128, 0}, {0x3B6, 0}, {0x1D537, 0}, {0x436, 0},
+	{0x21DD, 0}, {0x1D56B, 0}, {0x1D4CF, 0}, {0x200D, 0}, {0x200C, 0}
+};
+
+///";"̂ȂÂ`̖O̍ő̒
+const std::size_t MAX_LEGACY_SIZE = 6;
+
+const std::uint32_t REPLACEMENT = 0xFFFD;
+
+const PerfectHash& table(){
+	static const PerfectHash hash(NAMES, COUNT);
+	return hash;
+}
+
+inline const bool isAlnum(const char p_c){
+	return ::isalnum(static_cast<unsigned char>(p_c)) != 0;
+}
+
+/**
+lQƁi"&#"̌jǂݍށB
+@param p_cur [in]"#"̎̈ʒu
+@param p_next [out]QƂ̎̈ʒu
+@return QƂłȂiȂjꍇfalse
+*/
+const bool readNumeric(const char* p_cur, const char* p_end, const char*& p_next, std::uint32_t& p_codePoint){
+	const bool hex = p_cur != p_end && (*p_cur == 'x' || *p_cur == 'X');
+	if(hex) ++p_cur;
+	const char* digits = p_cur;
+	std::uint32_t value = 0;
+	for(; p_cur != p_end; ++p_cur){
+		const char c = *p_cur;
+		std::uint32_t d;
+		if('0' <= c && c <= '9'){
+			d = static_cast<std::uint32_t>(c - '0');
+		} else if(hex && 'a' <= (c | 0x20) && (c | 0x20) <= 'f'){
+			d = static_cast<std::uint32_t>((c | 0x20) - 'a' + 10);
+		} else{
+			break;
+		}
+		//傫l͔͈͊OƂĈiӂꂳȂj
+		if(value <= 0x10FFFF) value = value * (hex ? 16 : 10) + d;
+	}
+	if(p_cur == digits) return false;
+	if(p_cur != p_end && *p_cur == ';') ++p_cur;
+	p_next = p_cur;
+	if(value == 0 || value > 0x10FFFF || (0xD800 <= value && value <= 0xDFFF)){
+		p_codePoint = REPLACEMENT;
+	} else if(0x80 <= value && value <= 0x9F){
+		//0x80`0x9FWindows-1252̕ɂ
+		p_codePoint = charset::fromWindows1252(static_cast<unsigned char>(value));
+	} else{
+		p_codePoint = value;
+	}
+	return true;
+}
+
+/**
+OtQƁi"&"̌jǂݍށB";"ŏIԒOAȂ";"̂ȂÂ`ňԒOTB
+@param p_cur [in]"&"̎̈ʒu
+@param p_next [out]QƂ̎̈ʒu
+@return QƂłȂꍇfalse
+*/
+const bool readNamed(const char* p_cur, const char* p_end, const bool p_inAttr, const char*& p_next, std::uint32_t p_codePoints[2]){
+	const char* nameEnd = p_cur;
+	while(nameEnd != p_end && static_cast<std::size_t>(nameEnd - p_cur) < MAX_NAME_SIZE && isAlnum(*nameEnd)) ++nameEnd;
+	const std::size_t size = static_cast<std::size_t>(nameEnd - p_cur);
+	if(size == 0) return false;
+	if(nameEnd != p_end && *nameEnd == ';' && findNamed(p_cur, size + 1, p_codePoints)){
+		p_next = nameEnd + 1;
+		return true;
+	}
+	for(std::size_t len = std::min(size, MAX_LEGACY_SIZE); len > 0; --len){
+		if(!findNamed(p_cur, len, p_codePoints)) continue;
+		p_next = p_cur + len;
+		//lł́Aɉp"="ꍇ͓WJȂ
+		if(p_inAttr && p_next != p_end && (isAlnum(*p_next) || *p_next == '=')) return false;
+		return true;
+	}
+	return false;
+}
+
+}//namespace{
+
+
+const bool contains(const char* p_begin, const char* p_end){
+	return scan::findChar(p_begin, p_end, '&') != p_end;
+}
+
+const bool findNamed(const char* p_name, const std::size_t p_size, std::uint32_t p_codePoints[2]){
+	const std::size_t index = table().find(p_name, p_size);
+	if(index == PerfectHash::NOT_FOUND) return false;
+	p_codePoints[0] = CODE_POINTS[index][0];
+	p_codePoints[1] = CODE_POINTS[index][1];
+	return true;
+}
+
+void appendUtf8(std::string& p_out, const std::uint32_t p_codePoint){
+	char buf[4];
+	p_out.append(buf, charset::putUtf8(buf, p_codePoint));
+}
+
+void decode(const char* p_begin, const char* p_end, std::string& p_out, const bool p_inAttr){
+	p_out.reserve(p_out.size() + static_cast<std::size_t>(p_end - p_begin));
+	const char* i = p_begin;
+	while(i != p_end){
+		const char* amp = scan::findChar(i, p_end, '&');
+		p_out.append(i, amp);
+		if(amp == p_end) break;
+		const char* next = amp + 1;
+		std::uint32_t codePoints[2] = {0, 0};
+		const bool found = (next != p_end && *next == '#')
+			? readNumeric(next + 1, p_end, next, codePoints[0])
+			: readNamed(next, p_end, p_inAttr, next, codePoints);
+		if(!found){
+			//QƂł͂Ȃ̂"&"̂܂܎c
+			p_out += '&';
+			i = amp + 1;
+			continue;
+		}
+		appendUtf8(p_out, codePoints[0]);
+		if(codePoints[1] != 0) appendUtf8(p_out, codePoints[1]);
+		i = next;
+	}
+}
+
+}//namespace entity
+}//namespace nana
@@ -0,0 +1,69 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_ENTITY_INCLUDED
+#define NANA_HTML_ENTITY_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace nana{
+
+/**
+QƁi"&amp;"A"&#38;"A"&#x26;"Ȃǁj̓WJBWJUTF-8ɂB
+OtQƂHTML5̈ꗗi2231jSnbV( PerfectHash )ŌB
+*/
+namespace entity{
+
+///OtQƂ̖Oi"&"A";"܂ށj̍ő̒
+const std::size_t MAX_NAME_SIZE = 32;
+
+///[p_begin, p_end)ɕQƂ̊Jni"&"j邩i scan::findChar() ŒTj
+const bool contains(const char* p_begin, const char* p_end);
+
+/**
+OtQƂB
+@param p_name [in]"&"Oi"amp;"ȂǁB";"̂ȂÂ`́AHTML5ŔF߂Ă̂j
+@param p_codePoints [out]̃R[h|Cgi1̏ꍇA2ڂ0j
+@return ꍇtrue
+*/
+const bool findNamed(const char* p_name, const std::size_t p_size, std::uint32_t p_codePoints[2]);
+
+///R[h|CgUTF-8ɂp_ouťɒǉi charset::putUtf8() j
+void appendUtf8(std::string& p_out, const std::uint32_t p_codePoint);
+
+/**
+[p_begin, p_end)̕QƂWJāAp_ouťɒǉBHTML5̎dlƓȉ̂悤ɈB
+E";"̂ȂÂ`̖OtQƂWJi"&notit;""&not"WJ"it;"cjB
+ElQƂ0ATQ[gAU+10FFFF𒴂lU+FFFDA0x80`0x9FWindows-1252̕ɂB
+EQƂƂĉ߂łȂ"&"͂̂܂܎cB
+@param p_inAttr [in]l̏ꍇtrueB";"̂ȂOtQƂ̒ɉp"="ꍇ͓WJȂiURL"&copy=1"ȂǁjB
+*/
+void decode(const char* p_begin, const char* p_end, std::string& p_out, const bool p_inAttr);
+
+///QƂWJ
+inline std::string decode(const std::string& p_str, const bool p_inAttr){
+	std::string ret;
+	decode(p_str.data(), p_str.data() + p_str.size(), ret, p_inAttr);
+	return ret;
+}
+
+}//namespace entity
+}//namespace nana
+
+
+#endif  // #ifndef NANA_HTML_ENTITY_INCLUDED
@@ -0,0 +1,151 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "html_file.hpp"
+
+
+namespace nana{
+
+namespace{
+
+///TCY0̃t@C data()
+const char EMPTY_DATA[1] = {'\0'};
+
+void throwError(const std::string& p_what, const std::string& p_name, const int p_errno){
+	throw std::runtime_error("MappedFile: " + p_what + " " + p_name + ": " + std::strerror(p_errno));
+}
+
+#ifdef _WIN32
+const int openReadOnly(const std::string& p_path){ return _open(p_path.c_str(), _O_RDONLY | _O_BINARY); }
+void closeFd(const int p_fd){ _close(p_fd); }
+#else
+const int openReadOnly(const std::string& p_path){ return ::open(p_path.c_str(), O_RDONLY); }
+void closeFd(const int p_fd){ ::close(p_fd); }
+#endif
+
+}//namespace{
+
+
+MappedFile::MappedFile(const std::string& p_path, const Advice p_advice)
+	: m_data(EMPTY_DATA), m_size(0), m_mapping(nullptr)
+#ifdef _WIN32
+	, m_mappingHandle(nullptr)
+#endif
+{
+	const int fd = openReadOnly(p_path);
+	if(fd < 0) throwError("cannot open", p_path, errno);
+	try{
+		map(fd, p_path, p_advice);
+	} catch(...){
+		closeFd(fd);
+		throw;
+	}
+	//}bsO̓t@CĂL
+	closeFd(fd);
+}
+
+MappedFile::MappedFile(const int p_fd, const Advice p_advice)
+	: m_data(EMPTY_DATA), m_size(0), m_mapping(nullptr)
+#ifdef _WIN32
+	, m_mappingHandle(nullptr)
+#endif
+{
+	map(p_fd, "fd " + std::to_string(p_fd), p_advice);
+}
+
+#ifdef _WIN32
+
+void MappedFile::map(const int p_fd, const std::string& p_name, const Advice p_advice){
+	struct _stat64 st;
+	if(_fstat64(p_fd, &st) != 0) throwError("cannot stat", p_name, errno);
+	m_size = static_cast<std::size_t>(st.st_size);
+	if(m_size == 0) return;
+	HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(p_fd));
+	m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(m_mappingHandle == nullptr) throw std::runtime_error("MappedFile: cannot map " + p_name);
+	m_mapping = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if(m_mapping == nullptr){
+		CloseHandle(m_mappingHandle);
+		throw std::runtime_error("MappedFile: cannot map " + p_name);
+	}
+	m_data = static_cast<const char*>(m_mapping);
+	advise(p_advice);
+}
+
+MappedFile::~MappedFile(){
+	if(m_mapping == nullptr) return;
+	UnmapViewOfFile(m_mapping);
+	CloseHandle(m_mappingHandle);
+}
+
+void MappedFile::advise(const Advice p_advice)const{
+	if(m_mapping == nullptr || (p_advice != SEQUENTIAL && p_advice != WILLNEED)) return;
+#if _WIN32_WINNT >= 0x0602
+	WIN32_MEMORY_RANGE_ENTRY range;
+	range.VirtualAddress = m_mapping;
+	range.NumberOfBytes = m_size;
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+}
+
+#else
+
+void MappedFile::map(const int p_fd, const std::string& p_name, const Advice p_advice){
+	struct stat st;
+	if(fstat(p_fd, &st) != 0) throwError("cannot stat", p_name, errno);
+	m_size = static_cast<std::size_t>(st.st_size);
+	if(m_size == 0) return;
+	void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, p_fd, 0);
+	if(mapping == MAP_FAILED) throwError("cannot map", p_name, errno);
+	m_mapping = mapping;
+	m_data = static_cast<const char*>(m_mapping);
+	advise(p_advice);
+}
+
+MappedFile::~MappedFile(){
+	if(m_mapping != nullptr) munmap(m_mapping, m_size);
+}
+
+void MappedFile::advise(const Advice p_advice)const{
+	if(m_mapping == nullptr) return;
+	int advice = MADV_NORMAL;
+	switch(p_advice){
+	case SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+	case RANDOM: advice = MADV_RANDOM; break;
+	case WILLNEED: advice = MADV_WILLNEED; break;
+	default: break;
+	}
+	//qgȂ̂ŎsĂ
+	madvise(m_mapping, m_size, advice);
+}
+
+#endif
+
+
+} //namespace nana
@@ -0,0 +1,75 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_FILE_INCLUDED
+#define NANA_HTML_FILE_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+
+namespace nana{
+
+/**
+@brief ǂݍݐpŃ}bvt@CBjɃ}bsOB
+ HtmlSaxParser::parse(const char*, const std::size_t, HtmlSaxParserViewHandler&) Ńp[X΁A
+ HtmlPart ̓}bsO𒼐ڎQƂi HtmlDocument::holdSource() Ń}bsO̎ HtmlDocument ɍ킹jB
+*/
+class MappedFile{
+public:
+	/**
+	y[W̓ǂݍݕ̃qgiPOSIXmadvise()BWindowsł SEQUENTIAL A WILLNEED ̂ݐǂ݂ƂĎgpjB
+	NORMAL FwȂB
+	SEQUENTIAL F擪珇Ԃɓǂށiǂ𑽂݂Aǂ񂾃y[W͑߂ɉjBp[X͂B
+	RANDOM F_ɓǂށiǂ݂ȂjB
+	WILLNEED FɑŜǂށi}bvɑŜ̓ǂݍ݂JnjB
+	*/
+	enum Advice { NORMAL, SEQUENTIAL, RANDOM, WILLNEED };
+	/**
+	t@C}bvB
+	@param p_path [in]t@C̃pX
+	@param p_advice [in]y[W̓ǂݍݕ̃qg
+	@throw std::runtime_error t@CJȂA}bvłȂꍇ
+	*/
+	explicit MappedFile(const std::string& p_path, const Advice p_advice = SEQUENTIAL);
+	/**
+	JĂt@CfBXNv^iǂݍ݉\Ȃ́j̓e}bvBp_fd͕Ȃi}bvɕĂ悢jB
+	@throw std::runtime_error }bvłȂꍇ
+	*/
+	explicit MappedFile(const int p_fd, const Advice p_advice = SEQUENTIAL);
+	~MappedFile();
+	///t@C̓e̐擪iTCY0̏ꍇLȃ|C^Ԃj
+	const char* data()const{ return m_data; };
+	///t@C̃oCg
+	const std::size_t size()const{ return m_size; };
+	///y[W̓ǂݍݕ̃qgύX
+	void advise(const Advice p_advice)const;
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+	void map(const int p_fd, const std::string& p_name, const Advice p_advice);
+	const char* m_data;
+	std::size_t m_size;
+	void* m_mapping;//}bv̈iTCY0̏ꍇnullptrj
+#ifdef _WIN32
+	void* m_mappingHandle;
+#endif
+};
+
+
+} //namespace nana
+
+
+#endif  // #ifndef NANA_HTML_FILE_INCLUDED
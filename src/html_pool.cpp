@@ -0,0 +1,136 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <algorithm>
+
+#include "html_pool.hpp"
+
+
+namespace nana{
+
+//WorkStealingPool-----------------------------------------------
+
+WorkStealingPool::WorkStealingPool(const std::size_t p_threadCount)
+	: m_task(nullptr), m_generation(0), m_running(0), m_stop(false){
+	std::size_t count = p_threadCount;
+	if(count == 0) count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	for(std::size_t i = 0; i < count; ++i) m_queues.push_back(unique_ptr<Queue>(new Queue));
+	//0Ԃ͌ĂяõXbh
+	for(std::size_t i = 1; i < count; ++i) m_threads.push_back(std::thread(&WorkStealingPool::workerLoop, this, i));
+}
+
+WorkStealingPool::~WorkStealingPool(){
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_startCv.notify_all();
+	for(auto i = m_threads.begin(); i != m_threads.end(); ++i) i->join();
+}
+
+void WorkStealingPool::run(const std::size_t p_count, const Task& p_task){
+	if(p_count == 0) return;
+	//Y͈̔͂ϓɕ
+	const std::size_t n = m_queues.size();
+	for(std::size_t i = 0; i < n; ++i){
+		std::lock_guard<std::mutex> lock(m_queues[i]->mutex);
+		m_queues[i]->begin = p_count * i / n;
+		m_queues[i]->end = p_count * (i + 1) / n;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &p_task;
+		m_error = nullptr;
+		m_running = m_threads.size();
+		++m_generation;
+	}
+	m_startCv.notify_all();
+	work(0);
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_doneCv.wait(lock, [this]{ return m_running == 0; });
+		m_task = nullptr;
+		error = m_error;
+	}
+	if(error) std::rethrow_exception(error);
+}
+
+//ƃXbhBrun()Ă΂邽т work() sB
+void WorkStealingPool::workerLoop(const std::size_t p_worker){
+	std::size_t generation = 0;
+	for(;;){
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_startCv.wait(lock, [&]{ return m_stop || m_generation != generation; });
+			if(m_stop) return;
+			generation = m_generation;
+		}
+		work(p_worker);
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			--m_running;
+			if(m_running == 0) m_doneCv.notify_one();
+		}
+	}
+}
+
+//͈̔͂sAȂȂΑ̃XbhĎs
+void WorkStealingPool::work(const std::size_t p_worker){
+	std::size_t index;
+	while(pop(p_worker, index) || steal(p_worker, index)){
+		try{
+			(*m_task)(index, p_worker);
+		} catch(...){
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if(!m_error) m_error = std::current_exception();
+		}
+	}
+}
+
+const bool WorkStealingPool::pop(const std::size_t p_worker, std::size_t& p_index){
+	Queue& q = *m_queues[p_worker];
+	std::lock_guard<std::mutex> lock(q.mutex);
+	if(q.begin == q.end) return false;
+	p_index = q.begin++;
+	return true;
+}
+
+//̃Xbh͈̔͂̌딼BSẴXbh͈̔͂ȂfalseB
+const bool WorkStealingPool::steal(const std::size_t p_worker, std::size_t& p_index){
+	const std::size_t n = m_queues.size();
+	for(std::size_t k = 1; k < n; ++k){
+		Queue& victim = *m_queues[(p_worker + k) % n];
+		std::size_t begin, end;
+		{
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if(victim.begin == victim.end) continue;
+			end = victim.end;
+			begin = victim.begin + (victim.end - victim.begin) / 2;
+			victim.end = begin;
+		}
+		//͈͂̐擪sAc͈̔͂ɂ
+		Queue& own = *m_queues[p_worker];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		own.begin = begin + 1;
+		own.end = end;
+		p_index = begin;
+		return true;
+	}
+	return false;
+}
+
+
+} //namespace nana
@@ -0,0 +1,82 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_POOL_INCLUDED
+#define NANA_HTML_POOL_INCLUDED
+
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <exception>
+
+
+#include "html_element.hpp"
+
+
+namespace nana{
+
+/**
+@brief ^XN𕡐XbhŎs郏[NXeB[ÕXbhv[B
+ run() ̓^XN̓Y͈̔͂XbhƂɕēnA͈̔͂g؂Xbh͑̃Xbh̎c̔B
+ run() ĂяoXbhƃXbh1iԍ0jƂĎsB
+*/
+class WorkStealingPool : noncopyable{
+public:
+	/**
+	@param p_index [in]^XN̓Yi0run()p_countj
+	@param p_worker [in]sĂXbh̔ԍi0 threadCount() jBXbhƂ̏ԂꍇɎgB
+	*/
+	typedef std::function<void(const std::size_t p_index, const std::size_t p_worker)> Task;
+	///@param p_threadCount [in]XbhiĂяõXbh܂ށjB0̏ꍇCPŨRAB
+	explicit WorkStealingPool(const std::size_t p_threadCount = 0);
+	~WorkStealingPool();
+	///XbhiĂяõXbh܂ށj
+	const std::size_t threadCount()const{ return m_queues.size(); };
+	/**
+	p_taskY0p_count-1܂1񂸂sASďI܂ő҂BXbh瓯ɌĂяoĂ͂ȂB
+	^XNO𓊂ꍇł̃^XN͎sAŏ̗O𓊂B
+	*/
+	void run(const std::size_t p_count, const Task& p_task);
+private:
+	///XbhƂ́AsĂȂ^XN̓Y͈̔[begin, end)
+	struct Queue{
+		Queue(): begin(0), end(0){};
+		std::mutex mutex;
+		std::size_t begin, end;
+	};
+	void workerLoop(const std::size_t p_worker);
+	void work(const std::size_t p_worker);
+	const bool pop(const std::size_t p_worker, std::size_t& p_index);
+	const bool steal(const std::size_t p_worker, std::size_t& p_index);
+	vector<unique_ptr<Queue>> m_queues;
+	vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_startCv, m_doneCv;
+	const Task* m_task;
+	std::size_t m_generation;//run()̌Ăяo񐔁iƃXbh̊Jn̍}j
+	std::size_t m_running;//s̍ƃXbhiĂяoj
+	bool m_stop;
+	std::exception_ptr m_error;
+};
+
+
+} //namespace nana
+
+
+#endif  // #ifndef NANA_HTML_POOL_INCLUDED
@@ -0,0 +1,324 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+
+#include "html_scan.hpp"
+
+//x86̏ꍇ̂SIMDgp
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NANA_SCAN_X86
+#define NANA_SCAN_TARGET_SSE2 __attribute__((target("sse2")))
+#define NANA_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define NANA_SCAN_X86
+#define NANA_SCAN_TARGET_SSE2
+#define NANA_SCAN_TARGET_AVX2
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+
+namespace nana{
+namespace scan{
+
+using std::uint64_t;
+using std::uint32_t;
+
+
+ByteSet::ByteSet(const char* p_chars): m_size(0){
+	memset(m_chars, 0, sizeof(m_chars));
+	memset(m_table, 0, sizeof(m_table));
+	for(; *p_chars != '\0' && m_size < MAX_SIZE; ++p_chars){
+		m_chars[m_size++] = *p_chars;
+		m_table[static_cast<unsigned char>(*p_chars)] = true;
+	}
+};
+
+
+namespace{
+
+///ԉ̗Ărbg̈ʒui0͓nȂƁj
+inline int lowestBit(uint64_t p_bits){
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(p_bits);
+#else
+	int n = 0;
+	while((p_bits & 1) == 0){ p_bits >>= 1; ++n; }
+	return n;
+#endif
+}
+
+///Ărbg̐
+inline int bitCount(uint64_t p_bits){
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(p_bits);
+#else
+	p_bits = p_bits - ((p_bits >> 1) & 0x5555555555555555ULL);
+	p_bits = (p_bits & 0x3333333333333333ULL) + ((p_bits >> 2) & 0x3333333333333333ULL);
+	p_bits = (p_bits + (p_bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return static_cast<int>((p_bits * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+
+//XJ[----------------------------------
+const char* scalarFindFirstOf(const char* p_begin, const char* p_end, const ByteSet& p_set){
+	for(; p_begin != p_end; ++p_begin){
+		if(p_set.contains(*p_begin)) return p_begin;
+	}
+	return p_end;
+}
+
+const char* scalarFindChar(const char* p_begin, const char* p_end, const char p_c){
+	const void* p = memchr(p_begin, p_c, p_end - p_begin);
+	return p == nullptr ? p_end : static_cast<const char*>(p);
+}
+
+std::size_t scalarCountChar(const char* p_begin, const char* p_end, const char p_c){
+	std::size_t n = 0;
+	for(; p_begin != p_end; ++p_begin){
+		if(*p_begin == p_c) ++n;
+	}
+	return n;
+}
+
+const char* scalarFindNonAscii(const char* p_begin, const char* p_end){
+	//8oCgŏʃrbg𒲂ׂ
+	for(; p_end - p_begin >= 8; p_begin += 8){
+		uint64_t v;
+		memcpy(&v, p_begin, 8);
+		if((v & 0x8080808080808080ULL) != 0) break;
+	}
+	for(; p_begin != p_end; ++p_begin){
+		if(static_cast<unsigned char>(*p_begin) >= 0x80) return p_begin;
+	}
+	return p_end;
+}
+
+
+#ifdef NANA_SCAN_X86
+//SSE2i16oCgPʁj----------------------------------
+NANA_SCAN_TARGET_SSE2
+inline uint32_t sse2Mask16(const char* p_data, const __m128i* p_needles, const int p_size){
+	const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_data));
+	__m128i m = _mm_cmpeq_epi8(v, p_needles[0]);
+	for(int k = 1; k < p_size; ++k) m = _mm_or_si128(m, _mm_cmpeq_epi8(v, p_needles[k]));
+	return static_cast<uint32_t>(_mm_movemask_epi8(m));
+}
+
+NANA_SCAN_TARGET_SSE2
+const char* sse2FindFirstOf(const char* p_begin, const char* p_end, const ByteSet& p_set){
+	if(p_set.size() == 0) return p_end;
+	if(p_end - p_begin < 16) return scalarFindFirstOf(p_begin, p_end, p_set);
+	__m128i needles[ByteSet::MAX_SIZE];
+	for(int k = 0; k < ByteSet::MAX_SIZE; ++k) needles[k] = _mm_set1_epi8(p_set.at(k));
+	for(; p_end - p_begin >= 16; p_begin += 16){
+		const uint32_t bits = sse2Mask16(p_begin, needles, p_set.size());
+		if(bits != 0) return p_begin + lowestBit(bits);
+	}
+	return scalarFindFirstOf(p_begin, p_end, p_set);
+}
+
+NANA_SCAN_TARGET_SSE2
+const char* sse2FindChar(const char* p_begin, const char* p_end, const char p_c){
+	const __m128i needle = _mm_set1_epi8(p_c);
+	for(; p_end - p_begin >= 16; p_begin += 16){
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_begin));
+		const uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+		if(bits != 0) return p_begin + lowestBit(bits);
+	}
+	return scalarFindChar(p_begin, p_end, p_c);
+}
+
+NANA_SCAN_TARGET_SSE2
+std::size_t sse2CountChar(const char* p_begin, const char* p_end, const char p_c){
+	const __m128i needle = _mm_set1_epi8(p_c);
+	std::size_t n = 0;
+	for(; p_end - p_begin >= 64; p_begin += 64){
+		uint64_t bits = 0;
+		for(int k = 0; k < 4; ++k){
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_begin + k * 16));
+			bits |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)))) << (k * 16);
+		}
+		n += bitCount(bits);
+	}
+	return n + scalarCountChar(p_begin, p_end, p_c);
+}
+
+NANA_SCAN_TARGET_SSE2
+const char* sse2FindNonAscii(const char* p_begin, const char* p_end){
+	//ŏʃrbĝ܂܃rbg}XNɂ
+	for(; p_end - p_begin >= 16; p_begin += 16){
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_begin));
+		const uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(v));
+		if(bits != 0) return p_begin + lowestBit(bits);
+	}
+	return scalarFindNonAscii(p_begin, p_end);
+}
+
+
+//AVX2i32oCgPʁj----------------------------------
+NANA_SCAN_TARGET_AVX2
+inline uint32_t avx2Mask32(const char* p_data, const __m256i* p_needles, const int p_size){
+	const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data));
+	__m256i m = _mm256_cmpeq_epi8(v, p_needles[0]);
+	for(int k = 1; k < p_size; ++k) m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, p_needles[k]));
+	return static_cast<uint32_t>(_mm256_movemask_epi8(m));
+}
+
+NANA_SCAN_TARGET_AVX2
+const char* avx2FindFirstOf(const char* p_begin, const char* p_end, const ByteSet& p_set){
+	if(p_set.size() == 0) return p_end;
+	if(p_end - p_begin < 32) return sse2FindFirstOf(p_begin, p_end, p_set);
+	__m256i needles[ByteSet::MAX_SIZE];
+	for(int k = 0; k < ByteSet::MAX_SIZE; ++k) needles[k] = _mm256_set1_epi8(p_set.at(k));
+	for(; p_end - p_begin >= 32; p_begin += 32){
+		const uint32_t bits = avx2Mask32(p_begin, needles, p_set.size());
+		if(bits != 0) return p_begin + lowestBit(bits);
+	}
+	return sse2FindFirstOf(p_begin, p_end, p_set);
+}
+
+NANA_SCAN_TARGET_AVX2
+const char* avx2FindChar(const char* p_begin, const char* p_end, const char p_c){
+	const __m256i needle = _mm256_set1_epi8(p_c);
+	for(; p_end - p_begin >= 32; p_begin += 32){
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_begin));
+		const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+		if(bits != 0) return p_begin + lowestBit(bits);
+	}
+	return sse2FindChar(p_begin, p_end, p_c);
+}
+
+NANA_SCAN_TARGET_AVX2
+std::size_t avx2CountChar(const char* p_begin, const char* p_end, const char p_c){
+	const __m256i needle = _mm256_set1_epi8(p_c);
+	std::size_t n = 0;
+	for(; p_end - p_begin >= 64; p_begin += 64){
+		const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_begin));
+		const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_begin + 32));
+		const uint64_t bits = uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v0, needle))))
+			| (uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, needle)))) << 32);
+		n += bitCount(bits);
+	}
+	return n + scalarCountChar(p_begin, p_end, p_c);
+}
+
+NANA_SCAN_TARGET_AVX2
+const char* avx2FindNonAscii(const char* p_begin, const char* p_end){
+	for(; p_end - p_begin >= 64; p_begin += 64){
+		const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_begin));
+		const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_begin + 32));
+		//ASCIȈꍇ2܂Ƃ߂Ēׂ
+		if(_mm256_movemask_epi8(_mm256_or_si256(v0, v1)) == 0) continue;
+		const uint64_t bits = uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(v0)))
+			| (uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(v1))) << 32);
+		return p_begin + lowestBit(bits);
+	}
+	return sse2FindNonAscii(p_begin, p_end);
+}
+#endif //NANA_SCAN_X86
+
+
+///߃ZbgƂ̊֐
+struct Kernel{
+	const char* (*findFirstOf)(const char*, const char*, const ByteSet&);
+	const char* (*findChar)(const char*, const char*, const char);
+	std::size_t (*countChar)(const char*, const char*, const char);
+	const char* (*findNonAscii)(const char*, const char*);
+};
+
+const Kernel g_kernels[] = {
+	{scalarFindFirstOf, scalarFindChar, scalarCountChar, scalarFindNonAscii},
+#ifdef NANA_SCAN_X86
+	{sse2FindFirstOf, sse2FindChar, sse2CountChar, sse2FindNonAscii},
+	{avx2FindFirstOf, avx2FindChar, avx2CountChar, avx2FindNonAscii}
+#else
+	{scalarFindFirstOf, scalarFindChar, scalarCountChar, scalarFindNonAscii},
+	{scalarFindFirstOf, scalarFindChar, scalarCountChar, scalarFindNonAscii}
+#endif
+};
+
+///CPUgpłԑ߃Zbg
+Level detectLevel(){
+#if defined(NANA_SCAN_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) return AVX2;
+	if(__builtin_cpu_supports("sse2")) return SSE2;
+#elif defined(NANA_SCAN_X86)
+	int info[4];
+	__cpuid(info, 0);
+	if(info[0] >= 7){
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		__cpuidex(info, 7, 0);
+		if(osxsave && (info[1] & (1 << 5)) != 0 && (_xgetbv(0) & 6) == 6) return AVX2;
+	}
+	return SSE2;
+#endif
+	return SCALAR;
+}
+
+std::atomic<int>& currentLevel(){
+	static std::atomic<int> level(detectLevel());
+	return level;
+}
+
+inline const Kernel& kernel(){
+	return g_kernels[currentLevel().load(std::memory_order_relaxed)];
+}
+
+}//namespace{
+
+
+const bool isSupported(const Level p_level){
+	static const Level detected = detectLevel();
+	return p_level <= detected;
+};
+
+const Level level(){
+	return static_cast<Level>(currentLevel().load());
+};
+
+const bool setLevel(const Level p_level){
+	if(!isSupported(p_level)) return false;
+	currentLevel().store(p_level);
+	return true;
+};
+
+const char* findFirstOf(const char* p_begin, const char* p_end, const ByteSet& p_set){
+	return kernel().findFirstOf(p_begin, p_end, p_set);
+};
+
+const char* findChar(const char* p_begin, const char* p_end, const char p_c){
+	return kernel().findChar(p_begin, p_end, p_c);
+};
+
+std::size_t countChar(const char* p_begin, const char* p_end, const char p_c){
+	return kernel().countChar(p_begin, p_end, p_c);
+};
+
+const char* findNonAscii(const char* p_begin, const char* p_end){
+	return kernel().findNonAscii(p_begin, p_end);
+};
+
+
+}//namespace scan
+}//namespace nana
@@ -0,0 +1,80 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef NANA_HTML_SCAN_INCLUDED
+#define NANA_HTML_SCAN_INCLUDED
+
+#include <cstddef>
+
+
+namespace nana{
+
+/**
+HTML̍\i"<"A">"AsANH[gȂǁjT߂̑֐QB
+16/32oCgPʂŕ𕪗ނărbg}XNɂB
+SSE2AAVX2gpłꍇ͎sɂIAgpłȂꍇ̓XJ[B
+*/
+namespace scan{
+
+///Ɏgp閽߃Zbg
+enum Level { SCALAR, SSE2, AVX2 };
+
+/**
+@brief T̏Wiő8jB
+*/
+class ByteSet{
+public:
+	static const int MAX_SIZE = 8;
+	/**
+	@param p_chars [in]Ti'\0'I[BMAX_SIZE𒴂͖j
+	*/
+	explicit ByteSet(const char* p_chars);
+	///܂܂邩
+	const bool contains(const char p_c)const{ return m_table[static_cast<unsigned char>(p_c)]; };
+	///
+	const int size()const{ return m_size; };
+	///p_indexԖڂ̕
+	const char at(const int p_index)const{ return m_chars[p_index]; };
+private:
+	char m_chars[MAX_SIZE];
+	int m_size;
+	bool m_table[256];
+};
+
+///CPU̖߃Zbggpł邩
+const bool isSupported(const Level p_level);
+///ݎgpĂ閽߃Zbgil͎gpł钆ňԑ́j
+const Level level();
+///gp閽߃ZbgύXieXgAx`}[NpjBgpłȂꍇfalseԂύXȂB
+const bool setLevel(const Level p_level);
+
+///[p_begin, p_end)p_setɊ܂܂ŏ̈̕ʒuBȂꍇp_endB
+const char* findFirstOf(const char* p_begin, const char* p_end, const ByteSet& p_set);
+
+///[p_begin, p_end)ōŏp_c̈ʒuBȂꍇp_endB
+const char* findChar(const char* p_begin, const char* p_end, const char p_c);
+
+///[p_begin, p_end)ɂp_c̐is̐𐔂̂Ɏgj
+std::size_t countChar(const char* p_begin, const char* p_end, const char p_c);
+
+///[p_begin, p_end)ōŏASCIIłȂi0x80ȏj̈ʒuBȂꍇp_endB
+const char* findNonAscii(const char* p_begin, const char* p_end);
+
+
+}//namespace scan
+}//namespace nana
+
+
+#endif  // #ifndef NANA_HTML_SCAN_INCLUDED
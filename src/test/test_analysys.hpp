@@ -15,6 +15,9 @@
 */
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <set>
+#include <functional>
 
 
 
@@ -48,6 +51,60 @@ TEST_FUNC(test_wildcardMatch1){
 	A_EQUALS(nana::wildcardMatch("tt?", "tt"), false, "ChmF");
 }
 
+///ċAŏƍ郏ChJ[hiȑO̎Brpj
+const bool recursiveWildcardMatch(const char *ptn, const char *str){
+	switch(*ptn){
+	case '\0':
+		return '\0' == *str;
+	case '*':
+		return recursiveWildcardMatch(ptn + 1, str) || (('\0' != *str) && recursiveWildcardMatch(ptn, str + 1));
+	case '?':
+		return ('\0' != *str) && recursiveWildcardMatch(ptn + 1, str + 1);
+	default:
+		if(*ptn == '\\') ++ptn;
+		if(*ptn == '\0' && *str != '\0') return false;
+		if(*ptn == '\0' && *str == '\0') return true;
+		return ((unsigned char)*ptn == (unsigned char)*str) && recursiveWildcardMatch(ptn + 1, str + 1);
+	}
+}
+
+///*𑽂܂ރp^[ƁAċA̎ƓʂɂȂ邩
+TEST_FUNC(test_wildcardMatch2){
+	A_EQUALS(nana::wildcardMatch("**", ""), true, "*");
+	A_EQUALS(nana::wildcardMatch("*a*b*c*", "xxaxxbxxcxx"), true, "*");
+	A_EQUALS(nana::wildcardMatch("*a*b*c*", "xxaxxcxxbxx"), false, "*");
+	A_EQUALS(nana::wildcardMatch("*\\*", "ab*"), true, "*̌̃GXP[v");
+	A_EQUALS(nana::wildcardMatch("*\\?", "ab?"), true, "*̌̃GXP[v");
+	A_EQUALS(nana::wildcardMatch("*\\?", "abc"), false, "*̌̃GXP[v");
+	A_EQUALS(nana::wildcardMatch("a*\\", "abc"), true, "*̌̍Ō\\");
+	A_EQUALS(nana::wildcardMatch("a\\\\b", "a\\b"), true, "\\̃GXP[v");
+	//Ԃ̂p^[iċAł͎wIɑj
+	const string longStr(5000, 'a');
+	A_EQUALS(nana::wildcardMatch("*a*a*a*a*a*a*a*a*a*a*b", longStr.c_str()), false, "*");
+	A_EQUALS(nana::wildcardMatch("*a*a*a*a*a*a*a*a*a*a*", longStr.c_str()), true, "*");
+	//_ȃp^[ƕŁAċA̎Ɣׂ
+	const char chars[] = {'a', 'b', '*', '?', '\\'};
+	unsigned int seed = 1;
+	int mismatch = 0;
+	for(int n = 0; n < 20000; ++n){
+		string ptn, str;
+		seed = seed * 1103515245 + 12345;
+		const std::size_t ptnLen = (seed >> 8) % 8;
+		for(std::size_t i = 0; i < ptnLen; ++i){
+			seed = seed * 1103515245 + 12345;
+			ptn += chars[(seed >> 8) % 5];
+		}
+		seed = seed * 1103515245 + 12345;
+		const std::size_t strLen = (seed >> 8) % 8;
+		for(std::size_t i = 0; i < strLen; ++i){
+			seed = seed * 1103515245 + 12345;
+			str += chars[(seed >> 8) % 5];
+		}
+		if(nana::wildcardMatch(ptn.c_str(), str.c_str()) != recursiveWildcardMatch(ptn.c_str(), str.c_str())) ++mismatch;
+	}
+	A_EQUALS(mismatch, 0, "ċA̎Ɠ");
+}
+
 
 //------------------------------------------
 
@@ -377,4 +434,829 @@ TEST_FUNC(test_copyUntilFindCommentClosed){
 };
 
 
+///Rs[Ȃnh HtmlDocument 쐬
+TEST_FUNC(test_DocumentHtmlSaxParserViewHandler1){
+	std::shared_ptr<string> strSptr(new string("<html><div id='main'><form name='f'><input name='1'></form></div><input name='2'></html>"));
+
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserViewHandler handler;
+	parser.parse(strSptr->data(), strSptr->size(), handler);
+	unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+	//̓obt@HtmlDocumentɕێ
+	docUptr->holdSource(strSptr);
+	strSptr.reset();
+
+	//
+	nana::path::HtmlPathExecutor executor;
+	executor.slash2().tag("div").predAttr("id", "main").slash2().tag("input");
+	unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> retExec = executor.exec(docUptr->rootNode());
+	//
+	A_EQUALS((*retExec).size(), 1, "o");
+	A_EQUALS((*retExec)[0]->pathStr(), "/html/div/form/input", "path()eXg");
+	A_EQUALS((*retExec)[0]->startTag()->str(), "<input name='1'>", "o^O̊mF");
+	A_TRUE((*retExec)[0]->startTag()->isView(), "QƂ̂");
+};
+
+
+///m[h̊Kw𕶎ɂirpj
+string nodeTreeStr(const nana::HtmlNode& p_node){
+	string ret = p_node.pathStr() + p_node.tagStr() + "{";
+	for(auto i = p_node.begin(); i != p_node.end(); ++i) ret += nodeTreeStr(**i);
+	return ret + "}";
+}
+
+/**
+A[iL HtmlDocument q[vLƓʂɂȂ邩
+*/
+TEST_FUNC(test_DocumentHtmlSaxParserHandler_arena){
+	string str("<html><div id='main' class=a class=b><form name='f'><input name='1'></form></div><!-- c --><br/>text<input name='2'></html>");
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler heapHandler;
+	parser.parse(str.data(), str.size(), heapHandler);
+	unique_ptr<nana::HtmlDocument> heapDocUptr = heapHandler.result();
+	nana::DocumentHtmlSaxParserHandler arenaHandler(nana::HtmlDocument::ARENA);
+	parser.parse(str.data(), str.size(), arenaHandler);
+	unique_ptr<nana::HtmlDocument> arenaDocUptr = arenaHandler.result();
+	//
+	A_EQUALS(heapDocUptr->ownership(), nana::HtmlDocument::HEAP, "q[v");
+	A_TRUE(heapDocUptr->arena() == nullptr, "q[v̓A[iȂ");
+	A_EQUALS(arenaDocUptr->ownership(), nana::HtmlDocument::ARENA, "A[i");
+	A_TRUE(arenaDocUptr->arena()->allocatedBytes() > 0, "A[i犄蓖");
+	A_EQUALS(arenaDocUptr->size(), heapDocUptr->size(), "^O");
+	for(std::size_t i = 0; i < heapDocUptr->size(); ++i){
+		A_TRUE(arenaDocUptr->at(i)->isInArena(), "A[iɔzu");
+		A_EQUALS(arenaDocUptr->at(i)->str(), heapDocUptr->at(i)->str(), "^O");
+		A_EQUALS(arenaDocUptr->at(i)->type(), heapDocUptr->at(i)->type(), "^Cv");
+	}
+	A_EQUALS(arenaDocUptr->at(1)->attr("class", 1), "b", "d");
+	//
+	nana::path::HtmlPathExecutor executor;
+	executor.slash2().tag("div").predAttr("id", "main").slash2().tag("input");
+	unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> retExec = executor.exec(arenaDocUptr->rootNode());
+	A_EQUALS((*retExec).size(), 1, "o");
+	A_EQUALS((*retExec)[0]->pathStr(), "/html/div/form/input", "path()eXg");
+	A_TRUE((*retExec)[0]->isInArena(), "m[hA[iɔzu");
+	//
+	A_EQUALS(nodeTreeStr(arenaDocUptr->rootNode()), nodeTreeStr(heapDocUptr->rootNode()), "m[h̊Kw");
+
+	//q[v̎qm[hǉł
+	nana::HtmlNode node(nullptr, nullptr, nullptr, nullptr);
+	node.appendChild(unique_ptr<nana::HtmlNode>(new nana::HtmlNode));
+	A_EQUALS(node.childNodeList().size(), 1, "unique_ptrϊ");
+};
+
+
+///󔒂̃eLXg쐬ȂꍇA1̋󔒂ɂꍇɁÃ^Oƃm[h̊KwςȂ
+TEST_FUNC(test_HtmlDocument_whitespace){
+	const string html("<html>\n  <head> <title>t</title></head>\r\n\t<body>\n<p>a b</p> <i>x</i>\f\n  </body>\n</html>\n");
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler keepHandler, collapseHandler, dropHandler;
+	A_EQUALS(keepHandler.whitespace(), nana::HtmlDocument::KEEP_WHITESPACE, "l");
+	collapseHandler.setWhitespace(nana::HtmlDocument::COLLAPSE_WHITESPACE);
+	dropHandler.setWhitespace(nana::HtmlDocument::DROP_WHITESPACE);
+	parser.parse(html.data(), html.size(), keepHandler);
+	parser.parse(html.data(), html.size(), collapseHandler);
+	parser.parse(html.data(), html.size(), dropHandler);
+	unique_ptr<nana::HtmlDocument> keep = keepHandler.result(), collapse = collapseHandler.result(), drop = dropHandler.result();
+	//1̋󔒂ɂꍇ̓^O̐AsEʒuςȂ
+	A_EQUALS(collapse->size(), keep->size(), "1̋󔒂ɂ");
+	std::size_t whitespaceCnt = 0;
+	for(std::size_t i = 0; i < keep->size(); ++i){
+		const nana::HtmlPart& part = *keep->at(i);
+		const nana::HtmlPart& collapsed = *collapse->at(i);
+		const bool isWhitespace = part.type() == nana::HtmlPart::TEXT && nana::isWhitespace(part.view());
+		if(isWhitespace) ++whitespaceCnt;
+		A_EQUALS(collapsed.str(), isWhitespace ? string(" ") : part.str(), "1̋󔒂ɂ");
+		A_EQUALS(collapsed.lineNum(), part.lineNum(), "s");
+		A_EQUALS(collapsed.posNum(), part.posNum(), "ʒu");
+	}
+	A_EQUALS(whitespaceCnt, 8, "󔒂̃eLXg");
+	A_TRUE(collapse->at(1)->view().data() == collapse->at(3)->view().data(), "̈L");
+	//쐬Ȃꍇ́A󔒂̃eLXg^O̗ɂȂ
+	A_EQUALS(drop->size(), keep->size() - whitespaceCnt, "쐬Ȃ");
+	std::size_t d = 0;
+	for(std::size_t i = 0; i < keep->size(); ++i){
+		const nana::HtmlPart& part = *keep->at(i);
+		if(part.type() == nana::HtmlPart::TEXT && nana::isWhitespace(part.view())) continue;
+		A_EQUALS(drop->at(d)->str(), part.str(), "쐬Ȃ");
+		A_EQUALS(drop->at(d)->lineNum(), part.lineNum(), "s");
+		A_EQUALS(drop->at(d)->posNum(), part.posNum(), "ʒu");
+		++d;
+	}
+	A_EQUALS(nodeTreeStr(drop->rootNode()), nodeTreeStr(keep->rootNode()), "m[h̊Kw");
+	A_EQUALS(nodeTreeStr(collapse->rootNode()), nodeTreeStr(keep->rootNode()), "m[h̊Kw");
+	//͈͂̌
+	const nana::HtmlNode& body = *drop->rootNode().childNodeList()[0]->childNodeList()[1];
+	A_EQUALS(body.tagName(), "body", "body");
+	nana::HtmlDocument::SearchResultsUptr range = drop->range(body.startTag(), body.endTag());
+	A_EQUALS(range->size(), 8, "͈");
+	A_EQUALS(range->back()->str(), "</body>", "͈");
+	//Rs[Ȃnh
+	nana::DocumentHtmlSaxParserViewHandler viewHandler;
+	viewHandler.setWhitespace(nana::HtmlDocument::DROP_WHITESPACE);
+	parser.parse(html.data(), html.size(), viewHandler);
+	unique_ptr<nana::HtmlDocument> view = viewHandler.result();
+	A_EQUALS(view->size(), drop->size(), "QƂ̂");
+	A_EQUALS(nodeTreeStr(view->rootNode()), nodeTreeStr(drop->rootNode()), "QƂ̂");
+	viewHandler.setWhitespace(nana::HtmlDocument::COLLAPSE_WHITESPACE);
+	parser.parse(html.data(), html.size(), viewHandler);
+	view = viewHandler.result();
+	A_EQUALS(view->size(), keep->size(), "QƂ̂");
+	A_EQUALS(view->at(1)->str(), " ", "QƂ̂");
+	//󔒈ȊO܂ރeLXg͎c
+	A_TRUE(nana::isWhitespace(nana::StrView(" \t\r\n\f")), "");
+	A_FALSE(nana::isWhitespace(nana::StrView(" a ")), "󔒈ȊO");
+	A_FALSE(nana::isWhitespace(nana::StrView("&nbsp;")), "Q");
+};
+
+/**
+󔒂̃eLXgŎn܂镶łA󔒂̃eLXg̈ɂ炸m[h̊KwɂȂ邩
+iŏ̃^O[g̕^O߂̂ŁA쐬ȂeLXgj
+*/
+TEST_FUNC(test_HtmlDocument_whitespace_root){
+	const string htmls[] = {"\n<div></div></div><p></p>", " \t<p>a</p></p><b>b</b>", "\n\n<html><br>\n</html><i>x</i>\n"};
+	const nana::HtmlDocument::Whitespace modes[] = {nana::HtmlDocument::KEEP_WHITESPACE, nana::HtmlDocument::COLLAPSE_WHITESPACE, nana::HtmlDocument::DROP_WHITESPACE};
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	nana::HtmlSaxParser parser;
+	for(auto h = std::begin(htmls); h != std::end(htmls); ++h){
+		for(int p = 0; p < 2; ++p){
+			const string msg = *h + " " + std::to_string(p);
+			string keepTree;
+			for(int m = 0; m < 3; ++m){
+				nana::DocumentHtmlSaxParserHandler handler(nana::HtmlDocument::HEAP, policies[p]);
+				nana::DocumentHtmlSaxParserViewHandler viewHandler(nana::HtmlDocument::HEAP, policies[p]);
+				handler.setWhitespace(modes[m]);
+				viewHandler.setWhitespace(modes[m]);
+				parser.parse(h->data(), h->size(), handler);
+				parser.parse(h->data(), h->size(), viewHandler);
+				unique_ptr<nana::HtmlDocument> doc = handler.result(), viewDoc = viewHandler.result();
+				if(m == 0) keepTree = nodeTreeStr(doc->rootNode());
+				A_EQUALS(nodeTreeStr(doc->rootNode()), keepTree, (msg + " [h" + std::to_string(m)).c_str());
+				A_EQUALS(nodeTreeStr(viewDoc->rootNode()), keepTree, (msg + " QƂ̂ [h" + std::to_string(m)).c_str());
+			}
+		}
+	}
+	//[g̎qm[h́A^Ǒ̃^O܂
+	nana::DocumentHtmlSaxParserHandler dropHandler;
+	dropHandler.setWhitespace(nana::HtmlDocument::DROP_WHITESPACE);
+	parser.parse(htmls[0].data(), htmls[0].size(), dropHandler);
+	unique_ptr<nana::HtmlDocument> drop = dropHandler.result();
+	A_EQUALS(drop->rootNode().childNodeList().size(), 3, "[g̎qm[h");
+};
+
+
+/**
+̒x́BXbh瓯ɏANZXĂʂɂȂ邩
+*/
+TEST_FUNC(test_TagHtmlPart_lazyAttr){
+	string str;
+	for(int i = 0; i < 200; ++i){
+		str += "<a HREF='/p/" + std::to_string(i) + "' class=c title=\"t t\" checked>x</a>";
+	}
+	const nana::HtmlDocument::Ownership owners[] = {nana::HtmlDocument::HEAP, nana::HtmlDocument::ARENA};
+	for(int o = 0; o < 2; ++o){
+		nana::HtmlSaxParser parser;
+		nana::DocumentHtmlSaxParserHandler handler(owners[o]);
+		parser.parse(str.data(), str.size(), handler);
+		unique_ptr<const nana::HtmlDocument> docUptr(handler.result());
+		const nana::HtmlDocument& doc = *docUptr;
+		//^O͍쐬ɉ͍ς
+		A_EQUALS(doc.at(0)->tagName(), "a", "^O");
+		A_EQUALS(doc.at(2)->tagName(), "/a", "I^O");
+		//
+		vector<string> results[4];
+		vector<std::thread> threads;
+		for(int t = 0; t < 4; ++t){
+			threads.push_back(std::thread([&doc, &results, t]{
+				for(auto i = doc.begin(); i != doc.end(); ++i){
+					if((*i)->tagName() != "a") continue;
+					string ret = (*i)->attr("href", 0) + "," + (*i)->attr("title", 0);
+					ret += static_cast<const nana::TagHtmlPart&>(**i).hasAttr("checked", 0) ? ",checked" : ",";
+					ret += "," + std::to_string((*i)->attrNames()->size());
+					results[t].push_back(ret);
+				}
+			}));
+		}
+		for(auto i = threads.begin(); i != threads.end(); ++i) i->join();
+		A_EQUALS(results[0].size(), 200, "^O");
+		A_EQUALS(results[0][7], "/p/7,t t,checked,4", "");
+		for(int t = 1; t < 4; ++t) A_TRUE(results[t] == results[0], "XbhƂ̌");
+	}
+};
+
+
+/**
+WȊÕ^Oi atom::UNKNOWN jǂłA^OƂɊJn^OƏI^O΂ɂ邩B
+W̃^OɒuƓKwɂȂ邱Ƃm߂
+*/
+TEST_FUNC(test_analyzeHtmlNode_nonStandardNames){
+	const string custom("<x-a><x-b><x-c></x-c></x-b><my-el></x-c></my-el></x-a></x-a><my-el>after</X-B><x-c>");
+	const string standard("<div><b><i></i></b><p></i></p></div></div><p>after</B><i>");
+	//^OKwiĂ邩AI^Oj
+	std::function<string(const nana::HtmlNode&)> shape = [&shape](const nana::HtmlNode& p_node){
+		string ret = p_node.isClosed() ? "c" : (p_node.startTag() == nullptr ? "/" : "o");
+		ret += "(";
+		for(auto i = p_node.begin(); i != p_node.end(); ++i) ret += shape(**i);
+		return ret + ")";
+	};
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler customHandler, standardHandler;
+	parser.parse(custom.data(), custom.size(), customHandler);
+	parser.parse(standard.data(), standard.size(), standardHandler);
+	unique_ptr<nana::HtmlDocument::HtmlPartUptrs> customParts = customHandler.result(), standardParts = standardHandler.result();
+	for(int p = 0; p < 2; ++p){
+		nana::HtmlNode customRoot(nullptr, nullptr, nullptr), standardRoot(nullptr, nullptr, nullptr);
+		if(p == 0){
+			nana::analyzeHtmlNode(customRoot, *customParts);
+			nana::analyzeHtmlNode(standardRoot, *standardParts);
+		} else{
+			nana::analyzeHtmlNodeBySameTagMatch(customRoot, *customParts);
+			nana::analyzeHtmlNodeBySameTagMatch(standardRoot, *standardParts);
+		}
+		const string msg = "" + std::to_string(p);
+		A_EQUALS(shape(customRoot), shape(standardRoot), (msg + " Kw").c_str());
+		//pX͖OŔr
+		nana::path::HtmlPathExecutor customPath, standardPath;
+		customPath.slash2().tag("x-c");
+		standardPath.slash2().tag("i");
+		A_EQUALS(customPath.exec(customRoot)->size(), standardPath.exec(standardRoot)->size(), (msg + " //x-c").c_str());
+	}
+	//ĂȂ^O͖OƂɑ΂ɂ
+	const string str2("<html><x-a><x-b></x-a></html>");
+	nana::DocumentHtmlSaxParserHandler handler;
+	parser.parse(str2.data(), str2.size(), handler);
+	unique_ptr<nana::HtmlDocument> doc = handler.result();
+	nana::EndTagAccessor acc;
+	nana::HtmlNodeVisitor vis;
+	vis.access(doc->rootNode(), acc);
+	nana::EndTagAccessor::SearchResultsUptr nonClosed = acc.nonClosedResult();
+	A_EQUALS(nonClosed->size(), 1, "ĂȂ^O");
+	if(nonClosed->size() == 1) A_EQUALS((*nonClosed)[0]->tagName(), "x-b", "ĂȂ^O");
+};
+
+
+///[KwiċAĂяoł̓X^bNg؂[j̃m[h͂Ɣj
+TEST_FUNC(test_HtmlNodeBuilder_deep){
+	const std::size_t depth = 200000;
+	string str;
+	for(std::size_t i = 0; i < depth / 2; ++i) str += "<div><font>";
+	str += "<br>text";
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserViewHandler handler;
+	parser.parse(str.data(), str.size(), handler);
+	unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		unique_ptr<nana::HtmlNode> rootUptr(new nana::HtmlNode(nullptr, nullptr, nullptr));
+		{
+			//r_[̓m[hɔj
+			nana::HtmlNodeBuilder builder(*rootUptr, policies[p]);
+			for(auto i = partsUptr->begin(); i != partsUptr->end(); ++i) builder.push(**i);
+			A_EQUALS(builder.depth(), depth, "JĂm[h̐[");
+			A_FALSE(builder.finished(), "[g͕ĂȂ");
+		}
+		//Ԑ[m[h܂łǂ
+		const nana::HtmlNode* node = rootUptr.get();
+		std::size_t n = 0;
+		while(!node->childNodeList().empty() && node->childNodeList()[0]->tagName() != "br"){
+			node = node->childNodeList()[0].get();
+			++n;
+		}
+		A_EQUALS(n, depth, "m[h̐[");
+		A_EQUALS(node->tagName(), "font", "Ԑ[m[h");
+		A_TRUE(node->endTag() == nullptr, "ĂȂ");
+		//KƔjċAȂ
+		nana::DeprecatedInHtml5Accessor acc;
+		nana::HtmlNodeVisitor vis;
+		vis.access(*rootUptr, acc);
+		A_EQUALS(acc.result()->size(), depth / 2, "font");
+		rootUptr.reset();
+	}
+	//[g̕^Ǒ͖
+	string str2("<p>a</p></p><b>");
+	parser.parse(str2.data(), str2.size(), handler);
+	partsUptr = handler.result();
+	nana::HtmlNode root(nullptr, nullptr, nullptr);
+	nana::HtmlNodeBuilder builder(root, nana::HtmlNodeBuilder::HIERARCHY_MATCH);
+	for(auto i = partsUptr->begin(); i != partsUptr->end(); ++i) builder.push(**i);
+	A_TRUE(builder.finished(), "[g̕^O");
+	A_EQUALS(root.childNodeList().size(), 1, "^Ǒ͖");
+};
+
+
+/**
+WȊÕ^Oi atom::UNKNOWN jǂłA^OƂɊJn^OƏI^O΂ɂ邩B
+W̃^OɒuƓKwɂȂ邱Ƃm߂
+*/
+TEST_FUNC(test_HtmlNodeBuilder_nonStandardNames){
+	const string custom("<x-a><x-b><x-c></x-c></x-b><my-el></x-c></my-el></x-a></x-a><my-el>after</X-B><x-c>");
+	const string standard("<div><b><i></i></b><p></i></p></div></div><p>after</B><i>");
+	//^OKwiĂ邩AI^Oj
+	std::function<string(const nana::HtmlNode&)> shape = [&shape](const nana::HtmlNode& p_node){
+		string ret = p_node.isClosed() ? "c" : (p_node.startTag() == nullptr ? "/" : "o");
+		ret += "(";
+		for(auto i = p_node.begin(); i != p_node.end(); ++i) ret += shape(**i);
+		return ret + ")";
+	};
+	nana::HtmlSaxParser parser;
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		nana::DocumentHtmlSaxParserHandler customHandler(nana::HtmlDocument::HEAP, policies[p]), standardHandler(nana::HtmlDocument::HEAP, policies[p]);
+		parser.parse(custom.data(), custom.size(), customHandler);
+		parser.parse(standard.data(), standard.size(), standardHandler);
+		unique_ptr<nana::HtmlDocument> customDoc = customHandler.result(), standardDoc = standardHandler.result();
+		const string msg = "" + std::to_string(p);
+		A_EQUALS(shape(customDoc->rootNode()), shape(standardDoc->rootNode()), (msg + " Kw").c_str());
+		//p[X̓rł
+		nana::path::HtmlPathStreamHandler stream(policies[p]);
+		const nana::path::HtmlPathPlan xc("//x-c"), xab("//x-a/x-b"), myEl("//my-el");
+		stream.addQuery(xc);
+		stream.addQuery(xab);
+		stream.addQuery(myEl);
+		stream.parse(parser, custom.data(), custom.size());
+		//pX͖OŔr
+		const nana::HtmlNode& root = customDoc->rootNode();
+		A_EQUALS(xc.exec(root)->size(), nana::path::HtmlPathPlan("//i").exec(standardDoc->rootNode())->size(), (msg + " //x-c").c_str());
+		A_EQUALS(xab.exec(root)->size(), 1, (msg + " //x-a/x-b").c_str());
+		A_EQUALS(myEl.exec(root)->size(), nana::path::HtmlPathPlan("//p").exec(standardDoc->rootNode())->size(), (msg + " //my-el").c_str());
+		A_EQUALS(stream.matches(0).size(), xc.exec(root)->size(), (msg + " p[X //x-c").c_str());
+		A_EQUALS(stream.matches(1).size(), 1, (msg + " p[X //x-a/x-b").c_str());
+		A_EQUALS(stream.matches(2).size(), myEl.exec(root)->size(), (msg + " p[X //my-el").c_str());
+		nana::path::HtmlPathExecutor executor;
+		executor.slash2().tag("x-c");
+		A_EQUALS(executor.exec(root)->size(), xc.exec(root)->size(), (msg + " HtmlPathExecutor").c_str());
+	}
+	//ĂȂ^O͖OƂɑ΂ɂ
+	const string str2("<html><x-a><x-b></x-a></html>");
+	nana::DocumentHtmlSaxParserHandler handler;
+	parser.parse(str2.data(), str2.size(), handler);
+	unique_ptr<nana::HtmlDocument> doc = handler.result();
+	nana::EndTagAccessor acc;
+	nana::HtmlNodeVisitor vis;
+	vis.access(doc->rootNode(), acc);
+	nana::EndTagAccessor::SearchResultsUptr nonClosed = acc.nonClosedResult();
+	A_EQUALS(nonClosed->size(), 1, "ĂȂ^O");
+	if(nonClosed->size() == 1) A_EQUALS((*nonClosed)[0]->tagName(), "x-b", "ĂȂ^O");
+};
+
+
+/**
+p[Xɍ쐬m[h̊KwA^Ozォ͂ʂƓɂȂ邩
+*/
+TEST_FUNC(test_DocumentHtmlSaxParserHandler_streaming){
+	string str("<html><form><div></form></div><p>a<br><b>b</p></b><!-- c --></html></html><i>x");
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler simpleHandler;
+	parser.parse(str.data(), str.size(), simpleHandler);
+	unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = simpleHandler.result();
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		nana::HtmlNode expected(nullptr, nullptr, nullptr);
+		if(policies[p] == nana::HtmlNodeBuilder::HIERARCHY_MATCH){
+			nana::analyzeHtmlNode(expected, *partsUptr);
+		} else{
+			nana::analyzeHtmlNodeBySameTagMatch(expected, *partsUptr);
+		}
+		nana::DocumentHtmlSaxParserHandler handler(nana::HtmlDocument::HEAP, policies[p]);
+		A_EQUALS(handler.policy(), policies[p], "͎@");
+		A_TRUE(handler.result() == nullptr, "p[XO");
+		parser.parse(str.data(), str.size(), handler);
+		unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+		A_EQUALS(docUptr->size(), partsUptr->size(), "[g̕^Ǒ̃^Oێ");
+		A_EQUALS(nodeTreeStr(docUptr->rootNode()), nodeTreeStr(expected), "m[h̊Kw");
+		A_TRUE(handler.result() == nullptr, "ʎ擾");
+		//nhg܂킷
+		nana::DocumentHtmlSaxParserViewHandler viewHandler(nana::HtmlDocument::ARENA, policies[p]);
+		parser.parse(str.data(), str.size(), viewHandler);
+		parser.parse(str.data(), str.size(), viewHandler);
+		docUptr = viewHandler.result();
+		A_EQUALS(nodeTreeStr(docUptr->rootNode()), nodeTreeStr(expected), "m[h̊KwiQƁj");
+	}
+};
+
+
+///m[h̊KwA^O̍sEʒuƍs̔ԍ܂߂ĕɂirpj
+string nodePosTreeStr(const nana::HtmlNode& p_node){
+	string ret = p_node.tagStr() + "#" + std::to_string(p_node.order()) + "-" + std::to_string(p_node.lastOrder());
+	if(p_node.startTag() != nullptr) ret += std::to_string(p_node.startTag()->lineNum()) + ":" + std::to_string(p_node.startTag()->posNum());
+	if(p_node.endTag() != nullptr) ret += "-" + std::to_string(p_node.endTag()->lineNum()) + ":" + std::to_string(p_node.endTag()->posNum());
+	ret += "{";
+	for(auto i = p_node.begin(); i != p_node.end(); ++i){
+		if((*i)->parent() != &p_node) ret += "[parent]";
+		ret += nodePosTreeStr(**i);
+	}
+	return ret + "}";
+}
+
+///ҏW HtmlDocument AҏWHTMLŏp[XʂƓ
+void assertSameAsFreshParse(const nana::HtmlDocumentEditor& p_editor, const string& p_msg){
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler handler(nana::HtmlDocument::HEAP, p_editor.policy());
+	parser.parse(p_editor.source().data(), p_editor.source().size(), handler);
+	unique_ptr<nana::HtmlDocument> expectedUptr = handler.result();
+	const nana::HtmlDocument& doc = p_editor.document();
+	A_EQUALS(doc.size(), expectedUptr->size(), (p_msg + " ^O̐").c_str());
+	if(doc.size() != expectedUptr->size()) return;
+	for(std::size_t i = 0; i < doc.size(); ++i){
+		const nana::HtmlPart& part = *doc.at(i);
+		const nana::HtmlPart& expected = *expectedUptr->at(i);
+		if(part.str() != expected.str() || part.type() != expected.type()
+			|| part.lineNum() != expected.lineNum() || part.posNum() != expected.posNum()){
+			A_EQUALS(part.str() + "@" + std::to_string(part.lineNum()) + ":" + std::to_string(part.posNum()),
+				expected.str() + "@" + std::to_string(expected.lineNum()) + ":" + std::to_string(expected.posNum()), (p_msg + " ^O").c_str());
+			return;
+		}
+	}
+	A_EQUALS(nodePosTreeStr(doc.rootNode()), nodePosTreeStr(expectedUptr->rootNode()), (p_msg + " m[h̊Kw").c_str());
+	A_EQUALS(nodeTreeStr(doc.rootNode()), nodeTreeStr(expectedUptr->rootNode()), (p_msg + " m[h̃pX").c_str());
+}
+
+/**
+_ȕҏWJԂĂAŏp[XʂƓɂȂ邩
+*/
+TEST_FUNC(test_HtmlDocumentEditor_random){
+	string base("<!DOCTYPE html>\n<html><head><title>t</title></head>\n<body>\n");
+	for(int i = 0; i < 20; ++i){
+		base += "<div id=d" + std::to_string(i) + "><p>text " + std::to_string(i) + "\n< not tag</p>"
+			"<!-- comment\n" + std::to_string(i) + " --><br/><input type=text><ul><li>a</li><li>b</li></ul></div>\n";
+	}
+	base += "</body></html>";
+	const char* snippets[] = {"", "x", "\n", "<b>", "</b>", "<div>", "</div>", "</p>", "<!-- c -->", "<!-- ", " -->",
+		"< ", "<", ">", "<br/>", "<p>q\n</p>", "</html>", "<li>", "text\nline"};
+	const std::size_t snippetCnt = sizeof(snippets) / sizeof(snippets[0]);
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		nana::HtmlDocumentEditor editor(base, policies[p]);
+		assertSameAsFreshParse(editor, "ҏWO");
+		unsigned int seed = 12345;
+		int partialCnt = 0;
+		for(int n = 0; n < 300; ++n){
+			//ꂽHTML΂ɂȂȂ悤ɁAƂǂɖ߂
+			if(n % 5 == 0) editor.replace(0, editor.source().size(), base);
+			seed = seed * 1103515245 + 12345;
+			const std::size_t begin = (seed >> 8) % (editor.source().size() + 1);
+			seed = seed * 1103515245 + 12345;
+			const std::size_t size = std::min<std::size_t>((seed >> 8) % 8, editor.source().size() - begin);
+			seed = seed * 1103515245 + 12345;
+			editor.replace(begin, size, snippets[(seed >> 8) % snippetCnt]);
+			assertSameAsFreshParse(editor, "ҏW" + std::to_string(n));
+			if(!editor.lastStats().fullRebuild) ++partialCnt;
+		}
+		if(policies[p] == nana::HtmlNodeBuilder::HIERARCHY_MATCH) A_TRUE(partialCnt > 0, "Iɍ蒼ҏW");
+		//Sď
+		editor.replace(0, editor.source().size(), "");
+		assertSameAsFreshParse(editor, "S폜");
+		A_EQUALS(editor.document().size(), 0, "S폜");
+		editor.replace(0, 0, base);
+		assertSameAsFreshParse(editor, "S}");
+	}
+};
+
+/**
+ǏIȕҏWł́AҏWӏ̎肾͂
+*/
+TEST_FUNC(test_HtmlDocumentEditor_local){
+	string base("<html><body>\n");
+	for(int i = 0; i < 1000; ++i) base += "<div><p>line " + std::to_string(i) + "</p><span>s</span></div>\n";
+	base += "</body></html>";
+	nana::HtmlDocumentEditor editor(base);
+	const std::size_t partCnt = editor.document().size();
+	//eLXg̏isj
+	const std::size_t textPos = editor.source().find("line 500");
+	editor.replace(textPos, 4, "row\n");
+	assertSameAsFreshParse(editor, "eLXg");
+	A_TRUE(editor.lastStats().reparsedParts <= 2, "eLXg ^O");
+	A_TRUE(editor.lastStats().scannedBytes < 20, "eLXg oCg");
+	A_FALSE(editor.lastStats().fullRebuild, "eLXg Iɍ蒼");
+	A_TRUE(editor.lastStats().rebuiltParts < 10, "eLXg 蒼^O");
+	//^Ȏ}iΉI^O}j
+	const std::size_t tagPos = editor.source().find("<span>", textPos);
+	editor.replace(tagPos, 0, "<b>bold</b>");
+	assertSameAsFreshParse(editor, "^O");
+	A_FALSE(editor.lastStats().fullRebuild, "^O Iɍ蒼");
+	A_TRUE(editor.lastStats().rebuiltParts < 20, "^O 蒼^O");
+	//ĂȂ^Ȏ}͊Oō蒼
+	editor.replace(tagPos, 0, "<i>");
+	assertSameAsFreshParse(editor, "ĂȂ^O");
+	A_EQUALS(editor.document().size(), partCnt + 3 + 1, "^O̐");
+	//͈͊O
+	bool thrown = false;
+	try{
+		editor.replace(editor.source().size(), 1, "x");
+	} catch(std::out_of_range&){
+		thrown = true;
+	}
+	A_TRUE(thrown, "͈͊O");
+};
+
+
+/**
+RpCpXA HtmlPathExecutor Ɠm[h𕶏̏ԂŕԂ
+*/
+TEST_FUNC(test_HtmlPathPlan){
+	string str("<html><body><div class='item a' id=d1><a href=1>1</a><a href=2>2</a><div class=item><a href=3>3</a>"
+		"<p><a href=4 class=x>4</a></p></div></div><div class=other><a href=5>5</a><a href=6>6</a></div>"
+		"<ul><li>a</li><li>b</li><li class=x>c</li></ul><ul><li class=x>d</li></ul></body></html>");
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler handler;
+	parser.parse(str.data(), str.size(), handler);
+	unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+	const nana::HtmlNode& root = docUptr->rootNode();
+	//̏ԁiJn^O̔ԍj
+	std::map<const nana::HtmlPart*, std::size_t> partIndex;
+	for(std::size_t i = 0; i < docUptr->size(); ++i) partIndex[docUptr->at(i)] = i;
+	auto order = [&](const nana::HtmlNode* p_node){ return partIndex[p_node->startTag() != nullptr ? p_node->startTag() : p_node->endTag()]; };
+	struct Case{ const char* path; std::function<void(nana::path::HtmlPathExecutor&)> build; std::size_t count; };
+	const Case cases[] = {
+		{"/html/body/div", [](nana::path::HtmlPathExecutor& e){ e.tag("html").tag("body").tag("div"); }, 2},
+		{"//a", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("a"); }, 6},
+		{"//div[@class='item*']/a[2]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").predAttr("class", "item*").tag("a").predPos(1); }, 1},
+		{"//div[@class='item*']/a", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").predAttr("class", "item*").tag("a"); }, 3},
+		{"//div//a", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").slash2().tag("a"); }, 6},
+		{"//div[@id]//p/a[@class=\"x\"]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").predAttr("id", "").slash2().tag("p").tag("a").predAttr("class", "x"); }, 1},
+		{"//li[1]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("li").predPos(0); }, 2},
+		{"//li[@class=x][1]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("li").predAttr("class", "x").predPos(0); }, 2},
+		{"//li[1][@class=x]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("li").predPos(0).predAttr("class", "x"); }, 1},
+		{"//ul[2]/li", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("ul").predPos(1).tag("li"); }, 1},
+		{"//*[@href=?]", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*").predAttr("href", "?"); }, 6},
+		{"//d?v/*", [](nana::path::HtmlPathExecutor& e){ e.slash2().tag("d?v").tag("*"); }, 7},
+		{"/body", [](nana::path::HtmlPathExecutor& e){ e.tag("body"); }, 0},
+	};
+	nana::path::HtmlPathPlan::Workspace workspace;
+	for(auto c = std::begin(cases); c != std::end(cases); ++c){
+		nana::path::HtmlPathExecutor executor;
+		c->build(executor);
+		unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> expected = executor.exec(root);
+		const nana::path::HtmlPathPlan plan(c->path);
+		A_EQUALS(plan.str(), c->path, "pX");
+		unique_ptr<nana::path::HtmlPathPlan::HtmlNodePtrs> result = plan.exec(root);
+		A_EQUALS(result->size(), c->count, c->path);
+		//W𕶏̏ԂŕԂ
+		std::sort(expected->begin(), expected->end(), [&](const nana::HtmlNode* a, const nana::HtmlNode* b){ return order(a) < order(b); });
+		A_TRUE(*result == *expected, c->path);
+		//Ɨ̈g
+		nana::path::HtmlPathPlan::HtmlNodePtrs reused;
+		plan.exec(root, reused, workspace);
+		A_TRUE(reused == *expected, c->path);
+	}
+	//G[
+	const char* errors[] = {"", "div", "//", "/a[", "/a[0]", "/a[x]", "/a[@]", "/a[@b='c]", "/a[1", "/a/"};
+	for(auto e = std::begin(errors); e != std::end(errors); ++e){
+		bool thrown = false;
+		try{
+			nana::path::HtmlPathPlan plan(*e);
+		} catch(std::runtime_error&){
+			thrown = true;
+		}
+		A_TRUE(thrown, *e);
+	}
+};
+
+
+/**
+g HtmlPathExecutor::exec(const HtmlDocument&) A[gm[hHꍇƓʂ𓯂ԂŕԂ
+*/
+TEST_FUNC(test_HtmlNodeIndex){
+	string str("<html><body><div id=top class='item main'><a href=1>1</a><img src=a><div class=item><a href=2 id=x>2</a>"
+		"<p><a href=3>3</a><img src=b alt=b></p><a href=4>4</a></div><a href=5>5</a></div></b><div class=other id=x>"
+		"<a>6</a><a class=item>7</a></div><ul><li>a</li><li id=y>b</li></ul><ul><li>c</li><li>d</li></ul></body></html>");
+	const nana::HtmlDocument::Ownership ownerships[] = {nana::HtmlDocument::HEAP, nana::HtmlDocument::ARENA};
+	for(int o = 0; o < 2; ++o){
+		nana::HtmlSaxParser parser;
+		nana::DocumentHtmlSaxParserHandler handler(ownerships[o]);
+		parser.parse(str.data(), str.size(), handler);
+		unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+		const nana::HtmlNodeIndex& index = docUptr->index();
+		A_TRUE(&docUptr->index() == &index, "1񂾂쐬");
+		A_EQUALS(index.byTag(nana::atom::intern("a")).size(), 7, "^O");
+		A_EQUALS(index.byTag(nana::atom::intern("b")).size(), 1, "I^Õm[h");
+		A_EQUALS(index.byTag(nana::atom::intern("table")).size(), 0, "Ȃ^O");
+		A_EQUALS(index.byAttrName(nana::atom::intern("href")).size(), 5, "");
+		A_EQUALS(index.byId("x").size(), 2, "id");
+		A_EQUALS(index.byClass("item").size(), 3, "class");
+		A_EQUALS(index.byClass("main").size(), 1, "class");
+		A_EQUALS(docUptr->rootNode().order(), 0, "[g̔ԍ");
+		const nana::HtmlNodeIndex::Nodes& anchors = index.byTag(nana::atom::intern("a"));
+		A_TRUE(anchors[0]->order() < anchors[1]->order() && anchors[5]->order() < anchors[6]->order(), "̏");
+		//[gm[hHʂƔׂ
+		std::vector<std::function<void(nana::path::HtmlPathExecutor&)>> builds;
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("a"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("img"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*").predAttr("id", "x"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*").predAttr("class", "item"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*").predAttr("class", "item*"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").predAttr("class", "item").tag("a"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("a").predPos(1); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("a").predAttr("href", "").predPos(0); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*").predAttr("id", "").predPos(1); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("li").predPos(1); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("div").slash2().tag("a"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("/b"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("table"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.slash2().tag("*"); });
+		builds.push_back([](nana::path::HtmlPathExecutor& e){ e.tag("html").tag("body").tag("div"); });
+		for(std::size_t b = 0; b < builds.size(); ++b){
+			nana::path::HtmlPathExecutor executor;
+			builds[b](executor);
+			unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> expected = executor.exec(docUptr->rootNode());
+			unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> result = executor.exec(*docUptr);
+			A_TRUE(*result == *expected, ("g " + std::to_string(b)).c_str());
+		}
+	}
+	//ҏWƍ蒼
+	nana::HtmlDocumentEditor editor(str);
+	A_EQUALS(editor.document().index().byId("x").size(), 2, "ҏWO");
+	editor.replace(editor.source().find("id=x"), 4, "id=z");
+	A_EQUALS(editor.document().index().byId("x").size(), 1, "ҏW");
+	A_EQUALS(editor.document().index().byId("z").size(), 1, "ҏW");
+};
+
+
+
+///sɒHăm[hW߂irpj
+void preorderNodes(const nana::HtmlNode& p_node, vector<const nana::HtmlNode*>& p_ret){
+	p_ret.push_back(&p_node);
+	for(auto i = p_node.begin(); i != p_node.end(); ++i) preorderNodes(**i, p_ret);
+}
+
+///m[h̔ԍsɂȂĂāAqm[h͈̔͂
+void assertNodeOrder(const nana::HtmlNode& p_root, const string& p_msg){
+	vector<const nana::HtmlNode*> nodes;
+	preorderNodes(p_root, nodes);
+	int mismatch = 0;
+	for(std::size_t i = 0; i < nodes.size(); ++i){
+		vector<const nana::HtmlNode*> subtree;
+		preorderNodes(*nodes[i], subtree);
+		if(nodes[i]->order() != i || nodes[i]->lastOrder() != i + subtree.size() - 1) ++mismatch;
+	}
+	A_EQUALS(mismatch, 0, (p_msg + " s̔ԍ").c_str());
+}
+
+/**
+m[h̍s̔ԍƁAgqm[h̒oi//j
+*/
+TEST_FUNC(test_HtmlNode_order){
+	string str("<html><body>\n");
+	for(int i = 0; i < 30; ++i){
+		str += "<div><p>t<b>x</b></p><ul><li>a</li><li>b</li></ul></i></div><br/><input type=text><!-- c -->\n";
+	}
+	str += "</body></html>";
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	for(int p = 0; p < 2; ++p){
+		const string msg = "" + std::to_string(p);
+		nana::HtmlDocumentEditor editor(str, policies[p]);
+		const nana::HtmlNode& root = editor.document().rootNode();
+		assertNodeOrder(root, msg);
+		A_TRUE(root.contains(root), (msg + " g܂").c_str());
+		//qm[h͍sŏdȂB͂̏ԂdȂɂȂ
+		vector<const nana::HtmlNode*> all;
+		preorderNodes(root, all);
+		nana::path::HtmlPathExecutor executor;
+		executor.slash2();
+		unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> result = executor.exec(root);
+		A_TRUE(*result == all, (msg + " [g").c_str());
+		nana::path::HtmlPath::HtmlNodePtrs inputs;
+		for(int i = (int)all.size() - 1; i > 0; i -= 7) inputs.push_back(all[i]);
+		inputs.push_back(all[1]);
+		inputs.push_back(all[all.size() - 1]);
+		std::set<const nana::HtmlNode*> expectedSet;
+		for(auto i = inputs.begin(); i != inputs.end(); ++i){
+			vector<const nana::HtmlNode*> subtree;
+			preorderNodes(**i, subtree);
+			expectedSet.insert(subtree.begin(), subtree.end());
+		}
+		vector<const nana::HtmlNode*> expected;
+		for(auto i = all.begin(); i != all.end(); ++i) if(expectedSet.count(*i) != 0) expected.push_back(*i);
+		result = executor.exec(inputs);
+		A_TRUE(*result == expected, (msg + " dȂ").c_str());
+		//Iɍ蒼Ăԍt
+		editor.replace(editor.source().find("<b>"), 0, "<i>y</i><b>z</b>");
+		if(policies[p] == nana::HtmlNodeBuilder::HIERARCHY_MATCH) A_FALSE(editor.lastStats().fullRebuild, (msg + " Iɍ蒼").c_str());
+		assertNodeOrder(editor.document().rootNode(), msg + " Iɍ蒼");
+		editor.replace(0, editor.source().find("<body>"), "<html><div>");
+		assertNodeOrder(editor.document().rootNode(), msg + " Ŝ蒼");
+	}
+};
+
+/**
+ HtmlNodeBuilder g킸ɍiԍ̂Ȃj؂łAqm[h𒊏oi//jł邩
+*/
+TEST_FUNC(test_HtmlNode_order_handBuilt){
+	string str("<div><span><b>");
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler handler;
+	parser.parse(str.data(), str.size(), handler);
+	unique_ptr<nana::HtmlDocument::HtmlPartUptrs> partsUptr = handler.result();
+	//rootdivspanArootb
+	nana::HtmlNode root;
+	nana::HtmlNode::NodeUptr divUptr(new nana::HtmlNode((*partsUptr)[0].get(), nullptr, nullptr));
+	nana::HtmlNode& div = *divUptr;
+	div.appendChild(nana::HtmlNode::NodeUptr(new nana::HtmlNode((*partsUptr)[1].get(), nullptr, nullptr)));
+	root.appendChild(move(divUptr));
+	root.appendChild(nana::HtmlNode::NodeUptr(new nana::HtmlNode((*partsUptr)[2].get(), nullptr, nullptr)));
+	nana::path::HtmlPathExecutor executor;
+	executor.slash2().tag("span");
+	unique_ptr<nana::path::HtmlPath::HtmlNodePtrs> result = executor.exec(root);
+	A_EQUALS(result->size(), 1, "span");
+	nana::path::HtmlPathExecutor all;
+	all.slash2();
+	result = all.exec(root);
+	A_EQUALS(result->size(), 4, "ׂẴm[h");
+	if(result->size() == 4){
+		A_TRUE((*result)[0] == &root, "s root");
+		A_EQUALS((*result)[1]->tagName(), "div", "s div");
+		A_EQUALS((*result)[2]->tagName(), "span", "s span");
+		A_EQUALS((*result)[3]->tagName(), "b", "s b");
+	}
+	//dȂ͂1񂾂
+	nana::path::HtmlPath::HtmlNodePtrs inputs;
+	inputs.push_back(&div);
+	inputs.push_back(&root);
+	result = all.exec(inputs);
+	A_EQUALS(result->size(), 4, "dȂ");
+};
+
+
+/**
+p[XɃpX]ʂA؂ HtmlPathPlan::exec() ʂƓ
+*/
+TEST_FUNC(test_HtmlPathStreamHandler){
+	vector<string> docs;
+	docs.push_back("<!DOCTYPE html>\n<html><head><title>T <b>1</b></title><meta name=description content='d'></head><body>"
+		"<div class='item a' id=d1><a href=1>1</a><a href=2>2</a><div class=item><a href=3>3</a>"
+		"<p><a href=4 class=x>4</a></p></div></div><div class=other><a href=5>5</a><a href=6>6</a></div>\n"
+		"<ul><li>a</li><li>b</li><li class=x>c</li></ul><ul><li class=x>d</li></ul></body></html>");
+	//ĂȂ^OA΂ɂȂȂI^OA[g̕^Ǒ̃^OAṒȂ^O
+	docs.push_back("text<!-- c --><div><p>a<p>b</i><li>c</div><br/><img src=x></p><div><a href=1></div></a>");
+	docs.push_back("<div><div><a>1</a></div></div><div><a>2</a></div><a>3</a><div attr='x");
+	docs.push_back("</p><html><a></b></a></html><a>after</a>");
+	//_ȃ^O̕
+	const char* tags[] = {"<div>", "</div>", "<a href=1>", "</a>", "<p class=x>", "</p>", "<li>", "</li>", "<br/>", "<img>", "t", "<!-- c -->",
+		"<x-a>", "</x-a>", "<x-b data-k=v>", "</X-B>"};
+	unsigned int seed = 7;
+	for(int d = 0; d < 30; ++d){
+		string str;
+		for(int i = 0; i < 60; ++i){
+			seed = seed * 1103515245 + 12345;
+			str += tags[(seed >> 8) % (sizeof(tags) / sizeof(tags[0]))];
+		}
+		docs.push_back(str);
+	}
+	const char* paths[] = {"/html/body/div", "//a", "//div[@class='item*']/a[2]", "//div//a", "//li[1]", "//li[@class=x][1]",
+		"//ul[2]/li", "//*[@href=?]", "//d?v/*", "/body", "//*", "//div/*[2]", "//*[@class]", "//p//a", "/div/div/a", "//title",
+		"//x-a", "//x-b[@data-k=v]", "//x-a/x-b", "//x-?//a"};
+	const nana::HtmlNodeBuilder::Policy policies[] = {nana::HtmlNodeBuilder::HIERARCHY_MATCH, nana::HtmlNodeBuilder::SAME_TAG_MATCH};
+	vector<unique_ptr<nana::path::HtmlPathPlan>> plans;
+	for(auto i = std::begin(paths); i != std::end(paths); ++i) plans.push_back(unique_ptr<nana::path::HtmlPathPlan>(new nana::path::HtmlPathPlan(*i)));
+	nana::HtmlSaxParser parser;
+	int mismatch = 0;
+	for(int p = 0; p < 2; ++p){
+		//SẴNG1̃nhœɕ]
+		nana::path::HtmlPathStreamHandler streamHandler(policies[p]);
+		for(auto i = plans.begin(); i != plans.end(); ++i) streamHandler.addQuery(**i);
+		for(std::size_t d = 0; d < docs.size(); ++d){
+			nana::DocumentHtmlSaxParserHandler handler(nana::HtmlDocument::HEAP, policies[p]);
+			parser.parse(docs[d].data(), docs[d].size(), handler);
+			unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+			//ȂNǴA[g̕^ǑłȂ΍Ō܂Ńp[X
+			if(streamHandler.parse(parser, docs[d].data(), docs[d].size())) A_TRUE(streamHandler.satisfied(), "[g̕^OŎ~߂");
+			for(std::size_t q = 0; q < plans.size(); ++q){
+				unique_ptr<nana::path::HtmlPathPlan::HtmlNodePtrs> expected = plans[q]->exec(docUptr->rootNode());
+				const nana::path::HtmlPathStreamHandler::Matches& matches = streamHandler.matches(q);
+				bool same = expected->size() == matches.size();
+				for(std::size_t i = 0; same && i < matches.size(); ++i){
+					const nana::HtmlNode& node = *(*expected)[i];
+					const nana::HtmlPart& first = (node.startTag() != nullptr) ? *node.startTag() : *node.endTag();
+					same = first.view().str() == matches[i].part->view().str() && first.lineNum() == matches[i].part->lineNum()
+						&& first.posNum() == matches[i].part->posNum() && first.type() == matches[i].part->type();
+				}
+				if(!same){
+					++mismatch;
+					cout << "policy " << p << " doc " << d << " " << paths[q] << endl;
+				}
+			}
+		}
+	}
+	A_EQUALS(mismatch, 0, "؂ĎsʂƓ");
+	//~߂Bvf̃eLXg͕܂ŘA
+	string page(docs[0]);
+	for(int i = 0; i < 1000; ++i) page.insert(page.size() - 14, "<div><p>filler</p></div>");
+	const nana::path::HtmlPathPlan title("//title"), desc("//meta[@name='description']"), missing("//table");
+	nana::path::HtmlPathStreamHandler handler;
+	const std::size_t titleQuery = handler.addQuery(title, 1);
+	const std::size_t descQuery = handler.addQuery(desc, 1);
+	A_TRUE(handler.parse(parser, page.data(), page.size()), "SČ~߂");
+	A_TRUE(handler.satisfied(), "");
+	A_EQUALS(handler.matches(titleQuery).size(), 1, "title");
+	A_EQUALS(handler.matches(titleQuery)[0].part->view().str(), "<title>", "title");
+	A_EQUALS(handler.matches(titleQuery)[0].text, "T 1", "titlẽeLXg");
+	A_EQUALS(handler.matches(descQuery)[0].part->attr("content", 0), "d", "meta");
+	//ȂNGꍇ͍Ō܂
+	handler.addQuery(missing, 1);
+	A_FALSE(handler.parse(parser, page.data(), page.size()), "ȂNG");
+	A_FALSE(handler.satisfied(), "ĂȂ");
+	A_EQUALS(handler.matches(titleQuery).size(), 1, "Ŏ~߂");
+};
+
+
 } //namespace
@@ -0,0 +1,121 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_atom.hpp"
+#include "../html_element.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+
+///SnbVłׂẴL[AL[ȊO͌Ȃ
+TEST_FUNC(test_PerfectHash){
+	vector<string> strs;
+	for(int i = 0; i < 500; ++i) strs.push_back("key" + std::to_string(i * 7));
+	vector<const char*> keys;
+	for(auto i = strs.begin(); i != strs.end(); ++i) keys.push_back(i->c_str());
+	nana::PerfectHash hash(keys.data(), keys.size());
+	A_EQUALS(hash.size(), 500, "L[̐");
+	bool allFound = true;
+	for(std::size_t i = 0; i < strs.size(); ++i) allFound = allFound && hash.find(strs[i].data(), strs[i].size()) == i;
+	A_TRUE(allFound, "ׂẴL[");
+	A_TRUE(hash.find("key1", 4) == nana::PerfectHash::NOT_FOUND, "L[ȊO");
+	A_TRUE(hash.find("key0", 3) == nana::PerfectHash::NOT_FOUND, "L[̑Ov");
+	A_TRUE(hash.find("", 0) == nana::PerfectHash::NOT_FOUND, "󕶎");
+}
+
+
+///^OA Atom
+TEST_FUNC(test_atom){
+	const nana::Atom div = nana::atom::intern("div");
+	A_TRUE(nana::atom::isStandard(div), "W̃^O");
+	A_EQUALS(nana::atom::name(div), "div", "O");
+	A_TRUE(nana::atom::find("div") == div, "");
+	A_TRUE(nana::atom::intern("") == nana::atom::EMPTY, "󕶎");
+	A_TRUE(nana::atom::isStandard(nana::atom::intern("href")), "W̑");
+	A_TRUE(nana::atom::intern("DIV") != div, "啶͕ʂ̖O");
+	//WȊO̖O
+	A_TRUE(nana::atom::find("x-test-atom") == nana::atom::UNKNOWN, "o^O");
+	vector<nana::Atom> atoms(4);
+	vector<std::thread> threads;
+	for(int t = 0; t < 4; ++t){
+		threads.push_back(std::thread([&atoms, t]{ atoms[t] = nana::atom::intern("x-test-atom"); }));
+	}
+	for(auto i = threads.begin(); i != threads.end(); ++i) i->join();
+	A_FALSE(nana::atom::isStandard(atoms[0]), "WȊO");
+	A_TRUE(atoms[0] == atoms[1] && atoms[0] == atoms[2] && atoms[0] == atoms[3], "ɓo^Ă Atom");
+	A_TRUE(nana::atom::find("x-test-atom") == atoms[0], "o^");
+	A_EQUALS(nana::atom::name(atoms[0]), "x-test-atom", "O");
+	//W
+	nana::atom::AtomSet set({"br", "x-test-set"});
+	A_TRUE(set.contains(nana::atom::intern("br")), "W");
+	A_TRUE(set.contains(nana::atom::intern("x-test-set")), "WȊȌW");
+	A_FALSE(set.contains(div), "WȊO");
+	A_FALSE(set.contains(nana::atom::UNKNOWN), "UNKNOWN");
+	//^O
+	nana::TagHtmlPart start("<DIV Class=a x-Attr>", 1, 1), end("</Div>", 1, 1);
+	A_TRUE(start.tagAtom() == div, "Jn^O");
+	A_FALSE(start.isEndTag(), "Jn^O");
+	A_TRUE(end.tagAtom() == div, "I^O/O");
+	A_TRUE(end.isEndTag(), "I^O");
+	A_TRUE(start.attrs()[0].nameAtom == nana::atom::intern("class"), "");
+	A_EQUALS(start.attr("x-attr", 0), "", "");
+	A_TRUE(start.hasAttr("x-attr", 0), "WȊȎ");
+	A_FALSE(start.hasAttr("x-none", 0), "o^ĂȂ");
+	//p[XWȊO̖O͓o^ȂiOŔrj
+	nana::TagHtmlPart custom("<X-Parsed-Tag x-parsed-attr=1 x-other=2 x-parsed-attr=3>", 1, 1), customEnd("</x-parsed-tag>", 1, 1);
+	A_TRUE(custom.tagAtom() == nana::atom::UNKNOWN, "WȊÕ^O");
+	A_TRUE(customEnd.tagAtom() == nana::atom::UNKNOWN, "WȊȌI^O");
+	A_EQUALS(custom.tagName(), "x-parsed-tag", "^O");
+	A_TRUE(custom.attrs()[0].nameAtom == nana::atom::UNKNOWN, "WȊȎ");
+	A_EQUALS(custom.attr("x-parsed-attr", 1), "3", "OŔr");
+	A_EQUALS(custom.attr("x-other", 0), "2", "OŔr");
+	A_FALSE(custom.hasAttr("x-parsed-attr", 2), "OŔr");
+	A_TRUE(nana::atom::find("x-parsed-tag") == nana::atom::UNKNOWN, "^Oo^Ȃ");
+	A_TRUE(nana::atom::find("x-parsed-attr") == nana::atom::UNKNOWN, "o^Ȃ");
+	A_TRUE(nana::atom::findStandard("div") == div, "W̖O");
+	A_TRUE(nana::atom::findStandard("x-test-atom") == nana::atom::UNKNOWN, "o^OWȊO");
+	//\̒ Atom
+	nana::atom::LocalAtomTable local;
+	const nana::Atom localAtom = local.intern("x-local");
+	A_TRUE(localAtom >= nana::atom::LOCAL_BASE, "[J Atom");
+	A_TRUE(local.intern("x-local") == localAtom, "O͓ Atom");
+	A_TRUE(local.intern("x-local2") != localAtom, "ႤO");
+	A_TRUE(local.intern("div") == div, "W̖O");
+	A_TRUE(local.intern("") == nana::atom::EMPTY, "󕶎");
+	A_EQUALS(local.size(), 2, "蓖ĂO̐");
+	A_EQUALS(local.name(localAtom), "x-local", "O");
+	A_EQUALS(local.name(div), "div", "W̖O");
+	A_TRUE(nana::atom::find("x-local") == nana::atom::UNKNOWN, "o^Ȃ");
+	A_FALSE(set.contains(localAtom), "W");
+	local.clear();
+	A_EQUALS(local.size(), 0, "폜");
+	A_EQUALS(local.name(localAtom), "", "폜O");
+}
+
+
+} //namespace
@@ -0,0 +1,242 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <atomic>
+#include <stdexcept>
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_batch.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+
+///SẴ^XN1񂸂sAO͑̃^XN̎sɓ邩
+TEST_FUNC(test_WorkStealingPool){
+	const std::size_t threadCounts[] = {1, 2, 4, 7};
+	for(int t = 0; t < 4; ++t){
+		nana::WorkStealingPool pool(threadCounts[t]);
+		A_EQUALS(pool.threadCount(), threadCounts[t], "Xbh");
+		for(std::size_t count = 0; count < 50; count += 7){
+			vector<std::atomic<int>> counts(count);
+			for(auto i = counts.begin(); i != counts.end(); ++i) *i = 0;
+			std::atomic<bool> badWorker(false);
+			pool.run(count, [&](const std::size_t p_index, const std::size_t p_worker){
+				if(p_worker >= threadCounts[t]) badWorker = true;
+				//Ԃ΂点
+				if(p_index % 5 == 0) std::this_thread::yield();
+				++counts[p_index];
+			});
+			bool allOnce = true;
+			for(auto i = counts.begin(); i != counts.end(); ++i) if(*i != 1) allOnce = false;
+			A_TRUE(allOnce, "1񂸂s");
+			A_FALSE(badWorker, "Xbh̔ԍ");
+		}
+		std::atomic<int> done(0);
+		bool thrown = false;
+		try{
+			pool.run(20, [&](const std::size_t p_index, const std::size_t){
+				if(p_index == 3) throw std::runtime_error("task");
+				++done;
+			});
+		} catch(std::runtime_error&){
+			thrown = true;
+		}
+		A_TRUE(thrown, "O𓊂");
+		A_EQUALS(done, 19, "̃^XN͎s");
+	}
+};
+
+
+///`Nɕ񑖍̌ʂA1ʂƓɂȂ邩
+TEST_FUNC(test_HtmlSaxParser_parseParallel){
+	nana::WorkStealingPool pool(3);
+	nana::HtmlSaxParser parser;
+	RecordHtmlSaxParserHandler handler, parallelHandler;
+	//`N̋E^OARgA"< "̓rɂȂ悤ɁAŏ̃`N
+	const char chars[] = "<>!- \n\ta/";
+	unsigned int seed = 7;
+	for(int n = 0; n < 3000; ++n){
+		string str;
+		const int len = n % 200;
+		for(int j = 0; j < len; ++j){
+			seed = seed * 1103515245 + 12345;
+			str += chars[(seed >> 16) % (sizeof(chars) - 1)];
+		}
+		parser.parse(str.data(), str.size(), handler);
+		parser.parseParallel(str.data(), str.size(), parallelHandler, pool, 1 + n % 7);
+		A_EQUALS(parallelHandler.result(), handler.result(), "_ȕ");
+	}
+	//Rgƃ^O`N܂ꍇ
+	string str("<html>\n");
+	for(int i = 0; i < 300; ++i){
+		str += "<p class='a\nb'>text " + std::to_string(i) + "</p>\n";
+		if(i % 50 == 0) str += "<!-- <b>\n" + string(200, 'c') + "\n<i> -->";
+		if(i % 70 == 0) str += "<div " + string(300, 'd') + "\n>< x>";
+	}
+	str += "<not end";
+	parser.parse(str.data(), str.size(), handler);
+	const std::size_t chunkSizes[] = {1, 10, 64, 1000};
+	for(int c = 0; c < 4; ++c){
+		parser.parseParallel(str.data(), str.size(), parallelHandler, pool, chunkSizes[c]);
+		A_EQUALS(parallelHandler.result(), handler.result(), "`N܂^O");
+	}
+	//nh̗vŎ~߂
+	for(std::size_t n = 1; n < 400; n += 37){
+		StopHtmlSaxParserHandler stopHandler(n);
+		A_FALSE(parser.parseParallel(str.data(), str.size(), stopHandler, pool, 64), "~߂");
+		A_EQUALS(stopHandler.result(), StopHtmlSaxParserHandler::expected(str, n), "~߂^O܂");
+	}
+	//Rs[Ȃnh
+	nana::SimpleHtmlSaxParserViewHandler viewHandler, parallelViewHandler;
+	parser.parse(str.data(), str.size(), viewHandler);
+	parser.parseParallel(str.data(), str.size(), parallelViewHandler, pool, 10);
+	unique_ptr<nana::HtmlDocument::HtmlPartUptrs> expectedUptr = viewHandler.result(), partsUptr = parallelViewHandler.result();
+	A_EQUALS(partsUptr->size(), expectedUptr->size(), "^O");
+	for(std::size_t i = 0; i < expectedUptr->size() && i < partsUptr->size(); ++i){
+		const nana::HtmlPart& expected = *(*expectedUptr)[i];
+		const nana::HtmlPart& part = *(*partsUptr)[i];
+		A_TRUE(part.view() == expected.view(), "^O");
+		A_EQUALS(part.lineNum(), expected.lineNum(), "s");
+		A_EQUALS(part.posNum(), expected.posNum(), "ʒu");
+	}
+	//Xbh1̏ꍇ͕Ȃ
+	nana::WorkStealingPool singlePool(1);
+	parser.parseParallel(str.data(), str.size(), parallelHandler, singlePool, 1);
+	A_EQUALS(parallelHandler.result(), handler.result(), "1Xbh");
+	//eLXgvf̓e̓rŃ`N𕪂ꍇ
+	parser.setRawTextElements(true);
+	for(int n = 0; n < 1000; ++n){
+		const string html = randomRawTextHtml(seed, n % 80);
+		parser.parse(html.data(), html.size(), handler);
+		parser.parseParallel(html.data(), html.size(), parallelHandler, pool, 1 + n % 7);
+		A_EQUALS(parallelHandler.result(), handler.result(), html.c_str());
+	}
+};
+
+
+///p[X̌ʂA1p[XʂƓɂȂ邩
+TEST_FUNC(test_HtmlBatchParser){
+	vector<string> strs;
+	for(int i = 0; i < 40; ++i){
+		string str("<html><body>");
+		for(int j = 0; j < i; ++j) str += "<div class=c" + std::to_string(j) + "><p>text</div>";
+		strs.push_back(str + "</body></html>");
+	}
+	const string path("test_batch_parser.tmp");
+	{
+		std::ofstream ofs(path.c_str(), std::ios::binary);
+		ofs << strs[5];
+	}
+	vector<nana::HtmlBatchInput> inputs;
+	for(auto i = strs.begin(); i != strs.end(); ++i) inputs.push_back(nana::HtmlBatchInput(*i));
+	//̃obt@̓|C^nullptrłt@Cł͂Ȃ
+	inputs.push_back(nana::HtmlBatchInput(nullptr, 0));
+	A_FALSE(inputs.back().isFile(), "̃obt@");
+	inputs.push_back(nana::HtmlBatchInput::file(path));
+	A_TRUE(inputs.back().isFile(), "t@C");
+	//1p[X
+	nana::HtmlSaxParser parser;
+	vector<std::size_t> expectedSizes;
+	vector<string> expectedTrees;
+	for(auto i = inputs.begin(); i != inputs.end(); ++i){
+		const string& str = i->isFile() ? strs[5] : string(i->data, i->size);
+		nana::DocumentHtmlSaxParserHandler handler;
+		parser.parse(str.data(), str.size(), handler);
+		unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+		expectedSizes.push_back(docUptr->size());
+		expectedTrees.push_back(nodeTreeStr(docUptr->rootNode()));
+	}
+	const nana::HtmlDocument::Ownership owners[] = {nana::HtmlDocument::HEAP, nana::HtmlDocument::ARENA};
+	for(int o = 0; o < 2; ++o){
+		nana::HtmlBatchParser batch(3, owners[o]);
+		A_EQUALS(batch.threadCount(), 3, "Xbh");
+		//ʂԂ
+		vector<unique_ptr<nana::HtmlDocument>> docs = batch.parse(inputs);
+		A_EQUALS(docs.size(), inputs.size(), "͂Ɠ");
+		for(std::size_t i = 0; i < docs.size(); ++i){
+			A_EQUALS(docs[i]->ownership(), owners[o], "̊mە@");
+			A_EQUALS(docs[i]->size(), expectedSizes[i], "^O");
+			A_EQUALS(nodeTreeStr(docs[i]->rootNode()), expectedTrees[i], "m[h̊Kw");
+		}
+		//֐ɓn
+		std::mutex mutex;
+		vector<string> trees(inputs.size());
+		batch.parse(inputs, [&](const std::size_t p_index, unique_ptr<nana::HtmlDocument>&& p_doc){
+			std::lock_guard<std::mutex> lock(mutex);
+			trees[p_index] = nodeTreeStr(p_doc->rootNode());
+		});
+		A_TRUE(trees == expectedTrees, "֐ɓn");
+		//QƂɔjiA[ig܂킷j
+		for(int n = 0; n < 2; ++n){
+			std::fill(trees.begin(), trees.end(), string());
+			batch.visit(inputs, [&](const std::size_t p_index, const nana::HtmlDocument& p_doc){
+				std::lock_guard<std::mutex> lock(mutex);
+				trees[p_index] = nodeTreeStr(p_doc.rootNode());
+			});
+			A_TRUE(trees == expectedTrees, "QƂ");
+		}
+	}
+	//t@CȂꍇ
+	std::remove(path.c_str());
+	nana::HtmlBatchParser batch(2);
+	bool thrown = false;
+	try{
+		batch.parse(inputs);
+	} catch(std::runtime_error&){
+		thrown = true;
+	}
+	A_TRUE(thrown, "݂Ȃt@C");
+};
+
+
+///A[iėpłԂɂĎo邩
+TEST_FUNC(test_HtmlDocument_recycleArena){
+	string str("<html><div id=a>text</div>");
+	for(int i = 0; i < 5000; ++i) str += "<p class=x>" + std::to_string(i) + "</p>";
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserViewHandler handler(nana::HtmlDocument::ARENA);
+	parser.parse(str.data(), str.size(), handler);
+	unique_ptr<nana::HtmlDocument> docUptr = handler.result();
+	const string tree = nodeTreeStr(docUptr->rootNode());
+	const nana::MonotonicArena* arena = docUptr->arena();
+	A_TRUE(arena->blockCount() > 1, "̃ubN");
+	unique_ptr<nana::MonotonicArena> arenaUptr = nana::HtmlDocument::recycleArena(move(docUptr));
+	A_TRUE(arenaUptr.get() == arena, "A[i");
+	A_EQUALS(arenaUptr->blockCount(), 1, "ŏ̃ubNc");
+	A_EQUALS(arenaUptr->allocatedBytes(), 0, "蓖ĂȂ");
+	handler.reuseArena(move(arenaUptr));
+	parser.parse(str.data(), str.size(), handler);
+	docUptr = handler.result();
+	A_TRUE(docUptr->arena() == arena, "g܂킷");
+	A_EQUALS(nodeTreeStr(docUptr->rootNode()), tree, "");
+	//HEAP̏ꍇ
+	nana::DocumentHtmlSaxParserHandler heapHandler;
+	parser.parse(str.data(), str.size(), heapHandler);
+	A_TRUE(nana::HtmlDocument::recycleArena(heapHandler.result()) == nullptr, "A[iȂ");
+};
+
+
+} //namespace
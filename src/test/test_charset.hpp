@@ -0,0 +1,194 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <sstream>
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_charset.hpp"
+#include "../html_analysys.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+///R[hŕϊiҒlUTF-8̃oCgŏj
+string decodeAs(const string& p_str, const nana::charset::Charset p_charset){
+	string ret;
+	nana::charset::decode(p_str.data(), p_str.data() + p_str.size(), p_charset, ret);
+	return ret;
+}
+
+///R[h̖OBOMA <meta charset> ̔
+TEST_FUNC(test_charset_sniff){
+	using namespace nana::charset;
+	A_EQUALS(fromName(" Shift_JIS "), SHIFT_JIS, "Ő");
+	A_EQUALS(fromName("Windows-31J"), SHIFT_JIS, "ʖ");
+	A_EQUALS(fromName("X-EUC-JP"), EUC_JP, "EUC-JP");
+	A_EQUALS(fromName("utf8"), UTF8, "UTF-8");
+	A_EQUALS(fromName("latin1"), WINDOWS_1252, "ISO-8859-1Windows-1252");
+	A_EQUALS(fromName("koi8-r"), UNKNOWN, "ΉĂȂ");
+	A_EQUALS(name(SHIFT_JIS), "Shift_JIS", "O");
+	A_EQUALS(name(UNKNOWN), "", "O");
+	//BOM
+	std::size_t bomSize;
+	A_EQUALS(sniffBom("\xEF\xBB\xBF<a>", 6, bomSize), UTF8, "UTF-8BOM");
+	A_EQUALS(bomSize, 3, "BOM̃oCg");
+	A_EQUALS(sniffBom("\xFF\xFE<\0", 4, bomSize), UTF16LE, "UTF-16LEBOM");
+	A_EQUALS(sniffBom("\xFE\xFF\0<", 4, bomSize), UTF16BE, "UTF-16BEBOM");
+	A_EQUALS(sniffBom("<a>", 3, bomSize), UNKNOWN, "BOMȂ");
+	A_EQUALS(bomSize, 0, "BOMȂ");
+	//meta
+	const char* metas[] = {
+		"<html><head><meta charset=\"Shift_JIS\"></head>",
+		"<META HTTP-EQUIV=\"Content-Type\" CONTENT=\"text/html; charset=shift_jis\">",
+		"<meta charset=sjis/>",
+		"<?xml version=\"1.0\" encoding='Shift_JIS'?><html>",
+		"<!-- <meta charset=\"euc-jp\"> --><meta name=x><meta charset = 'windows-31j'>"
+	};
+	for(auto m : metas) A_EQUALS(sniffMeta(m, strlen(m)), SHIFT_JIS, m);
+	const char* noMetas[] = {"<html><body>charset=sjis</body>", "<metacharset=sjis>", "<meta charset=\"koi8-r\">", ""};
+	for(auto m : noMetas) A_EQUALS(sniffMeta(m, strlen(m)), UNKNOWN, m);
+	A_EQUALS(sniffMeta("<meta charset=utf-16>", 21), UTF8, "UTF-16̎wUTF-8");
+	const string far = string(SNIFF_SIZE, ' ') + "<meta charset=\"euc-jp\">";
+	A_EQUALS(sniffMeta(far.data(), far.size()), UNKNOWN, "擪痣Ă");
+	//̏
+	const string bomAndMeta = "\xEF\xBB\xBF<meta charset=\"euc-jp\">";
+	A_EQUALS(sniff(bomAndMeta.data(), bomAndMeta.size()), UTF8, "BOMD");
+	const string metaAndText = "<meta charset=\"euc-jp\">\x82\xA0";
+	A_EQUALS(sniff(metaAndText.data(), metaAndText.size()), EUC_JP, "metaD");
+};
+
+
+///UTF-8̌؂ƁAeR[hUTF-8ւ̕ϊ
+TEST_FUNC(test_charset_decode){
+	using namespace nana::charset;
+	//UTF-8̌
+	const string valid("a\xE3\x81\x82\xC3\xA9\xF0\x9F\x98\x80" "b");
+	A_TRUE(isValidUtf8(valid.data(), valid.size()), "UTF-8");
+	const char* invalids[] = {"\x80", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xE3\x81", "\xFF"};
+	for(auto s : invalids) A_FALSE(isValidUtf8(s, strlen(s)), "sUTF-8");
+	for(std::size_t pos = 0; pos < 100; pos += 7){
+		//ASCII͓ǂݔ΂
+		string str(pos, 'a');
+		str += "\xE3\x81\x82\xE3\x81";
+		str += string(30, 'b');
+		A_TRUE(findInvalidUtf8(str.data(), str.size()) == str.data() + pos + 3, "sȈʒu");
+	}
+	A_EQUALS(decodeAs("a\xE3\x81" "b\xFF\xE3\x81\x82", UTF8), "a\xEF\xBF\xBD" "b\xEF\xBF\xBD\xE3\x81\x82", "sȕƂU+FFFD");
+	//VtgJIS
+	A_EQUALS(decodeAs("<p>\x82\xA0\x8A\xBF\x8E\x9A</p>", SHIFT_JIS), "<p>\xE3\x81\x82\xE6\xBC\xA2\xE5\xAD\x97</p>", "");
+	A_EQUALS(decodeAs("\xB1", SHIFT_JIS), "\xEF\xBD\xB1", "pJi");
+	A_EQUALS(decodeAs("\x81\x60\x87\x40", SHIFT_JIS), "\xEF\xBD\x9E\xE2\x91\xA0", "CP932̕");
+	A_EQUALS(decodeAs("\x5C\x7E", SHIFT_JIS), "\\~", "ASCII");
+	A_EQUALS(decodeAs("\x82", SHIFT_JIS), "\xEF\xBF\xBD", "rŏI");
+	A_EQUALS(decodeAs("\x82<\xA0", SHIFT_JIS), "\xEF\xBF\xBD<\xEF\xBF\xBD", "2oCgڂASCII");
+	//EUC-JP
+	A_EQUALS(decodeAs("<p>\xA4\xA2\xB4\xC1\xBB\xFA</p>", EUC_JP), "<p>\xE3\x81\x82\xE6\xBC\xA2\xE5\xAD\x97</p>", "");
+	A_EQUALS(decodeAs("\x8E\xB1", EUC_JP), "\xEF\xBD\xB1", "pJi");
+	A_EQUALS(decodeAs("\x8F\xB0\xA1" "a", EUC_JP), "\xEF\xBF\xBD" "a", "⏕");
+	A_EQUALS(decodeAs("\xA4<", EUC_JP), "\xEF\xBF\xBD<", "2oCgڂASCII");
+	//EUC-JP̋_̓VtgJIS̓ɂȂ
+	int mismatch = 0;
+	for(int row = 0; row < 94; ++row){
+		for(int cell = 0; cell < 94; ++cell){
+			const char euc[] = {static_cast<char>(0xA1 + row), static_cast<char>(0xA1 + cell), '\0'};
+			const int lead = (row / 2) + (row < 62 ? 0x81 : 0xC1);
+			const int trail = (row % 2) ? 0x9F + cell : 0x40 + cell + (cell >= 63 ? 1 : 0);
+			const char sjis[] = {static_cast<char>(lead), static_cast<char>(trail), '\0'};
+			//Ή镶ȂꍇAVtgJIS2oCgڂASCIIȂǂݒ
+			const string expected = decodeAs(sjis, SHIFT_JIS).substr(0, 3);
+			if(decodeAs(euc, EUC_JP) != expected) ++mismatch;
+		}
+	}
+	A_EQUALS(mismatch, 0, "EUC-JPƃVtgJIS");
+	//UTF-16
+	A_EQUALS(decodeAs(string("<\0\x3D\xD8\x00\xDE", 6), UTF16LE), "<\xF0\x9F\x98\x80", "UTF-16LE");
+	A_EQUALS(decodeAs(string("\0<\xD8\x3D\xDE\x00", 6), UTF16BE), "<\xF0\x9F\x98\x80", "UTF-16BE");
+	A_EQUALS(decodeAs(string("\x3D\xD8" "a\0\x00\xDE" "b", 7), UTF16LE), "\xEF\xBF\xBD" "a\xEF\xBF\xBD\xEF\xBF\xBD", "΂̂ȂTQ[gAoCg");
+	//Windows-1252
+	A_EQUALS(decodeAs("caf\xE9 \x80", WINDOWS_1252), "caf\xC3\xA9 \xE2\x82\xAC", "Windows-1252");
+	A_EQUALS(fromWindows1252(0x9F), 0x178u, "0x9F");
+	try{
+		decodeAs("a", UNKNOWN);
+		A_TRUE(false, "OĂȂ");
+	} catch(std::invalid_argument& e){
+		A_NOT_NULL(e.what(), "");
+	}
+};
+
+
+///e̐ƁAŜUTF-8ւ̕ϊ
+TEST_FUNC(test_charset_toUtf8){
+	using namespace nana::charset;
+	const string sjisText("<p>\x93\xFA\x96\x7B\x8C\xEA\x82\xCC\x83\x65\x83\x4C\x83\x58\x83\x67\x82\xC5\x82\xB7\x81\x42</p>");
+	const string eucText("<p>\xC6\xFC\xCB\xDC\xB8\xEC\xA4\xCE\xA5\xC6\xA5\xAD\xA5\xB9\xA5\xC8\xA4\xC7\xA4\xB9\xA1\xA3</p>");
+	const string utf8Text("<p>\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88\xE3\x81\xA7\xE3\x81\x99\xE3\x80\x82</p>");
+	A_EQUALS(guess(sjisText.data(), sjisText.size()), SHIFT_JIS, "VtgJIS");
+	A_EQUALS(guess(eucText.data(), eucText.size()), EUC_JP, "EUC-JP");
+	A_EQUALS(guess(utf8Text.data(), utf8Text.size()), UTF8, "UTF-8");
+	A_EQUALS(guess("<p>abc</p>", 10), UTF8, "ASCII");
+	const string latin("<p>Caf\xE9 cr\xE8me br\xFBl\xE9" "e, na\xEFve fa\xE7" "ade \xE0 la fran\xE7" "aise</p>");
+	A_EQUALS(guess(latin.data(), latin.size()), WINDOWS_1252, "{ł͂Ȃ");
+	//͐擪ׂ
+	string longSjis;
+	while(longSjis.size() < 200 * 1024) longSjis += sjisText;
+	A_EQUALS(guess(longSjis.data(), longSjis.size()), SHIFT_JIS, "");
+	//ϊ
+	string buf;
+	Charset cs = UNKNOWN;
+	nana::StrView ret = toUtf8(sjisText.data(), sjisText.size(), buf, cs);
+	A_EQUALS(cs, SHIFT_JIS, "肵R[h");
+	A_EQUALS(ret.str(), utf8Text, "VtgJISϊ");
+	A_TRUE(ret.data() == buf.data(), "ϊ");
+	cs = UNKNOWN;
+	ret = toUtf8(utf8Text.data(), utf8Text.size(), buf, cs);
+	A_EQUALS(cs, UTF8, "UTF-8");
+	A_TRUE(ret.data() == utf8Text.data() && ret.size() == utf8Text.size(), "UTF-8̓Rs[Ȃ");
+	const string withBom = "\xEF\xBB\xBF" + utf8Text;
+	cs = SHIFT_JIS;
+	ret = toUtf8(withBom.data(), withBom.size(), buf, cs);
+	A_EQUALS(cs, UTF8, "BOMD");
+	A_TRUE(ret.data() == withBom.data() + 3, "BOM");
+	cs = EUC_JP;
+	ret = toUtf8(eucText.data(), eucText.size(), buf, cs);
+	A_EQUALS(ret.str(), utf8Text, "w肵R[h");
+	const string ascii("<meta charset=\"Shift_JIS\"><p>abc</p>");
+	cs = UNKNOWN;
+	ret = toUtf8(ascii.data(), ascii.size(), buf, cs);
+	A_EQUALS(cs, SHIFT_JIS, "meta");
+	A_TRUE(ret.data() == ascii.data(), "ASCIIȂRs[Ȃ");
+	const string broken("<p>\xE3\x81\x82\xE3</p>");
+	cs = UTF8;
+	ret = toUtf8(broken.data(), broken.size(), buf, cs);
+	A_EQUALS(ret.str(), "<p>\xE3\x81\x82\xEF\xBF\xBD</p>", "sUTF-8͒u");
+	//ϊăp[X
+	unique_ptr<string> sjisDoc(new string("<html><head><meta charset=\"Shift_JIS\"></head><body>" + sjisText + "</body></html>"));
+	nana::DocumentHtmlSaxParserViewHandler handler;
+	cs = UNKNOWN;
+	unique_ptr<nana::HtmlDocument> doc = nana::parseHtmlAsUtf8(sjisDoc->data(), sjisDoc->size(), handler, cs);
+	sjisDoc.reset();
+	A_EQUALS(cs, SHIFT_JIS, "肵R[h");
+	A_EQUALS(doc->at(6)->str(), utf8Text.substr(3, utf8Text.size() - 7), "ϊێ");
+};
+
+
+} //namespace
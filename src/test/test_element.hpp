@@ -58,6 +58,30 @@ TEST_FUNC(test_TagHtmlPart_parseTag){
 		nana::TagHtmlPart htmlPart("<input>", 1, 1);
 		A_EQUALS(htmlPart.attrNames()->size(), 0, "Ȃ");
 	}
+	{
+		//Ȏ
+		nana::TagHtmlPart htmlPart("<input b=1 A=2 b='3' c>", 1, 1);
+		A_EQUALS(htmlPart.attr("b", 0), "1", "d1");
+		A_EQUALS(htmlPart.attr("b", 1), "3", "d2");
+		A_EQUALS(htmlPart.attr("b", 2), "", "d3߂͂Ȃ");
+		A_TRUE(htmlPart.hasAttr("b", 1), "d2");
+		A_FALSE(htmlPart.hasAttr("b", 2), "d3߂͂Ȃ");
+		A_EQUALS(htmlPart.attr("a", 0), "2", "");
+		//attrNames()͖OŏdȂ
+		unique_ptr<vector<const string*>> names = htmlPart.attrNames();
+		A_EQUALS(names->size(), 3, "O̐");
+		A_EQUALS(*(*names)[0], "a", "O");
+		A_EQUALS(*(*names)[1], "b", "O");
+		A_EQUALS(*(*names)[2], "c", "O");
+		//attrs()͋Lqŏd
+		const nana::HtmlAttrs& attrs = htmlPart.attrs();
+		A_EQUALS(attrs.size(), 4, "̐");
+		A_EQUALS(attrs[0].name, "b", "Lq");
+		A_EQUALS(attrs[1].name, "a", "Lq");
+		A_EQUALS(attrs[2].value, "3", "Lq");
+		A_EQUALS(attrs[3].name, "c", "lȂ");
+		A_EQUALS(attrs[3].value, "", "lȂ");
+	}
 
 
 }
@@ -173,4 +197,355 @@ TEST_FUNC(test_HtmlDocument1){
 
 
 
+
+///nȟĂяo𕶎ŋL^
+class RecordHtmlSaxParserHandler :public nana::HtmlSaxParserHandler{
+public:
+	virtual void start(){ m_log.str(""); };
+	virtual void text(const std::string& p_str, const long p_line, const long p_pos){ record("text", p_str, p_line, p_pos); };
+	virtual void tag(const std::string& p_str, const long p_line, const long p_pos){ record("tag", p_str, p_line, p_pos); };
+	virtual void comment(const std::string& p_str, const long p_line, const long p_pos){ record("comment", p_str, p_line, p_pos); };
+	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos){ record("notEnd", p_str, p_line, p_pos); };
+	string result()const{ return m_log.str(); };
+private:
+	void record(const char* p_type, const std::string& p_str, const long p_line, const long p_pos){
+		m_log << p_type << "(" << p_line << "," << p_pos << ")[" << p_str << "]\n";
+	};
+	ostringstream m_log;
+};
+
+///1̃p[XƃubNPʂ̃p[X̌ʂ
+TEST_FUNC(test_HtmlSaxParser_parseBlock){
+	const char* strs[] = {
+		"", "<", "a<", "<a", "< a>", "<\n<a>\n", "<<a>>", "<>", "<!-->", "<!--->", "<!-- a -->b",
+		"<!--<a><-->x", "<!-- a", "<a\nb='>'\n>\n<!--\n-->\n<b", " <!Doctype afdafa><tAg aA='xX'> <!--d/--></tag><tes2/><not gg='"
+	};
+	nana::HtmlSaxParser parser;
+	RecordHtmlSaxParserHandler handlerChar, handlerBlock, handlerBuffered;
+	for(std::size_t i = 0; i < sizeof(strs) / sizeof(strs[0]); ++i){
+		string str(strs[i]);
+		istringstream is(str), is2(str);
+		parser.parse(is, handlerChar);
+		parser.parse(str.data(), str.size(), handlerBlock);
+		parser.parseBuffered(is2, handlerBuffered);
+		A_EQUALS(handlerBlock.result(), handlerChar.result(), strs[i]);
+		A_EQUALS(handlerBuffered.result(), handlerChar.result(), strs[i]);
+	}
+	//_ȕ
+	const char chars[] = "<>!- \n\ta/";
+	unsigned int seed = 1;
+	for(int n = 0; n < 2000; ++n){
+		string str;
+		const int len = n % 40;
+		for(int j = 0; j < len; ++j){
+			seed = seed * 1103515245 + 12345;
+			str += chars[(seed >> 16) % (sizeof(chars) - 1)];
+		}
+		istringstream is(str);
+		parser.parse(is, handlerChar);
+		parser.parse(str.data(), str.size(), handlerBlock);
+		A_EQUALS(handlerBlock.result(), handlerChar.result(), "_ȕ");
+	}
+};
+
+
+///vbV^̃p[TɕēnʂA܂Ƃ߂ăp[XʂƓ
+TEST_FUNC(test_HtmlPushParser){
+	const char* strs[] = {
+		"", "<", "a<", "<a", "< a>", "<\n<a>\n", "<<a>>", "<>", "<!-->", "<!--->", "<!-- a -->b",
+		"<!--<a><-->x", "<!-- a", "<a\nb='>'\n>\n<!--\n-->\n<b", " <!Doctype afdafa><tAg aA='xX'> <!--d/--></tag><tes2/><not gg='"
+	};
+	nana::HtmlSaxParser parser;
+	RecordHtmlSaxParserHandler handler, pushHandler;
+	nana::HtmlPushParser pushParser(pushHandler);
+	for(std::size_t n = 0; n < sizeof(strs) / sizeof(strs[0]); ++n){
+		const string str(strs[n]);
+		parser.parse(str.data(), str.size(), handler);
+		//SĂ̈ʒu2ɕ
+		for(std::size_t i = 0; i <= str.size(); ++i){
+			pushParser.feed(str.data(), i);
+			pushParser.feed(str.data() + i, str.size() - i);
+			pushParser.finish();
+			A_EQUALS(pushHandler.result(), handler.result(), strs[n]);
+		}
+		//1
+		for(std::size_t i = 0; i < str.size(); ++i) pushParser.feed(str.data() + i, 1);
+		pushParser.finish();
+		A_EQUALS(pushHandler.result(), handler.result(), strs[n]);
+	}
+	//_ȕ_Ȓɕ
+	const char chars[] = "<>!- \n\ta/";
+	unsigned int seed = 3;
+	for(int n = 0; n < 2000; ++n){
+		string str;
+		const int len = n % 60;
+		for(int j = 0; j < len; ++j){
+			seed = seed * 1103515245 + 12345;
+			str += chars[(seed >> 16) % (sizeof(chars) - 1)];
+		}
+		parser.parse(str.data(), str.size(), handler);
+		for(std::size_t i = 0; i < str.size();){
+			seed = seed * 1103515245 + 12345;
+			const std::size_t size = std::min<std::size_t>(str.size() - i, (seed >> 16) % 5);
+			pushParser.feed(str.data() + i, size);
+			i += size;
+		}
+		pushParser.finish();
+		A_EQUALS(pushHandler.result(), handler.result(), "_ȕ");
+	}
+	//󂯎m[h쐬
+	const string html("<html><body><div>a<br>b</div></body></html>");
+	nana::DocumentHtmlSaxParserHandler docHandler;
+	nana::HtmlPushParser docParser(docHandler);
+	docParser.feed(html.data(), 10);
+	docParser.feed(html.data() + 10, html.size() - 10);
+	docParser.finish();
+	unique_ptr<nana::HtmlDocument> docUptr = docHandler.result();
+	A_EQUALS(docUptr->size(), 9, "^O");
+	A_EQUALS(docUptr->rootNode().childNodeList()[0]->tagName(), "html", "m[h");
+	//nȂꍇ start() Ă
+	nana::HtmlPushParser emptyParser(docHandler);
+	emptyParser.finish();
+	A_EQUALS(docHandler.result()->size(), 0, "");
+};
+
+
+///p_stopTagڂ̃^OiRgjő̒~vnh
+class StopHtmlSaxParserHandler :public RecordHtmlSaxParserHandler{
+public:
+	/**
+	@param p_muteOnly [in]truȅꍇ͒~vAp_stopTagڂL^Ȃi~߂ꍇ̊Ғlj
+	*/
+	explicit StopHtmlSaxParserHandler(const std::size_t p_stopTag, const bool p_muteOnly = false)
+		: m_stopTag(p_stopTag), m_muteOnly(p_muteOnly), m_tagCnt(0){};
+	virtual void start(){ RecordHtmlSaxParserHandler::start(); m_tagCnt = 0; };
+	virtual void text(const std::string& p_str, const long p_line, const long p_pos){
+		if(!muted()) RecordHtmlSaxParserHandler::text(p_str, p_line, p_pos);
+	};
+	virtual void tag(const std::string& p_str, const long p_line, const long p_pos){
+		if(!muted()) RecordHtmlSaxParserHandler::tag(p_str, p_line, p_pos);
+		counted();
+	};
+	virtual void comment(const std::string& p_str, const long p_line, const long p_pos){
+		if(!muted()) RecordHtmlSaxParserHandler::comment(p_str, p_line, p_pos);
+		counted();
+	};
+	virtual void notEnd(const std::string& p_str, const long p_line, const long p_pos){
+		if(!muted()) RecordHtmlSaxParserHandler::notEnd(p_str, p_line, p_pos);
+	};
+	///p_strp_stopTagڂ̃^OŎ~߂ꍇ̋L^
+	static string expected(const string& p_str, const std::size_t p_stopTag){
+		nana::HtmlSaxParser parser;
+		StopHtmlSaxParserHandler handler(p_stopTag, true);
+		parser.parse(p_str.data(), p_str.size(), handler);
+		return handler.result();
+	};
+private:
+	const bool muted()const{ return m_muteOnly && m_stopTag != 0 && m_tagCnt >= m_stopTag; };
+	void counted(){
+		if(++m_tagCnt == m_stopTag && !m_muteOnly) requestStop();
+	};
+	const std::size_t m_stopTag;
+	const bool m_muteOnly;
+	std::size_t m_tagCnt;
+};
+
+///nh̗vő~߁A~߂_ĊJł邩
+TEST_FUNC(test_HtmlSaxParser_stop){
+	const string str("<html>\n<head><title>t</title>< x <!-- c\n --><meta charset=utf-8></head>\n<body>a<br/>b<not end");
+	nana::HtmlSaxParser parser;
+	RecordHtmlSaxParserHandler handler;
+	parser.parse(str.data(), str.size(), handler);
+	const string all = handler.result();
+	for(std::size_t n = 1; n <= 10; ++n){
+		const string msg = std::to_string(n) + "ڂ̃^OŎ~߂";
+		const string expected = StopHtmlSaxParserHandler::expected(str, n);
+		const bool last = expected == all;
+		StopHtmlSaxParserHandler stopHandler(n);
+		//1
+		istringstream is(str);
+		A_EQUALS(parser.parse(is, stopHandler), last, msg.c_str());
+		A_EQUALS(stopHandler.result(), expected, msg.c_str());
+		//ubNP
+		A_EQUALS(parser.parse(str.data(), str.size(), stopHandler), last, msg.c_str());
+		A_EQUALS(stopHandler.result(), expected, msg.c_str());
+		if(!last){
+			//~߂_ĊJƁAŌ܂őꍇƓɂȂ
+			A_TRUE(parser.resume(str.data(), str.size(), parser.stoppedAt(), stopHandler), msg.c_str());
+			A_EQUALS(stopHandler.result(), all, msg.c_str());
+		}
+		//vbV^B~߂̎cn
+		nana::HtmlPushParser pushParser(stopHandler);
+		std::size_t fed = 0;
+		for(std::size_t i = 0; i < str.size(); i += 5){
+			const std::size_t size = std::min<std::size_t>(5, str.size() - i);
+			fed += pushParser.feed(str.data() + i, size);
+			if(stopHandler.stopRequested()) break;
+		}
+		if(!last) A_EQUALS(stopHandler.result(), expected, msg.c_str());
+		stopHandler.clearStop();
+		A_EQUALS(pushParser.feed(str.data() + fed, str.size() - fed), str.size() - fed, msg.c_str());
+		pushParser.finish();
+		A_EQUALS(stopHandler.result(), all, msg.c_str());
+	}
+	//p[X̊Jnɒ~̗v
+	StopHtmlSaxParserHandler stopHandler(0);
+	stopHandler.requestStop();
+	A_TRUE(parser.parse(str.data(), str.size(), stopHandler), "O̗v͎");
+	A_EQUALS(stopHandler.result(), all, "O̗v͎");
+};
+
+
+///eLXgvf̊JnEI^OɎfЂȂ
+string randomRawTextHtml(unsigned int& p_seed, const int p_count){
+	const char* pieces[] = {
+		"<script>", "</script>", "</SCRIPT >", "</scriptx>", "</scr", "<style a='1'>", "</Style\n>", "<textarea>", "</textarea/>",
+		"<script/>", "<b>", "</b>", "<!--", "-->", "<", ">", "/", " ", "\n", "a"
+	};
+	string ret;
+	for(int j = 0; j < p_count; ++j){
+		p_seed = p_seed * 1103515245 + 12345;
+		ret += pieces[(p_seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))];
+	}
+	return ret;
+}
+
+///scriptAstyleAtextarea̓e𐶃eLXgƂĈꍇɁASẴp[X̕@œʂɂȂ邩
+TEST_FUNC(test_HtmlSaxParser_rawText){
+	nana::HtmlSaxParser parser;
+	A_FALSE(parser.rawTextElements(), "l");
+	parser.setRawTextElements(true);
+	RecordHtmlSaxParserHandler handler, handlerChar, pushHandler;
+	const string str("<p><script>if(a<b){x='</p>'}</scriptx></SCRIPT\n>d<style>\n</style><textarea><b></textarea><script/>e</script>");
+	parser.parse(str.data(), str.size(), handler);
+	A_EQUALS(handler.result(), string("tag(1,0)[<p>]\ntag(1,2)[<script>]\ntext(1,9)[if(a<b){x='</p>'}</scriptx>]\n")
+		+ "tag(1,37)[</SCRIPT\n>]\ntext(2,45)[d]\ntag(2,47)[<style>]\ntext(2,52)[\n]\ntag(3,54)[</style>]\n"
+		+ "tag(3,60)[<textarea>]\ntext(3,69)[<b>]\ntag(3,73)[</textarea>]\ntag(3,82)[<script/>]\ntext(3,90)[e]\ntag(3,92)[</script>]\n", "eLXg");
+	//ĂȂꍇ͍Ō܂ŃeLXg
+	const string unclosed("<style>a</styl</style");
+	parser.parse(unclosed.data(), unclosed.size(), handler);
+	A_EQUALS(handler.result(), "tag(1,0)[<style>]\ntext(1,6)[a</styl</style]\n", "ĂȂ");
+	//1AubNPʁAvbV^œɂȂ
+	nana::HtmlPushParser pushParser(pushHandler);
+	pushParser.setRawTextElements(true);
+	unsigned int seed = 5;
+	for(int n = 0; n < 2000; ++n){
+		const string html = randomRawTextHtml(seed, n % 30);
+		istringstream is(html);
+		parser.parse(html.data(), html.size(), handler);
+		parser.parse(is, handlerChar);
+		A_EQUALS(handlerChar.result(), handler.result(), html.c_str());
+		for(std::size_t i = 0; i < html.size();){
+			seed = seed * 1103515245 + 12345;
+			const std::size_t size = std::min<std::size_t>(html.size() - i, (seed >> 16) % 7);
+			pushParser.feed(html.data() + i, size);
+			i += size;
+		}
+		pushParser.finish();
+		A_EQUALS(pushHandler.result(), handler.result(), html.c_str());
+	}
+	//~̗v͐eLXgvf̏I^ǑŎ󂯕tAĊJł
+	const string page("<head><script>a<b>c</script><title>t</title></head>");
+	parser.parse(page.data(), page.size(), handler);
+	StopHtmlSaxParserHandler stopHandler(2);
+	A_FALSE(parser.parse(page.data(), page.size(), stopHandler), "~߂");
+	A_EQUALS(stopHandler.result(), "tag(1,0)[<head>]\ntag(1,5)[<script>]\ntext(1,12)[a<b>c]\ntag(1,18)[</script>]\n", "~߂");
+	A_TRUE(parser.resume(page.data(), page.size(), parser.stoppedAt(), stopHandler), "ĊJ");
+	A_EQUALS(stopHandler.result(), handler.result(), "ĊJ");
+};
+
+
+///Rs[ȂnȟʂARs[nhƓɂȂ邩
+TEST_FUNC(test_SimpleHtmlSaxParserViewHandler1){
+	string str(" <!Doctype afdafa><tAg aA='xX'>\n <!--d/--></tag><tes2/><not gg='");
+
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserHandler handler;
+	nana::SimpleHtmlSaxParserViewHandler viewHandler;
+	parser.parse(str.data(), str.size(), handler);
+	parser.parse(str.data(), str.size(), viewHandler);
+	nana::HtmlDocument doc(handler.result(), nullptr);
+	nana::HtmlDocument viewDoc(viewHandler.result(), nullptr);
+
+	//
+	A_EQUALS(viewDoc.size(), doc.size(), "^O̐");
+	for(std::size_t i = 0; i < doc.size() && i < viewDoc.size(); ++i){
+		const nana::HtmlPart& part = *doc.at(i);
+		const nana::HtmlPart& viewPart = *viewDoc.at(i);
+		A_FALSE(part.isView(), "Rs[Ă");
+		A_TRUE(viewPart.isView(), "QƂ̂");
+		A_TRUE(viewPart.view().data() >= str.data() && viewPart.view().end() <= str.data() + str.size(), "̓obt@QƂĂ");
+		A_EQUALS(viewPart.type(), part.type(), "^Cv");
+		A_EQUALS(viewPart.tagName(), part.tagName(), "^O");
+		A_EQUALS(viewPart.lineNum(), part.lineNum(), "s");
+		A_EQUALS(viewPart.posNum(), part.posNum(), "ʒu");
+		A_TRUE(viewPart.view() == part.view(), "view()");
+		A_EQUALS(viewPart.str(), part.str(), "str()");
+	}
+	A_EQUALS(viewDoc.at(2)->attr("aa", 0), "xX", "");
+};
+
+
+///^O̕\i HtmlPartTable j̓eA HtmlPart ̔zƓɂȂ邩
+TEST_FUNC(test_HtmlPartTable){
+	unsigned int seed = 3;
+	vector<string> strs;
+	strs.push_back(" <!Doctype afdafa><tAg aA='xX'>\n <!--d/--></TAG><tes2/><not gg='");
+	strs.push_back("");
+	for(int n = 0; n < 20; ++n) strs.push_back(randomRawTextHtml(seed, 50));
+	nana::HtmlSaxParser parser;
+	nana::SimpleHtmlSaxParserViewHandler viewHandler;
+	nana::HtmlPartTableViewHandler tableHandler((nana::StrView()));
+	unique_ptr<nana::HtmlPartTable> table;
+	for(auto s = strs.begin(); s != strs.end(); ++s){
+		parser.parse(s->data(), s->size(), viewHandler);
+		nana::HtmlDocument doc(viewHandler.result(), nullptr);
+		//O̕\̗̈g܂킷
+		if(table) tableHandler.reuseTable(move(table));
+		tableHandler.setSource(nana::StrView(*s));
+		parser.parse(s->data(), s->size(), tableHandler);
+		table = tableHandler.result();
+		A_TRUE(table->source().data() == s->data(), "̓obt@");
+		A_EQUALS(table->size(), doc.size(), "^O̐");
+		std::size_t i = 0;
+		for(auto ite = table->begin(); ite != table->end() && i < doc.size(); ++ite, ++i){
+			const nana::HtmlPartRef ref = *ite;
+			const nana::HtmlPart& part = *doc.at(i);
+			A_EQUALS(ref.index(), i, "ʒu");
+			A_EQUALS(ref.type(), part.type(), "^Cv");
+			A_EQUALS(ref.typeStr(), part.typeStr(), "^Cv̕");
+			A_EQUALS(ref.tagName(), part.tagName(), "^O");
+			A_EQUALS(ref.tagAtom(), part.tagAtom(), "^O Atom");
+			A_EQUALS(ref.isEndTag(), part.isEndTag(), "I^O");
+			A_EQUALS(ref.lineNum(), part.lineNum(), "s");
+			A_EQUALS(ref.posNum(), part.posNum(), "ʒu");
+			A_TRUE(ref.view().data() == part.view().data() && ref.view().size() == part.view().size(), "̓obt@QƂĂ");
+			A_EQUALS(table->offset(i), static_cast<std::size_t>(part.view().data() - s->data()), "擪̃oCg");
+		}
+		A_EQUALS(table->tagAtoms().size(), table->size(), "");
+	}
+	//HtmlPart ̍쐬
+	const string& str = strs[0];
+	tableHandler.setSource(nana::StrView(str));
+	parser.parse(str.data(), str.size(), tableHandler);
+	table = tableHandler.result();
+	A_TRUE((*table)[2] == (*table)[2], "^O");
+	A_TRUE((*table)[2] != (*table)[3], "Ⴄ^O");
+	A_EQUALS((*table)[2].str(), "<tAg aA='xX'>", "str()");
+	A_EQUALS((*table)[2].part()->attr("aa", 0), "xX", "");
+	A_EQUALS((*table)[5].tagName(), "/tag", "I^O");
+	A_EQUALS((*table)[1].part()->type(), nana::HtmlPart::DECLARATION, "錾");
+	A_EQUALS((*table)[table->size() - 1].part()->type(), nana::HtmlPart::NOT_END, "^ȌI肪Ȃ");
+	A_TRUE(table->memoryBytes() > 0, "mۂoCg");
+	//̓obt@̊OQƂ^O͒ǉłȂ
+	try{
+		const string other("<a>");
+		table->push(nana::HtmlPart::TAG, false, nana::atom::EMPTY, nana::StrView(other), 1, 0);
+		A_TRUE(false, "OĂȂ");
+	} catch(std::out_of_range& e){
+		A_NOT_NULL(e.what(), "");
+	}
+};
+
+
 } //namespace
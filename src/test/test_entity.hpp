@@ -0,0 +1,119 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <sstream>
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_entity.hpp"
+#include "../html_element.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+
+///QƂWJł邩iҒlUTF-8̃oCgŏj
+TEST_FUNC(test_entity_decode){
+	using nana::entity::decode;
+	A_EQUALS(decode("", false), "", "");
+	A_EQUALS(decode("abc", false), "abc", "QƂȂ");
+	A_EQUALS(decode("a&amp;b", false), "a&b", "amp");
+	A_EQUALS(decode("&lt;&gt;&quot;&apos;", false), "<>\"'", "L");
+	//lQ
+	A_EQUALS(decode("&#38;&#x26;&#X26;&#0038", false), "&&&&", "lQ");
+	A_EQUALS(decode("&#x41;&#97;", false), "Aa", "ASCII");
+	A_EQUALS(decode("&#xE9;&#x3042;&#x1F600;", false), "\xC3\xA9" "\xE3\x81\x82" "\xF0\x9F\x98\x80", "UTF-8");
+	A_EQUALS(decode("&#0;&#xD800;&#x110000;&#99999999999;", false),
+		"\xEF\xBF\xBD" "\xEF\xBF\xBD" "\xEF\xBF\xBD" "\xEF\xBF\xBD", "͈͊OU+FFFD");
+	A_EQUALS(decode("&#128;&#x9F;", false), "\xE2\x82\xAC" "\xC5\xB8", "Windows-1252");
+	A_EQUALS(decode("&#;&#x;&#xg;", false), "&#;&#x;&#xg;", "Ȃ");
+	//OtQ
+	A_EQUALS(decode("&copy;&COPY;&copy", false), "\xC2\xA9" "\xC2\xA9" "\xC2\xA9", "copy");
+	A_EQUALS(decode("&notit;", false), "\xC2\xAC" "it;", "Â`̈ԒO");
+	A_EQUALS(decode("&notin;", false), "\xE2\x88\x89", ";ŏI閼OD");
+	A_EQUALS(decode("&NotEqualTilde;", false), "\xE2\x89\x82" "\xCC\xB8", "2");
+	A_EQUALS(decode("&CounterClockwiseContourIntegral;", false), "\xE2\x88\xB3", "ԒO");
+	A_EQUALS(decode("&Afr;", false), "\xF0\x9D\x94\x84", "U+10000ȏ");
+	A_EQUALS(decode("&foo; & x a& &;&amp", false), "&foo; & x a& &;&", "QƂł͂Ȃ");
+	A_EQUALS(decode("&hellip", false), "&hellip", "Â`ɂȂO;Kv");
+	//l
+	A_EQUALS(decode("/x?a=1&copy=2&amp;b&ampc", true), "/x?a=1&copy=2&b&ampc", "lł͉p=̑OWJȂ");
+	A_EQUALS(decode("&copy;&copy &amp", true), "\xC2\xA9" "\xC2\xA9" " &", "l");
+	A_EQUALS(decode("&ampc", false), "&c", "eLXgł͓WJ");
+	//ǉ
+	string out("x");
+	nana::entity::decode("&lt;", "&lt;" + 4, out, false);
+	A_EQUALS(out, "x<", "ɒǉ");
+};
+
+
+///OtQƂł邩
+TEST_FUNC(test_entity_findNamed){
+	std::uint32_t codePoints[2];
+	A_TRUE(nana::entity::findNamed("amp;", 4, codePoints), "amp;");
+	A_EQUALS(codePoints[0], 0x26u, "amp;");
+	A_EQUALS(codePoints[1], 0u, "amp;");
+	A_TRUE(nana::entity::findNamed("AElig", 5, codePoints), "Â`");
+	A_FALSE(nana::entity::findNamed("hellip", 6, codePoints), "Â`ɂȂO");
+	A_FALSE(nana::entity::findNamed("ampx", 4, codePoints), "݂Ȃ");
+	A_FALSE(nana::entity::findNamed("", 0, codePoints), "");
+	A_TRUE(nana::entity::contains("a&b", "a&b" + 3), "&");
+	A_FALSE(nana::entity::contains("abc", "abc" + 3), "&Ȃ");
+};
+
+
+///eLXgƑ̒lǍĂяoɓWJĕێ邩
+TEST_FUNC(test_HtmlPart_decoded){
+	const string text("a &lt;b&gt; &amp c");
+	const nana::TextHtmlPart textPart(nana::StrView(text), 1, 0);
+	A_TRUE(textPart.decoded() == nana::StrView("a <b> & c"), "eLXg");
+	A_TRUE(textPart.decoded().data() == textPart.decoded().data(), "ێ");
+	A_TRUE(textPart.view() == nana::StrView(text), "͕̕ςȂ");
+	const string plain("no entity");
+	const nana::TextHtmlPart plainPart(nana::StrView(plain), 1, 0);
+	A_TRUE(plainPart.decoded().data() == plain.data(), "&Ȃ΂̂܂");
+	const nana::CommentHtmlPart comment("<!-- &amp; -->", 1, 0);
+	A_TRUE(comment.decoded() == comment.view(), "eLXgȊO");
+	//
+	const nana::TagHtmlPart tag("<a href='/x?a=1&amp;b=2&copy=3' title=\"&lt;T&gt;\" id=x title=&quot;>", 1, 0);
+	A_EQUALS(tag.decodedAttr("href", 0), "/x?a=1&b=2&copy=3", "href");
+	A_EQUALS(tag.attr("href", 0), "/x?a=1&amp;b=2&copy=3", "̒l͕ςȂ");
+	A_EQUALS(tag.decodedAttr("title", 0), "<T>", "title");
+	A_EQUALS(tag.decodedAttr("title", 1), "\"", "2ڂtitle");
+	A_EQUALS(tag.decodedAttr("id", 0), "x", "&Ȃl");
+	A_EQUALS(tag.attr("title", 0), "&lt;T&gt;", "̈ꗗ͕ςȂ");
+	const nana::TagHtmlPart plainTag("<a id=x class=y>", 1, 0);
+	A_TRUE(&plainTag.decodedAttr("id", 0) == &plainTag.attr("id", 0), "&ȂΌ̒l");
+	A_TRUE(&plainTag.decodedAttrs() == &plainTag.attrs(), "&ȂΌ̈ꗗ");
+	A_EQUALS(tag.decodedAttr("none", 0), "", "݂Ȃ");
+	const nana::HtmlAttrs& attrs = tag.decodedAttrs();
+	A_EQUALS(attrs.size(), 4, "̈ꗗ");
+	A_TRUE(&attrs != &tag.attrs(), "WJꗗ͕ʂɎ");
+	A_EQUALS(attrs[0].value, "/x?a=1&b=2&copy=3", "ꗗ̒l");
+	A_EQUALS(attrs[1].value, "<T>", "ꗗ̒l2");
+	A_EQUALS(attrs[2].value, "x", "&Ȃl");
+	A_EQUALS(attrs[3].name, "title", "ꗗ̖O");
+	A_EQUALS(textPart.decodedAttr("href", 0), "", "eLXg̑");
+};
+
+
+} //namespace
@@ -0,0 +1,123 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <stdexcept>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_file.hpp"
+#include "../html_element.hpp"
+#include "../html_analysys.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+
+///eXgp̃t@C쐬
+void writeTestFile(const string& p_path, const string& p_str){
+	std::ofstream ofs(p_path.c_str(), std::ios::binary);
+	ofs << p_str;
+}
+
+
+///}bvt@C̓eƁAt@CJȂꍇ̗O
+TEST_FUNC(test_MappedFile){
+	const string path("test_mapped_file.tmp");
+	writeTestFile(path, "<p>abc</p>\n");
+	{
+		nana::MappedFile file(path);
+		A_EQUALS(file.size(), 11, "TCY");
+		A_EQUALS(string(file.data(), file.size()), "<p>abc</p>\n", "e");
+		file.advise(nana::MappedFile::RANDOM);
+		A_EQUALS(file.data()[0], '<', "qgςĂe");
+	}
+	writeTestFile(path, "");
+	{
+		nana::MappedFile file(path, nana::MappedFile::NORMAL);
+		A_EQUALS(file.size(), 0, "TCY0");
+		A_TRUE(file.data() != nullptr, "TCY0łLȃ|C^");
+	}
+	std::remove(path.c_str());
+	bool thrown = false;
+	try{
+		nana::MappedFile file(path);
+	} catch(std::runtime_error&){
+		thrown = true;
+	}
+	A_TRUE(thrown, "݂Ȃt@C");
+};
+
+
+///t@C}bvăp[XʂA̕p[XʂƓɂȂ邩
+TEST_FUNC(test_parseHtmlFile){
+	const string path("test_parse_html_file.tmp");
+	string str("<html>\n<div id='main'><p>a<br>b</p></div>\n<!-- c --><input name=x></html>");
+	writeTestFile(path, str);
+	nana::HtmlSaxParser parser;
+	nana::DocumentHtmlSaxParserHandler expectedHandler;
+	parser.parse(str.data(), str.size(), expectedHandler);
+	unique_ptr<nana::HtmlDocument> expectedUptr = expectedHandler.result();
+	//}bsOQƂ
+	nana::DocumentHtmlSaxParserViewHandler viewHandler(nana::HtmlDocument::ARENA);
+	unique_ptr<nana::HtmlDocument> viewDocUptr = nana::parseHtmlFile(path, viewHandler);
+	//Rs[
+	nana::DocumentHtmlSaxParserHandler copyHandler;
+	unique_ptr<nana::HtmlDocument> copyDocUptr = nana::parseHtmlFile(path, copyHandler, nana::MappedFile::WILLNEED);
+	//t@CĂ}bsO͗L
+	std::remove(path.c_str());
+	A_EQUALS(viewDocUptr->size(), expectedUptr->size(), "^OiQƁj");
+	A_EQUALS(copyDocUptr->size(), expectedUptr->size(), "^OiRs[j");
+	for(std::size_t i = 0; i < expectedUptr->size(); ++i){
+		A_EQUALS(viewDocUptr->at(i)->str(), expectedUptr->at(i)->str(), "^OiQƁj");
+		A_EQUALS(viewDocUptr->at(i)->lineNum(), expectedUptr->at(i)->lineNum(), "siQƁj");
+		A_EQUALS(viewDocUptr->at(i)->posNum(), expectedUptr->at(i)->posNum(), "ʒuiQƁj");
+		A_EQUALS(copyDocUptr->at(i)->str(), expectedUptr->at(i)->str(), "^OiRs[j");
+	}
+	A_EQUALS(viewDocUptr->rootNode().childNodeList().size(), expectedUptr->rootNode().childNodeList().size(), "m[h");
+	A_EQUALS(viewDocUptr->rootNode().childNodeList()[0]->tagName(), "html", "m[h̃^O");
+#ifndef _WIN32
+	//t@CfBXNv^
+	writeTestFile(path, str);
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	unique_ptr<nana::HtmlDocument> fdDocUptr = nana::parseHtmlFile(fd, viewHandler);
+	::close(fd);
+	std::remove(path.c_str());
+	A_EQUALS(fdDocUptr->size(), expectedUptr->size(), "^Oifdj");
+	A_EQUALS(fdDocUptr->at(1)->str(), "\n", "eLXgifdj");
+#endif
+	bool thrown = false;
+	try{
+		nana::parseHtmlFile(path, viewHandler);
+	} catch(std::runtime_error&){
+		thrown = true;
+	}
+	A_TRUE(thrown, "݂Ȃt@C");
+};
+
+
+} //namespace
@@ -0,0 +1,75 @@
+/*
+* Copyright 2017 the original author or authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+
+
+#include "assert.hpp"
+
+
+
+#include "../html_scan.hpp"
+
+namespace{
+
+using namespace std;
+using namespace nana::test;
+
+
+///ׂĂ̖߃ZbgŃXJ[ƓʂɂȂ邩
+TEST_FUNC(test_scan_levels){
+	const nana::scan::Level levels[] = {nana::scan::SCALAR, nana::scan::SSE2, nana::scan::AVX2};
+	const nana::scan::Level orgLevel = nana::scan::level();
+	const nana::scan::ByteSet set("<>\"'\n");
+	//200oCg̃f[^i̕قǍ\Ȃj
+	string data;
+	unsigned int seed = 7;
+	for(int i = 0; i < 200; ++i){
+		seed = seed * 1103515245 + 12345;
+		const unsigned int r = (seed >> 16) % (i + 10);
+		data += (r < 5 ? "<>\"'\n"[r] : static_cast<char>('a' + r % 26));
+	}
+	const char* const begin = data.data();
+	const char* const end = begin + data.size();
+	for(std::size_t lv = 0; lv < sizeof(levels) / sizeof(levels[0]); ++lv){
+		if(!nana::scan::setLevel(levels[lv])) continue;
+		for(std::size_t off = 0; off < data.size(); off += 3){
+			//Ғlstd̃ASYŋ߂
+			const char* expectedFirst = begin + off;
+			while(expectedFirst != end && !set.contains(*expectedFirst)) ++expectedFirst;
+			A_TRUE(nana::scan::findFirstOf(begin + off, end, set) == expectedFirst, "findFirstOf");
+			A_TRUE(nana::scan::findChar(begin + off, end, '\'') == std::find(begin + off, end, '\''), "findChar");
+			A_EQUALS(nana::scan::countChar(begin + off, end, '\n'), static_cast<std::size_t>(std::count(begin + off, end, '\n')), "countChar");
+			A_TRUE(nana::scan::findNonAscii(begin + off, end) == end, "findNonAscii ASCII");
+		}
+		//ASCIIłȂ1ui2ڂ1ڂj
+		for(std::size_t pos = 0; pos < data.size(); pos += 5){
+			string nonAscii(data);
+			nonAscii[pos] = '\xE3';
+			if(pos + 40 < nonAscii.size()) nonAscii[pos + 40] = '\x80';
+			const char* const nb = nonAscii.data();
+			A_TRUE(nana::scan::findNonAscii(nb, nb + nonAscii.size()) == nb + pos, "findNonAscii");
+			A_TRUE(nana::scan::findNonAscii(nb + pos + 1, nb + nonAscii.size()) == nb + std::min(pos + 40, nonAscii.size()), "findNonAscii 2");
+		}
+	}
+	nana::scan::setLevel(orgLevel);
+	A_TRUE(nana::scan::isSupported(nana::scan::SCALAR), "XJ[͏Ɏgpł");
+};
+
+
+} //namespace
@@ -14,6 +14,12 @@ using namespace std;
 #include "test/assert.hpp"
 #include "test/test_analysys.hpp"
 #include "test/test_element.hpp"
+#include "test/test_scan.hpp"
+#include "test/test_atom.hpp"
+#include "test/test_entity.hpp"
+#include "test/test_charset.hpp"
+#include "test/test_file.hpp"
+#include "test/test_batch.hpp"
 
 
 int main(int argc, char *argv[]){